@@ -3,10 +3,6 @@
 #include <cmath>
 using namespace std;
 
-
-const double M_PI = 3.14159265358979323846;
-
-
 // Helper function to parse coordinates from string "lat, lon"
 static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     if (coordStr.empty()) return false;
@@ -85,31 +81,18 @@ static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     return true;
 }
 
-// Helper function to calculate distance between two coordinates (Haversine formula)
-static double calculateDistance(double lat1, double lon1, double lat2, double lon2) {
-    const double R = 6371.0; // Earth radius in kilometers
-    
-    double dLat = (lat2 - lat1) * M_PI / 180.0;
-    double dLon = (lon2 - lon1) * M_PI / 180.0;
-    
-    double a = sin(dLat / 2.0) * sin(dLat / 2.0) +
-               cos(lat1 * M_PI / 180.0) * cos(lat2 * M_PI / 180.0) *
-               sin(dLon / 2.0) * sin(dLon / 2.0);
-    
-    double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-    double distance = R * c;
-    
-    return distance;
-}
+const double AirportManager::DEFAULT_MAX_LEG_DISTANCE = 2500.0;
 
 // Constructor
 AirportManager::AirportManager(Graph* graph)
-    : cityGraph(graph), airportCount(0) {
+    : cityGraph(graph), airportCount(0), legCount(0) {
     // Initialize hash tables with reasonable sizes (prime numbers)
     airportsByID = new HashTable(101);
     airportsByName = new HashTable(101);
     airportsByCode = new HashTable(31); // Smaller size for codes (fewer codes than airports)
     allAirportsList = new SinglyLinkedList();
+    airNetwork = new Graph(MAX_AIRPORTS, true); // Legs are one-way, return legs are separate edges
+    transfers = new TransferTable();
 }
 
 // Destructor
@@ -133,11 +116,20 @@ AirportManager::~AirportManager() {
         delete allAirportsList;
         allAirportsList = nullptr;
     }
+    if (airNetwork != nullptr) {
+        delete airNetwork;
+        airNetwork = nullptr;
+    }
+    if (transfers != nullptr) {
+        delete transfers;
+        transfers = nullptr;
+    }
 }
 
 // Set the city graph
 void AirportManager::setCityGraph(Graph* graph) {
     cityGraph = graph;
+    rebuildTransfers();
 }
 
 // Get the city graph
@@ -170,6 +162,15 @@ void AirportManager::getAllAirports(Airport** airports, int& count) const {
     delete[] airportIDs;
 }
 
+// Recompute the bus stop transfers of every airport
+void AirportManager::rebuildTransfers() {
+    transfers->clear();
+    for (int i = 0; i < airNetwork->getVertexCount(); i++) {
+        Vertex* vertex = airNetwork->getVertexAt(i);
+        transfers->addNode(vertex->vertexID, vertex->latitude, vertex->longitude, cityGraph);
+    }
+}
+
 // Add an airport to the manager
 bool AirportManager::addAirport(Airport* airport) {
     if (airport == nullptr) return false;
@@ -180,6 +181,13 @@ bool AirportManager::addAirport(Airport* airport) {
         return false; // Airport already exists
     }
     
+    // Add airport to the air network (no flights yet)
+    if (!airNetwork->addVertex(airport->getAirportID(), airport->getName(),
+                               airport->getLatitude(), airport->getLongitude(), airport)) {
+        return false; // Air network is full
+    }
+    transfers->addNode(airport->getAirportID(), airport->getLatitude(), airport->getLongitude(), cityGraph);
+    
     // Add to all hash tables
     airportsByID->insert(airport->getAirportID(), (void*)airport);
     airportsByName->insert(airport->getName(), (void*)airport);
@@ -193,28 +201,6 @@ bool AirportManager::addAirport(Airport* airport) {
         cityGraph->addVertex(airport->getAirportID(), airport->getName(), 
                             airport->getLatitude(), airport->getLongitude(), airport);
         cityGraph->connectToNearestStop(airport->getAirportID());
-        
-        // Connect this airport to all other existing airports for direct flights
-        // Use linked list size to determine array size (includes the airport we just added)
-        int listSize = allAirportsList->getSize();
-        if (listSize > 1) { // Only if there are other airports (listSize includes the one we just added)
-            Airport** allAirports = new Airport*[listSize];
-            int allCount = 0;
-            getAllAirports(allAirports, allCount);
-            
-            for (int i = 0; i < allCount; i++) {
-                if (allAirports[i]->getAirportID() != airport->getAirportID()) {
-                    // Calculate air distance
-                    double airDist = calculateDistance(airport->getLatitude(), airport->getLongitude(),
-                                                      allAirports[i]->getLatitude(),
-                                                      allAirports[i]->getLongitude());
-                    // Add edge with air distance (bidirectional)
-                    cityGraph->addEdge(airport->getAirportID(), allAirports[i]->getAirportID(), airDist);
-                }
-            }
-            
-            delete[] allAirports;
-        }
     }
     
     airportCount++;
@@ -312,8 +298,8 @@ Airport* AirportManager::findNearestAirport(double latitude, double longitude) {
     
     // Find nearest airport
     for (int i = 0; i < count; i++) {
-        double dist = calculateDistance(latitude, longitude,
-                                       airports[i]->getLatitude(), airports[i]->getLongitude());
+        double dist = Graph::calculateDistance(latitude, longitude,
+                                              airports[i]->getLatitude(), airports[i]->getLongitude());
         if (minDistance < 0.0 || dist < minDistance) {
             minDistance = dist;
             nearestAirport = airports[i];
@@ -324,44 +310,106 @@ Airport* AirportManager::findNearestAirport(double latitude, double longitude) {
     return nearestAirport;
 }
 
-// Calculate air distance between two airports (straight line distance)
-bool AirportManager::calculateAirDistance(const string& fromAirportID, const string& toAirportID, double& distance) {
-    distance = 0.0;
-    if (fromAirportID.empty() || toAirportID.empty()) return false;
+// Add a flight leg between two airports
+bool AirportManager::addFlightLeg(const string& fromAirportID, const string& toAirportID, double distance,
+                                  bool bothWays) {
+    if (fromAirportID == toAirportID) return false;
     
     Airport* fromAirport = findAirportByID(fromAirportID);
     Airport* toAirport = findAirportByID(toAirportID);
-    
     if (fromAirport == nullptr || toAirport == nullptr) return false;
     
-    // Calculate air distance (straight line using Haversine formula)
-    distance = calculateDistance(fromAirport->getLatitude(), fromAirport->getLongitude(),
-                                 toAirport->getLatitude(), toAirport->getLongitude());
+    if (distance <= 0.0) {
+        distance = Graph::calculateDistance(fromAirport->getLatitude(), fromAirport->getLongitude(),
+                                            toAirport->getLatitude(), toAirport->getLongitude());
+    }
+    
+    // addEdge updates the distance of an existing leg, so only count new ones
+    if (!airNetwork->areAdjacent(fromAirportID, toAirportID)) legCount++;
+    airNetwork->addEdge(fromAirportID, toAirportID, distance);
     
+    if (bothWays) {
+        if (!airNetwork->areAdjacent(toAirportID, fromAirportID)) legCount++;
+        airNetwork->addEdge(toAirportID, fromAirportID, distance);
+    }
     return true;
 }
 
-// Find path from one airport to another (direct flight)
+// Add direct legs between every pair of airports within range
+int AirportManager::buildDefaultFlightLegs(double maxLegDistance) {
+    int count = airNetwork->getVertexCount();
+    int added = 0;
+    
+    for (int i = 0; i < count; i++) {
+        Vertex* from = airNetwork->getVertexAt(i);
+        for (int j = i + 1; j < count; j++) {
+            Vertex* to = airNetwork->getVertexAt(j);
+            if (airNetwork->areAdjacent(from->vertexID, to->vertexID) ||
+                airNetwork->areAdjacent(to->vertexID, from->vertexID)) {
+                continue; // Already has a scheduled leg
+            }
+            
+            double airDist = Graph::calculateDistance(from->latitude, from->longitude, to->latitude, to->longitude);
+            if (airDist > maxLegDistance) continue;
+            
+            if (addFlightLeg(from->vertexID, to->vertexID, airDist, true)) {
+                added += 2;
+            }
+        }
+    }
+    
+    return added;
+}
+
+// Get number of flight legs
+int AirportManager::getFlightLegCount() const {
+    return legCount;
+}
+
+// Get the air network
+Graph* AirportManager::getAirNetwork() const {
+    return airNetwork;
+}
+
+// Get the airport → bus stop transfers
+const TransferTable* AirportManager::getTransfers() const {
+    return transfers;
+}
+
+// Calculate air distance between two airports over the flight legs
+bool AirportManager::calculateAirDistance(const string& fromAirportID, const string& toAirportID, double& distance) {
+    distance = 0.0;
+    if (fromAirportID.empty() || toAirportID.empty()) return false;
+    
+    if (findAirportByID(fromAirportID) == nullptr || findAirportByID(toAirportID) == nullptr) return false;
+    
+    int pathLength = 0;
+    string* path = airNetwork->findShortestPath(fromAirportID, toAirportID, pathLength, distance);
+    if (path == nullptr) return false; // No flights between the airports
+    
+    delete[] path;
+    return true;
+}
+
+// Find the shortest flight route from one airport to another
 bool AirportManager::findAirportPath(const string& fromAirportID, const string& toAirportID, 
                                      string* path, int& pathLength, double& distance) {
     pathLength = 0;
     distance = 0.0;
     if (fromAirportID.empty() || toAirportID.empty() || path == nullptr) return false;
     
-    Airport* fromAirport = findAirportByID(fromAirportID);
-    Airport* toAirport = findAirportByID(toAirportID);
+    if (findAirportByID(fromAirportID) == nullptr || findAirportByID(toAirportID) == nullptr) return false;
     
-    if (fromAirport == nullptr || toAirport == nullptr) return false;
+    int routeLength = 0;
+    string* route = airNetwork->findShortestPath(fromAirportID, toAirportID, routeLength, distance);
+    if (route == nullptr) return false;
     
-    // Direct flight path: fromAirport -> toAirport
-    path[0] = fromAirportID;
-    path[1] = toAirportID;
-    pathLength = 2;
-    
-    // Calculate air distance
-    distance = calculateDistance(fromAirport->getLatitude(), fromAirport->getLongitude(),
-                                 toAirport->getLatitude(), toAirport->getLongitude());
+    for (int i = 0; i < routeLength; i++) {
+        path[i] = route[i];
+    }
+    pathLength = routeLength;
     
+    delete[] route;
     return true;
 }
 
@@ -397,26 +445,6 @@ bool AirportManager::loadAirportsFromCSVData(CSVRow* airportData, int airportCou
             delete airport;
             continue;
         }
-        
-        // Connect this airport to all other airports for direct air travel
-        if (cityGraph != nullptr) {
-            Airport** allAirports = new Airport*[this->airportCount];
-            int allCount = 0;
-            getAllAirports(allAirports, allCount);
-            
-            for (int j = 0; j < allCount; j++) {
-                if (allAirports[j]->getAirportID() != airportID) {
-                    // Calculate air distance
-                    double airDist = calculateDistance(lat, lon,
-                                                      allAirports[j]->getLatitude(),
-                                                      allAirports[j]->getLongitude());
-                    // Add edge with air distance (bidirectional)
-                    cityGraph->addEdge(airportID, allAirports[j]->getAirportID(), airDist);
-                }
-            }
-            
-            delete[] allAirports;
-        }
     }
     
     return true;
@@ -441,7 +469,10 @@ void AirportManager::clear() {
     if (airportsByName != nullptr) airportsByName->clear();
     if (airportsByCode != nullptr) airportsByCode->clear();
     if (allAirportsList != nullptr) allAirportsList->clear();
+    if (airNetwork != nullptr) airNetwork->clear();
+    if (transfers != nullptr) transfers->clear();
     
     airportCount = 0;
+    legCount = 0;
 }
 
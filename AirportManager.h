@@ -6,11 +6,15 @@
 #include "core_classes/HashTable.h"
 #include "core_classes/SinglyLinkedList.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/TransferTable.h"
 #include "Airport.h"
 using namespace std;
 
 // AirportManager class - Central manager for all airports
 // Used for: Airport/Rail integration (bonus module), airport management, airport-to-airport travel
+// Airports live in their own air network (flight legs weighted by km, one edge per direction),
+// separate from the city graph, so connecting flights can be routed. Each airport also keeps
+// a precomputed table of the bus stops within walking distance.
 class AirportManager {
 private:
     HashTable* airportsByID;          // Hash table for airport lookup by ID (key = airportID, value = Airport*)
@@ -19,11 +23,21 @@ private:
     SinglyLinkedList* allAirportsList; // Linked list to track all airports for iteration (stores airportID)
     Graph* cityGraph;                  // Pointer to shared city graph (for nearest bus stop connection)
     int airportCount;                   // Current number of airports
+    Graph* airNetwork;                  // Airports as vertices, flight legs as directed edges (km)
+    int legCount;                       // Number of flight legs (each direction counts once)
+    TransferTable* transfers;           // Airport → nearby bus stops (walking)
     
     // Helper function to get all airports as array
     void getAllAirports(Airport** airports, int& count) const;
     
+    // Recompute the bus stop transfers of every airport (after the city graph changes)
+    // Complexity: O(A × V)
+    void rebuildTransfers();
+    
 public:
+    static const int MAX_AIRPORTS = 200;               // Capacity of the air network
+    static const double DEFAULT_MAX_LEG_DISTANCE;       // 2500 km, range used by buildDefaultFlightLegs
+    
     // Constructor
     // Parameters: graph - pointer to shared city graph
     AirportManager(Graph* graph = nullptr);
@@ -32,6 +46,7 @@ public:
     ~AirportManager();
     
     // Set the city graph (if not provided in constructor)
+    // Note: Recomputes the bus stop transfers of every airport
     void setCityGraph(Graph* graph);
     
     // Get the city graph
@@ -39,8 +54,9 @@ public:
     
     // Airport management
     // Add an airport to the manager
-    // Returns: true if successful, false if airport already exists
-    // Note: Automatically connects airport to nearest bus stop in graph
+    // Returns: true if successful, false if airport already exists or the air network is full
+    // Note: Automatically connects airport to nearest bus stop in graph and computes its transfers
+    // Note: The airport has no flights until addFlightLeg / buildDefaultFlightLegs connects it
     bool addAirport(Airport* airport);
     
     // Find an airport by ID
@@ -70,17 +86,43 @@ public:
     // Returns: Pointer to nearest Airport, nullptr if no airports or graph unavailable
     Airport* findNearestAirport(double latitude, double longitude);
     
+    // Air network
+    // Add a flight leg between two airports
+    // Parameters: fromAirportID, toAirportID, distance in km (<= 0 to use the great-circle distance),
+    //             bothWays - also add the return leg
+    // Returns: true if both airports exist, false otherwise (an existing leg gets the new distance)
+    // Complexity: O(d) where d is legs leaving the airport
+    bool addFlightLeg(const string& fromAirportID, const string& toAirportID, double distance = -1.0,
+                      bool bothWays = true);
+    
+    // Add direct legs (both ways) between every pair of airports within range that has none yet
+    // Used when no flight schedule is available, or after adding an airport by hand
+    // Parameters: maxLegDistance - longest direct flight in km
+    // Returns: number of legs added
+    // Complexity: O(A^2)
+    int buildDefaultFlightLegs(double maxLegDistance = DEFAULT_MAX_LEG_DISTANCE);
+    
+    // Get number of flight legs
+    int getFlightLegCount() const;
+    
+    // Get the air network (airports as vertices, flight legs as directed edges in km)
+    Graph* getAirNetwork() const;
+    
+    // Get the precomputed airport → bus stop transfers
+    const TransferTable* getTransfers() const;
+    
     // Airport-to-airport travel
-    // Calculate air distance between two airports (straight line distance)
+    // Calculate air distance between two airports over the flight legs (shortest route)
     // Parameters: fromAirportID, toAirportID, distance (output)
-    // Returns: true if both airports found, false otherwise
+    // Returns: true if both airports found and connected by flights, false otherwise
+    // Complexity: O((A + L) log A) where L is flight legs
     bool calculateAirDistance(const string& fromAirportID, const string& toAirportID, double& distance);
     
-    // Find path from one airport to another (direct flight)
+    // Find the shortest flight route from one airport to another (direct or connecting flights)
     // Parameters: fromAirportID, toAirportID, path array (output), pathLength (output), distance (output)
     // Returns: true if path found, false otherwise
-    // Note: For airports, path is always direct (2 stops: source airport -> destination airport)
-    // Note: Caller must allocate path array with sufficient size (at least 2)
+    // Note: Caller must allocate path array with at least getAirportCount() entries
+    // Complexity: O((A + L) log A)
     bool findAirportPath(const string& fromAirportID, const string& toAirportID, 
                         string* path, int& pathLength, double& distance);
     
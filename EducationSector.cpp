@@ -3,41 +3,8 @@
 using namespace std;
 
 // Helper function to get approximate coordinates for Islamabad sectors
-static void getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
-    // Base coordinates for Islamabad (approximate center)
-    double baseLat = 33.684;
-    double baseLon = 73.047;
-    
-    // Default to base coordinates
-    latitude = baseLat;
-    longitude = baseLon;
-    
-    // Map common sectors to approximate coordinates (Islamabad layout)
-    if (sector == "G-10" || sector == "G10") {
-        latitude = 33.684; longitude = 73.025;
-    } else if (sector == "F-8" || sector == "F8") {
-        latitude = 33.700; longitude = 73.037;
-    } else if (sector == "F-6" || sector == "F6") {
-        latitude = 33.715; longitude = 73.045;
-    } else if (sector == "G-9" || sector == "G9") {
-        latitude = 33.690; longitude = 73.030;
-    } else if (sector == "F-7" || sector == "F7") {
-        latitude = 33.707; longitude = 73.040;
-    } else if (sector == "G-8" || sector == "G8") {
-        latitude = 33.694; longitude = 73.032;
-    } else if (sector == "H-8" || sector == "H8") {
-        latitude = 33.710; longitude = 73.042;
-    } else if (sector == "I-8" || sector == "I8") {
-        latitude = 33.720; longitude = 73.048;
-    } else if (sector == "G-6" || sector == "G6") {
-        latitude = 33.709; longitude = 73.044;
-    } else if (sector == "Blue Area") {
-        latitude = 33.697; longitude = 73.039;
-    } else {
-        // For unknown sectors, use base coordinates with slight variation
-        latitude = baseLat;
-        longitude = baseLon;
-    }
+static bool getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
+    return SectorGazetteer::getShared()->getCoordinates(sector, latitude, longitude);
 }
 
 // Helper function to convert string to double (replaces stod from STL)
@@ -81,10 +48,60 @@ static double stringToDouble(const string& str) {
     return isNegative ? -result : result;
 }
 
+// Helper function to find where a rating belongs in a best-first array
+// (first school rated below it, so equal ratings keep registration order)
+static int findRatingPosition(School** schools, int count, double rating) {
+    int low = 0;
+    int high = count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (schools[mid]->getRating() >= rating) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// SubjectPostingList Implementation
+SubjectPostingList::SubjectPostingList(const string& s) : subject(s), count(0), capacity(4) {
+    schools = new School*[capacity];
+}
+
+SubjectPostingList::~SubjectPostingList() {
+    delete[] schools;
+    schools = nullptr;
+}
+
+void SubjectPostingList::insertByRating(School* school) {
+    if (count >= capacity) {
+        int newCapacity = capacity * 2;
+        School** newSchools = new School*[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newSchools[i] = schools[i];
+        }
+        delete[] schools;
+        schools = newSchools;
+        capacity = newCapacity;
+    }
+    
+    int position = findRatingPosition(schools, count, school->getRating());
+    for (int i = count; i > position; i--) {
+        schools[i] = schools[i - 1];
+    }
+    schools[position] = school;
+    count++;
+}
+
+// EducationSector Implementation
 EducationSector::EducationSector(int maxSchools, int hashTableSize) 
-    : maxSchools(maxSchools), schoolCount(0), ownsLocationGraph(true) {
+    : subjectListCount(0), subjectListCapacity(16), ownsLocationGraph(true),
+      maxSchools(maxSchools), schoolCount(0) {
     schoolTable = new HashTable(hashTableSize);
-    schoolRanking = new MinHeap(maxSchools);
+    rankedSchools = new School*[maxSchools];
+    subjectTable = new HashTable(hashTableSize);
+    subjectLists = new SubjectPostingList*[subjectListCapacity];
     locationGraph = new Graph(maxSchools * 2, false); // Undirected graph for locations
     schoolIDList = new string[maxSchools];
 }
@@ -103,9 +120,22 @@ EducationSector::~EducationSector() {
         schoolTable = nullptr;
     }
     
-    if (schoolRanking != nullptr) {
-        delete schoolRanking;
-        schoolRanking = nullptr;
+    if (rankedSchools != nullptr) {
+        delete[] rankedSchools;
+        rankedSchools = nullptr;
+    }
+    
+    // Delete subject posting lists
+    for (int i = 0; i < subjectListCount; i++) {
+        delete subjectLists[i];
+    }
+    delete[] subjectLists;
+    subjectLists = nullptr;
+    subjectListCount = 0;
+    
+    if (subjectTable != nullptr) {
+        delete subjectTable;
+        subjectTable = nullptr;
     }
     
     if (locationGraph != nullptr && ownsLocationGraph) {
@@ -121,6 +151,43 @@ EducationSector::~EducationSector() {
     schoolCount = 0;
 }
 
+SubjectPostingList* EducationSector::getOrCreateSubjectList(const string& subject) {
+    SubjectPostingList* list = (SubjectPostingList*)subjectTable->search(subject);
+    if (list != nullptr) {
+        return list;
+    }
+    
+    if (subjectListCount >= subjectListCapacity) {
+        int newCapacity = subjectListCapacity * 2;
+        SubjectPostingList** newLists = new SubjectPostingList*[newCapacity];
+        for (int i = 0; i < subjectListCount; i++) {
+            newLists[i] = subjectLists[i];
+        }
+        delete[] subjectLists;
+        subjectLists = newLists;
+        subjectListCapacity = newCapacity;
+    }
+    
+    list = new SubjectPostingList(subject);
+    subjectLists[subjectListCount++] = list;
+    subjectTable->insert(subject, list);
+    return list;
+}
+
+School** EducationSector::copyPrefix(School** schools, int available, int k, int& count) {
+    count = 0;
+    if (available <= 0 || k <= 0) {
+        return nullptr;
+    }
+    
+    count = (k < available) ? k : available;
+    School** result = new School*[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = schools[i];
+    }
+    return result;
+}
+
 void EducationSector::parseSubjects(const string& subjectsStr, string*& subjects, int& count) {
     if (subjectsStr.empty()) {
         subjects = nullptr;
@@ -199,6 +266,12 @@ bool EducationSector::registerSchool(const string& schoolID, const string& name,
         return false; // Maximum schools reached
     }
     
+    // Locate the sector (an unknown sector would put the school at the city center)
+    double lat, lon;
+    if (!getSectorCoordinates(sector, lat, lon)) {
+        return false; // Unknown sector
+    }
+    
     // Create new school
     School* school = new School(schoolID, name, sector, rating);
     
@@ -217,17 +290,30 @@ bool EducationSector::registerSchool(const string& schoolID, const string& name,
     // Add to HashTable
     schoolTable->insert(schoolID, school);
     
-    // Add to ranking (use inverted priority: lower rating = higher priority in min-heap)
-    // For ranking, we want highest rating first, so use (10.0 - rating) as priority
-    double priority = 10.0 - rating; // Inverted so higher ratings come first when extracted
-    schoolRanking->insert(schoolID, priority, school);
+    // Add to rating index (best first)
+    int position = findRatingPosition(rankedSchools, schoolCount, rating);
+    for (int i = schoolCount; i > position; i--) {
+        rankedSchools[i] = rankedSchools[i - 1];
+    }
+    rankedSchools[position] = school;
+    
+    // Add to subject posting lists (a subject repeated in the list is indexed once)
+    string* schoolSubjects = school->getSubjects();
+    for (int i = 0; i < school->getSubjectCount(); i++) {
+        if (schoolSubjects[i].empty()) continue;
+        bool repeated = false;
+        for (int j = 0; j < i && !repeated; j++) {
+            repeated = (schoolSubjects[j] == schoolSubjects[i]);
+        }
+        if (!repeated) {
+            getOrCreateSubjectList(schoolSubjects[i])->insertByRating(school);
+        }
+    }
     
     // Add to school ID list for iteration
     schoolIDList[schoolCount] = schoolID;
     
     // Add school location to Graph for nearest school lookup
-    double lat, lon;
-    getSectorCoordinates(sector, lat, lon);
     locationGraph->addVertex(schoolID, name, lat, lon, school);
     
     // Connect school to nearest bus stop for pathfinding
@@ -282,17 +368,11 @@ School* EducationSector::searchSchool(const string& schoolID) {
 
 School** EducationSector::findSchoolsBySubject(const string& subject, int& count) {
     count = 0;
-    School** result = new School*[maxSchools];
-    
-    // Iterate through all registered schools using ID list
-    for (int i = 0; i < schoolCount; i++) {
-        School* school = (School*)schoolTable->search(schoolIDList[i]);
-        if (school != nullptr && school->offersSubject(subject)) {
-            result[count++] = school;
-        }
+    SubjectPostingList* list = (SubjectPostingList*)subjectTable->search(subject);
+    if (list == nullptr) {
+        return nullptr;
     }
-    
-    return result;
+    return copyPrefix(list->schools, list->count, list->count, count);
 }
 
 School** EducationSector::getTopRankedSchools(int topN, int& count) {
@@ -302,42 +382,21 @@ School** EducationSector::getTopRankedSchools(int topN, int& count) {
         return nullptr; // Invalid input: topN must be positive
     }
     
-    if (schoolCount == 0 || schoolRanking->isEmpty()) {
-        return nullptr; // No schools available
-    }
-    
-    // Bound topN to available schools
-    if (topN > schoolCount) {
-        topN = schoolCount; // Limit to available schools
-    }
-    
-    // Use MinHeap properly: Extract top N schools from the priority queue
-    School** result = new School*[topN];
-    
-    // Temporary storage to rebuild heap after extraction
-    HeapNode* extractedNodes = new HeapNode[schoolRanking->getSize()];
-    int extractedCount = 0;
-    
-    // Extract top N schools from MinHeap
-    while (!schoolRanking->isEmpty() && count < topN) {
-        HeapNode node = schoolRanking->extractMin();
-        if (!node.identifier.empty() && node.data != nullptr) {
-            result[count++] = (School*)node.data;
-            extractedNodes[extractedCount++] = node;
-        }
+    // NOTE: Caller is responsible for deleting[] the returned array
+    return copyPrefix(rankedSchools, schoolCount, topN, count);
+}
+
+School** EducationSector::getTopSchoolsBySubject(const string& subject, int topN, int& count) {
+    count = 0;
+    if (topN <= 0) {
+        return nullptr;
     }
     
-    // Rebuild the heap by reinserting all extracted elements
-    for (int i = 0; i < extractedCount; i++) {
-        schoolRanking->insert(extractedNodes[i].identifier, 
-                             extractedNodes[i].priority, 
-                             extractedNodes[i].data);
+    SubjectPostingList* list = (SubjectPostingList*)subjectTable->search(subject);
+    if (list == nullptr) {
+        return nullptr;
     }
-    
-    delete[] extractedNodes;
-    
-    // NOTE: Caller is responsible for deleting[] the returned array
-    return result;
+    return copyPrefix(list->schools, list->count, topN, count);
 }
 
 // Helper function to calculate simple squared distance (Euclidean, no sqrt needed for comparison)
@@ -362,7 +421,7 @@ string EducationSector::findNearestSchool(double latitude, double longitude) {
         
         // Get school coordinates from its sector
         double schoolLat, schoolLon;
-        getSectorCoordinates(school->getSector(), schoolLat, schoolLon);
+        if (!getSectorCoordinates(school->getSector(), schoolLat, schoolLon)) continue;
         
         // Calculate squared distance (no sqrt needed for comparison)
         double distSquared = calculateDistanceSquared(latitude, longitude, schoolLat, schoolLon);
@@ -466,6 +525,47 @@ void EducationSector::displayAllSchools() {
     }
 }
 
+void EducationSector::displayOrganogramSummary() {
+    cout << "\n=== Organogram Summary (" << schoolCount << " schools) ===" << endl;
+    
+    if (schoolCount == 0) {
+        cout << "No schools registered." << endl;
+        return;
+    }
+    
+    int totalNodes = 0;
+    int deepestLevel = 0;
+    for (int i = 0; i < schoolCount; i++) {
+        School* school = (School*)schoolTable->search(schoolIDList[i]);
+        if (school == nullptr || school->getHierarchyTree() == nullptr) continue;
+        
+        // Level 0 is the school, 1 departments, 2 classes/faculty, 3 students
+        const FrozenTree* snapshot = school->getHierarchyTree()->freeze();
+        int levels = 0;
+        int* levelCounts = snapshot->getLevelCounts(levels);
+        int departments = (levels > 1) ? levelCounts[1] : 0;
+        int units = (levels > 2) ? levelCounts[2] : 0;
+        int members = 0;
+        for (int level = 3; level < levels; level++) {
+            members += levelCounts[level];
+        }
+        if (levelCounts != nullptr) {
+            delete[] levelCounts;
+        }
+        
+        cout << school->getSchoolID() << " (" << school->getName() << "): "
+             << departments << " department(s), " << units << " class/faculty node(s), "
+             << members << " student(s), depth " << snapshot->getHeight() << endl;
+        
+        totalNodes += snapshot->getNodeCount();
+        if (snapshot->getHeight() > deepestLevel) {
+            deepestLevel = snapshot->getHeight();
+        }
+    }
+    
+    cout << "Total organogram nodes: " << totalNodes << ", deepest organogram: " << deepestLevel << endl;
+}
+
 int EducationSector::getSchoolCount() const {
     return schoolCount;
 }
@@ -4,18 +4,37 @@
 #include <string>
 #include "core_classes/HashTable.h"
 #include "core_classes/Tree.h"
-#include "core_classes/MinHeap.h"
 #include "core_classes/Graph.h"
 #include "School.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/SectorGazetteer.h"
 using namespace std;
 
+// Structure for the schools offering one subject, kept sorted by rating (best first)
+struct SubjectPostingList {
+    string subject;           // Subject as written in the data (e.g., "Physics")
+    School** schools;         // Schools offering the subject (not owned)
+    int count;                // Number of schools in the list
+    int capacity;             // Allocated size of schools array
+    
+    SubjectPostingList(const string& s);
+    ~SubjectPostingList();
+    
+    // Insert a school after every school rated at least as high
+    // Complexity: O(log n + n) - binary search, then shift
+    void insertByRating(School* school);
+};
+
 // Education Sector Manager Class
 // Manages schools, their hierarchy, ranking, and search operations
 class EducationSector {
 private:
     HashTable* schoolTable;        // HashTable for SchoolID → School* lookup
-    MinHeap* schoolRanking;        // Priority Queue for school ranking by rating
+    School** rankedSchools;        // All schools sorted by rating (best first, ties in registration order)
+    HashTable* subjectTable;       // HashTable for Subject → SubjectPostingList* lookup
+    SubjectPostingList** subjectLists; // Owned posting lists (for cleanup)
+    int subjectListCount;
+    int subjectListCapacity;
     Graph* locationGraph;          // Graph for nearest school queries
     bool ownsLocationGraph;        // Flag to track if we own the graph (for shared graph support)
     string* schoolIDList;     // List of all school IDs for iteration
@@ -25,6 +44,13 @@ private:
     // Helper: Parse subjects from comma-separated string
     void parseSubjects(const string& subjectsStr, string*& subjects, int& count);
     
+    // Helper: Get the posting list for a subject, creating it if new
+    SubjectPostingList* getOrCreateSubjectList(const string& subject);
+    
+    // Helper: Copy the first k schools of a best-first array
+    // Returns: New array (caller must delete[]), or nullptr if empty
+    static School** copyPrefix(School** schools, int available, int k, int& count);
+    
 public:
     // Constructor
     EducationSector(int maxSchools = 100, int hashTableSize = 11);
@@ -33,7 +59,7 @@ public:
     ~EducationSector();
     
     // Register a new school
-    // Returns: true if successful, false if school already exists
+    // Returns: true if successful, false if school already exists or the sector is unknown
     bool registerSchool(const string& schoolID, const string& name, 
                        const string& sector, double rating, const string& subjectsStr);
     
@@ -46,13 +72,22 @@ public:
     School* searchSchool(const string& schoolID);
     
     // Search schools offering a specific subject
-    // Returns: Array of School pointers, and count
+    // Returns: Array of School pointers sorted by rating (best first, caller must delete[]),
+    //          and count; nullptr if no school offers the subject
+    // Complexity: O(1) average lookup + O(p) copy where p is the posting list size
     School** findSchoolsBySubject(const string& subject, int& count);
     
     // Get top-ranked schools (by rating)
-    // Returns: Array of School pointers sorted by rating (best first)
+    // Returns: Array of School pointers sorted by rating (best first, caller must delete[])
+    // Complexity: O(k) - read-only copy of the rating index
     School** getTopRankedSchools(int topN, int& count);
     
+    // Get top-ranked schools offering a specific subject
+    // Returns: Array of School pointers sorted by rating (best first, caller must delete[]),
+    //          and count; nullptr if no school offers the subject
+    // Complexity: O(1) average lookup + O(k) - read-only copy of the posting list prefix
+    School** getTopSchoolsBySubject(const string& subject, int topN, int& count);
+    
     // Find nearest school to given location (using Graph)
     // Returns: SchoolID of nearest school, or empty string if not found
     string findNearestSchool(double latitude, double longitude);
@@ -82,6 +117,10 @@ public:
     // Display all schools
     void displayAllSchools();
     
+    // Display organogram totals for every school (departments, classes, members, depth)
+    // Complexity: O(N) over all tree nodes, using each tree's frozen snapshot
+    void displayOrganogramSummary();
+    
     // Get number of registered schools
     int getSchoolCount() const;
     
@@ -4,34 +4,189 @@
 #include <sstream>
 using namespace std;
 
-const double M_PI = 3.14159265358979323846;
+// Cost used for vehicle/emergency pairs with no route between them
+const double UNREACHABLE_COST = 1.0e9;
 
-// Helper function to calculate distance between two coordinates (Haversine formula)
-static double calculateDistance(double lat1, double lon1, double lat2, double lon2) {
-    const double R = 6371.0; // Earth radius in kilometers
+// Helper function to map an emergency type to the vehicle type that serves it
+static string vehicleTypeForEmergency(const string& emergencyType) {
+    if (emergencyType == "Fire") return "FireTruck";
+    if (emergencyType == "Police") return "Police";
+    return "Ambulance"; // Default for medical emergencies
+}
+
+// Helper function to solve a min-cost assignment (Hungarian algorithm, O(n^2 * m))
+// Parameters: cost matrix (rows x cols, row-major), rows, cols,
+//             rowAssignment (output, column for each row or -1 if the row got none)
+// When rows > cols the problem is solved on the transpose, so every column is used
+static void solveAssignment(const double* cost, int rows, int cols, int* rowAssignment) {
+    for (int r = 0; r < rows; r++) {
+        rowAssignment[r] = -1;
+    }
+    if (rows == 0 || cols == 0) return;
+    
+    bool transposed = rows > cols;
+    int n = transposed ? cols : rows; // Side that is fully assigned
+    int m = transposed ? rows : cols;
+    
+    // Potentials and matching are 1-indexed; index 0 is the virtual start column
+    double* u = new double[n + 1];
+    double* v = new double[m + 1];
+    double* minv = new double[m + 1];
+    int* match = new int[m + 1];      // match[j] = row matched to column j (0 if none)
+    int* way = new int[m + 1];
+    bool* used = new bool[m + 1];
+    for (int i = 0; i <= n; i++) u[i] = 0.0;
+    for (int j = 0; j <= m; j++) {
+        v[j] = 0.0;
+        match[j] = 0;
+        way[j] = 0;
+    }
+    
+    for (int i = 1; i <= n; i++) {
+        match[0] = i;
+        int j0 = 0;
+        for (int j = 0; j <= m; j++) {
+            minv[j] = UNREACHABLE_COST * 4.0;
+            used[j] = false;
+        }
+        
+        // Grow an alternating tree until a free column is reached
+        do {
+            used[j0] = true;
+            int i0 = match[j0];
+            double delta = UNREACHABLE_COST * 4.0;
+            int j1 = 0;
+            for (int j = 1; j <= m; j++) {
+                if (used[j]) continue;
+                double c = transposed ? cost[(j - 1) * cols + (i0 - 1)] : cost[(i0 - 1) * cols + (j - 1)];
+                double reduced = c - u[i0] - v[j];
+                if (reduced < minv[j]) {
+                    minv[j] = reduced;
+                    way[j] = j0;
+                }
+                if (minv[j] < delta) {
+                    delta = minv[j];
+                    j1 = j;
+                }
+            }
+            for (int j = 0; j <= m; j++) {
+                if (used[j]) {
+                    u[match[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    minv[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (match[j0] != 0);
+        
+        // Flip the augmenting path
+        do {
+            int j1 = way[j0];
+            match[j0] = match[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+    
+    for (int j = 1; j <= m; j++) {
+        if (match[j] == 0) continue;
+        if (transposed) {
+            rowAssignment[j - 1] = match[j] - 1;
+        } else {
+            rowAssignment[match[j] - 1] = j - 1;
+        }
+    }
+    
+    delete[] u;
+    delete[] v;
+    delete[] minv;
+    delete[] match;
+    delete[] way;
+    delete[] used;
+}
+
+// Helper function to append a vehicle to a pool array (grows the array when full)
+static void appendToPool(EmergencyVehicle**& pool, int& count, int& capacity, EmergencyVehicle* vehicle) {
+    if (count >= capacity) {
+        int newCapacity = capacity * 2;
+        EmergencyVehicle** newPool = new EmergencyVehicle*[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newPool[i] = pool[i];
+        }
+        delete[] pool;
+        pool = newPool;
+        capacity = newCapacity;
+    }
     
-    double dLat = (lat2 - lat1) * M_PI / 180.0;
-    double dLon = (lon2 - lon1) * M_PI / 180.0;
+    pool[count] = vehicle;
+    vehicle->setPoolIndex(count);
+    count++;
+}
+
+// Helper function to remove a vehicle from a pool array (last element fills the gap)
+static bool removeFromPool(EmergencyVehicle** pool, int& count, EmergencyVehicle* vehicle) {
+    int index = vehicle->getPoolIndex();
+    if (index < 0 || index >= count || pool[index] != vehicle) return false;
+    
+    pool[index] = pool[count - 1];
+    pool[index]->setPoolIndex(index);
+    count--;
+    vehicle->setPoolIndex(-1);
+    return true;
+}
+
+// VehiclePool Implementation
+VehiclePool::VehiclePool(const string& type)
+    : vehicleType(type), availableCount(0), availableCapacity(8), busyCount(0), busyCapacity(8) {
+    available = new EmergencyVehicle*[availableCapacity];
+    busy = new EmergencyVehicle*[busyCapacity];
+}
+
+VehiclePool::~VehiclePool() {
+    // Vehicles are owned by EmergencyManager, only the pool arrays are freed here
+    delete[] available;
+    delete[] busy;
+    available = nullptr;
+    busy = nullptr;
+}
+
+void VehiclePool::addVehicle(EmergencyVehicle* vehicle) {
+    if (vehicle == nullptr) return;
     
-    double a = sin(dLat / 2.0) * sin(dLat / 2.0) +
-               cos(lat1 * M_PI / 180.0) * cos(lat2 * M_PI / 180.0) *
-               sin(dLon / 2.0) * sin(dLon / 2.0);
+    if (vehicle->getIsAvailable()) {
+        appendToPool(available, availableCount, availableCapacity, vehicle);
+    } else {
+        appendToPool(busy, busyCount, busyCapacity, vehicle);
+    }
+}
+
+bool VehiclePool::markBusy(EmergencyVehicle* vehicle) {
+    if (vehicle == nullptr) return false;
+    if (!removeFromPool(available, availableCount, vehicle)) return false;
     
-    double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-    double distance = R * c;
+    appendToPool(busy, busyCount, busyCapacity, vehicle);
+    return true;
+}
+
+bool VehiclePool::markAvailable(EmergencyVehicle* vehicle) {
+    if (vehicle == nullptr) return false;
+    if (!removeFromPool(busy, busyCount, vehicle)) return false;
     
-    return distance;
+    appendToPool(available, availableCount, availableCapacity, vehicle);
+    return true;
 }
 
 // Constructor
 EmergencyManager::EmergencyManager(Graph* graph, MedicalSector* medical)
-    : cityGraph(graph), medicalSector(medical), vehicleCount(0), emergencyCounter(1) {
+    : cityGraph(graph), medicalSector(medical), vehicleCount(0), availableVehicleCount(0), emergencyCounter(1) {
     // Initialize hash tables with reasonable sizes (prime numbers)
     vehiclesByID = new HashTable(101);
     vehiclesByType = new HashTable(31); // Smaller size for types (fewer types than vehicles)
     activeEmergencies = new HashTable(101);
+    allEmergenciesList = new SinglyLinkedList();
     emergencyQueue = new MinHeap(100); // Priority queue for up to 100 emergencies
     allVehiclesList = new SinglyLinkedList();
+    vehicleTypesList = new SinglyLinkedList();
 }
 
 // Destructor
@@ -51,6 +206,10 @@ EmergencyManager::~EmergencyManager() {
         delete activeEmergencies;
         activeEmergencies = nullptr;
     }
+    if (allEmergenciesList != nullptr) {
+        delete allEmergenciesList;
+        allEmergenciesList = nullptr;
+    }
     if (emergencyQueue != nullptr) {
         delete emergencyQueue;
         emergencyQueue = nullptr;
@@ -59,6 +218,10 @@ EmergencyManager::~EmergencyManager() {
         delete allVehiclesList;
         allVehiclesList = nullptr;
     }
+    if (vehicleTypesList != nullptr) {
+        delete vehicleTypesList;
+        vehicleTypesList = nullptr;
+    }
 }
 
 // Set the city graph
@@ -111,36 +274,45 @@ void EmergencyManager::getAvailableVehicles(const string& vehicleType, Emergency
     count = 0;
     if (vehicles == nullptr || vehicleType.empty()) return;
     
-    // Get all vehicles
-    EmergencyVehicle** allVehicles = new EmergencyVehicle*[vehicleCount];
-    int allCount = 0;
-    getAllVehicles(allVehicles, allCount);
+    // Only the idle pool of this type is touched
+    VehiclePool* pool = findVehiclePool(vehicleType);
+    if (pool == nullptr) return;
     
-    // Filter by type and availability
-    for (int i = 0; i < allCount; i++) {
-        if (allVehicles[i]->getVehicleType() == vehicleType && allVehicles[i]->getIsAvailable()) {
-            vehicles[count] = allVehicles[i];
-            count++;
-        }
+    for (int i = 0; i < pool->availableCount; i++) {
+        vehicles[count] = pool->available[i];
+        count++;
     }
-    
-    delete[] allVehicles;
 }
 
-// Helper function to calculate distance between two locations
-double EmergencyManager::calculateRouteDistance(const string& fromLocation, const string& toLocation) {
-    if (fromLocation.empty() || toLocation.empty() || cityGraph == nullptr) return -1.0;
+// Helper function to get the pool for a vehicle type
+VehiclePool* EmergencyManager::findVehiclePool(const string& vehicleType) const {
+    if (vehicleType.empty()) return nullptr;
     
-    int pathLength = 0;
-    double distance = 0.0;
-    string* path = cityGraph->findShortestPath(fromLocation, toLocation, pathLength, distance);
+    void* data = vehiclesByType->search(vehicleType);
+    if (data != nullptr) {
+        return (VehiclePool*)data;
+    }
+    return nullptr;
+}
+
+// Helper function to move a vehicle into its type's busy pool
+void EmergencyManager::markVehicleBusy(EmergencyVehicle* vehicle) {
+    if (vehicle == nullptr) return;
     
-    if (path != nullptr) {
-        delete[] path;
-        return distance;
+    VehiclePool* pool = findVehiclePool(vehicle->getVehicleType());
+    if (pool != nullptr && pool->markBusy(vehicle)) {
+        availableVehicleCount--;
     }
+}
+
+// Helper function to move a vehicle back into its type's available pool
+void EmergencyManager::markVehicleAvailable(EmergencyVehicle* vehicle) {
+    if (vehicle == nullptr) return;
     
-    return -1.0;
+    VehiclePool* pool = findVehiclePool(vehicle->getVehicleType());
+    if (pool != nullptr && pool->markAvailable(vehicle)) {
+        availableVehicleCount++;
+    }
 }
 
 // Helper function to calculate complete distance from coordinates to coordinates
@@ -155,7 +327,7 @@ double EmergencyManager::calculateCompleteRouteDistance(double sourceLat, double
     //Calculate distance from source coordinates to source stop (straight-line)
     double sourceStopLat, sourceStopLon;
     if (!cityGraph->getVertexCoordinates(sourceStopID, sourceStopLat, sourceStopLon)) return -1.0;
-    double walkToSourceStop = calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
+    double walkToSourceStop = Graph::calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
     double totalDistance = walkToSourceStop;
     
     //Find nearest stop to destination coordinates
@@ -173,7 +345,7 @@ double EmergencyManager::calculateCompleteRouteDistance(double sourceLat, double
     //Calculate distance from destination stop to destination coordinates (straight-line)
     double destStopLat, destStopLon;
     if (!cityGraph->getVertexCoordinates(destStopID, destStopLat, destStopLon)) return -1.0;
-    double walkFromDestStop = calculateDistance(destStopLat, destStopLon, destLat, destLon);
+    double walkFromDestStop = Graph::calculateDistance(destStopLat, destStopLon, destLat, destLon);
     totalDistance += walkFromDestStop;
     
     return totalDistance;
@@ -203,7 +375,18 @@ bool EmergencyManager::addVehicle(EmergencyVehicle* vehicle) {
     
     // Add to hash tables
     vehiclesByID->insert(vehicle->getVehicleID(), (void*)vehicle);
-    vehiclesByType->insert(vehicle->getVehicleType(), (void*)vehicle);
+    
+    // Add to the pool for its type (one pool per type, created on first use)
+    VehiclePool* pool = findVehiclePool(vehicle->getVehicleType());
+    if (pool == nullptr) {
+        pool = new VehiclePool(vehicle->getVehicleType());
+        vehiclesByType->insert(vehicle->getVehicleType(), (void*)pool);
+        vehicleTypesList->insertAtTail(vehicle->getVehicleType());
+    }
+    pool->addVehicle(vehicle);
+    if (vehicle->getIsAvailable()) {
+        availableVehicleCount++;
+    }
     
     // Add vehicle ID to list for iteration
     allVehiclesList->insertAtTail(vehicle->getVehicleID());
@@ -223,39 +406,42 @@ EmergencyVehicle* EmergencyManager::findVehicleByID(const string& vehicleID) con
     return nullptr;
 }
 
-// Find nearest available vehicle of a specific type
-EmergencyVehicle* EmergencyManager::findNearestAvailableVehicle(const string& vehicleType, const string& fromLocation) {
-    if (vehicleType.empty() || fromLocation.empty() || cityGraph == nullptr) return nullptr;
-    
-    // Get all available vehicles of this type
-    EmergencyVehicle** availableVehicles = new EmergencyVehicle*[vehicleCount];
-    int count = 0;
-    getAvailableVehicles(vehicleType, availableVehicles, count);
+// Find the k nearest available vehicles of a specific type
+int EmergencyManager::findNearestAvailableVehicles(const string& vehicleType, const string& fromLocation,
+                                                   EmergencyVehicle** vehicles, double* distances, int k) {
+    if (vehicleType.empty() || fromLocation.empty() || cityGraph == nullptr) return 0;
+    if (vehicles == nullptr || distances == nullptr || k <= 0) return 0;
+    
+    // Only idle vehicles of this type are candidates
+    VehiclePool* pool = findVehiclePool(vehicleType);
+    if (pool == nullptr || pool->availableCount == 0) return 0;
+    int count = pool->availableCount;
+    
+    // Candidate stops, in pool order (vehicles without a stop cannot be routed and are skipped by the search)
+    string* vehicleStops = new string[count];
+    for (int i = 0; i < count; i++) {
+        vehicleStops[i] = pool->available[i]->getCurrentStopID();
+    }
     
-    if (count == 0) {
-        delete[] availableVehicles;
-        return nullptr;
+    // One search from the emergency location, stopping at the k-th idle vehicle it reaches
+    int* foundIndices = new int[k];
+    int found = cityGraph->findNearestTargets(fromLocation, vehicleStops, count, k, foundIndices, distances);
+    for (int i = 0; i < found; i++) {
+        vehicles[i] = pool->available[foundIndices[i]];
     }
     
-    // Find nearest vehicle
+    delete[] foundIndices;
+    delete[] vehicleStops;
+    return found;
+}
+
+// Find nearest available vehicle of a specific type
+EmergencyVehicle* EmergencyManager::findNearestAvailableVehicle(const string& vehicleType, const string& fromLocation) {
     EmergencyVehicle* nearestVehicle = nullptr;
-    double minDistance = -1.0;
-    
-    for (int i = 0; i < count; i++) {
-        string vehicleLocation = availableVehicles[i]->getCurrentStopID();
-        if (vehicleLocation.empty()) continue;
-        
-        // Calculate distance
-        double distance = calculateRouteDistance(fromLocation, vehicleLocation);
-        if (distance >= 0.0) {
-            if (minDistance < 0.0 || distance < minDistance) {
-                minDistance = distance;
-                nearestVehicle = availableVehicles[i];
-            }
-        }
+    double distance = 0.0;
+    if (findNearestAvailableVehicles(vehicleType, fromLocation, &nearestVehicle, &distance, 1) == 0) {
+        return nullptr;
     }
-    
-    delete[] availableVehicles;
     return nearestVehicle;
 }
 
@@ -263,41 +449,12 @@ EmergencyVehicle* EmergencyManager::findNearestAvailableVehicle(const string& ve
 EmergencyVehicle* EmergencyManager::findNearestAvailableVehicle(const string& vehicleType, double latitude, double longitude) {
     if (cityGraph == nullptr) return nullptr;
     
-    // Get all available vehicles of this type
-    EmergencyVehicle** availableVehicles = new EmergencyVehicle*[vehicleCount];
-    int count = 0;
-    getAvailableVehicles(vehicleType, availableVehicles, count);
-    
-    if (count == 0) {
-        delete[] availableVehicles;
-        return nullptr;
-    }
-    
-    // Find nearest vehicle using complete distance calculation
-    EmergencyVehicle* nearestVehicle = nullptr;
-    double minDistance = -1.0;
+    // The walk from the coordinates to their nearest stop is the same for every vehicle,
+    // so ranking by graph distance from that stop gives the same order as the complete distance
+    string sourceStopID = cityGraph->findNearestStop(latitude, longitude);
+    if (sourceStopID.empty()) return nullptr;
     
-    for (int i = 0; i < count; i++) {
-        string vehicleLocation = availableVehicles[i]->getCurrentStopID();
-        // Vehicle must have a current stop for navigation
-        if (vehicleLocation.empty()) continue;
-        
-        // Get vehicle location coordinates
-        double vehicleLat, vehicleLon;
-        if (!cityGraph->getVertexCoordinates(vehicleLocation, vehicleLat, vehicleLon)) continue;
-        
-        // Calculate complete distance: source coords -> source stop -> vehicle stop -> vehicle coords
-        double distance = calculateCompleteRouteDistanceToVertex(latitude, longitude, vehicleLocation);
-        if (distance >= 0.0) {
-            if (minDistance < 0.0 || distance < minDistance) {
-                minDistance = distance;
-                nearestVehicle = availableVehicles[i];
-            }
-        }
-    }
-    
-    delete[] availableVehicles;
-    return nearestVehicle;
+    return findNearestAvailableVehicle(vehicleType, sourceStopID);
 }
 
 // Get number of vehicles
@@ -307,19 +464,12 @@ int EmergencyManager::getVehicleCount() const {
 
 // Get number of available vehicles
 int EmergencyManager::getAvailableVehicleCount() const {
-    EmergencyVehicle** allVehicles = new EmergencyVehicle*[vehicleCount];
-    int count = 0;
-    getAllVehicles(allVehicles, count);
-    
-    int availableCount = 0;
-    for (int i = 0; i < count; i++) {
-        if (allVehicles[i]->getIsAvailable()) {
-            availableCount++;
-        }
-    }
-    
-    delete[] allVehicles;
-    return availableCount;
+    return availableVehicleCount;
+}
+
+int EmergencyManager::getAvailableVehicleCount(const string& vehicleType) const {
+    VehiclePool* pool = findVehiclePool(vehicleType);
+    return (pool != nullptr) ? pool->availableCount : 0;
 }
 
 // Display all vehicles
@@ -407,6 +557,7 @@ string EmergencyManager::reportEmergency(const string& location, double lat, dou
     
     // Add to active emergencies
     activeEmergencies->insert(emergencyID, (void*)emergency);
+    allEmergenciesList->insertAtTail(emergencyID);
     
     // Add to priority queue (lower priority number = higher priority in min-heap)
     emergencyQueue->insert(emergencyID, (double)priority, emergency);
@@ -427,9 +578,7 @@ EmergencyRoute* EmergencyManager::dispatchToEmergency(const string& emergencyID)
     if (!emergency->isActive) return nullptr; // Emergency already completed
     
     // Find nearest available vehicle
-    string vehicleType = "Ambulance"; // Default for medical emergencies
-    if (emergency->emergencyType == "Fire") vehicleType = "FireTruck";
-    else if (emergency->emergencyType == "Police") vehicleType = "Police";
+    string vehicleType = vehicleTypeForEmergency(emergency->emergencyType);
     
     EmergencyVehicle* vehicle = nullptr;
     if (cityGraph != nullptr && !emergency->location.empty()) {
@@ -443,6 +592,13 @@ EmergencyRoute* EmergencyManager::dispatchToEmergency(const string& emergencyID)
     
     if (vehicle == nullptr) return nullptr; // No available vehicle
     
+    return assignVehicleToEmergency(emergency, vehicle);
+}
+
+// Helper function to pick a hospital, build the route and dispatch a chosen vehicle
+EmergencyRoute* EmergencyManager::assignVehicleToEmergency(Emergency* emergency, EmergencyVehicle* vehicle) {
+    if (emergency == nullptr || vehicle == nullptr) return nullptr;
+    
     // Find best hospital (for medical emergencies)
     string hospitalID = "";
     if (emergency->emergencyType == "Medical" && medicalSector != nullptr) {
@@ -455,15 +611,171 @@ EmergencyRoute* EmergencyManager::dispatchToEmergency(const string& emergencyID)
     // Calculate route
     EmergencyRoute* route = calculateEmergencyRoute(vehicle->getVehicleID(), emergency->location, hospitalID);
     if (route == nullptr) return nullptr;
+    route->emergencyID = emergency->emergencyID;
     
     // Dispatch vehicle
-    vehicle->dispatchToEmergency(emergencyID);
+    if (vehicle->dispatchToEmergency(emergency->emergencyID)) {
+        markVehicleBusy(vehicle);
+    }
     emergency->assignedVehicleID = vehicle->getVehicleID();
     emergency->assignedHospitalID = hospitalID;
     
     return route;
 }
 
+// Dispatch vehicles to every pending emergency at once
+EmergencyRoute** EmergencyManager::dispatchAllPending(int& routeCount) {
+    routeCount = 0;
+    if (cityGraph == nullptr || emergencyQueue == nullptr || emergencyQueue->isEmpty()) return nullptr;
+    
+    // Drain the queue, keeping emergencies that are still active and have no vehicle yet
+    int queuedCount = emergencyQueue->getSize();
+    Emergency** pending = new Emergency*[queuedCount];
+    int pendingCount = 0;
+    while (!emergencyQueue->isEmpty()) {
+        HeapNode node = emergencyQueue->extractMin();
+        Emergency* emergency = (Emergency*)node.data;
+        if (emergency != nullptr && emergency->isActive && emergency->assignedVehicleID.empty()) {
+            pending[pendingCount] = emergency;
+            pendingCount++;
+        }
+    }
+    
+    EmergencyRoute** routes = nullptr;
+    if (pendingCount > 0) {
+        routes = new EmergencyRoute*[pendingCount];
+        
+        // Vehicle types are independent assignment problems
+        bool* grouped = new bool[pendingCount];
+        Emergency** groupEmergencies = new Emergency*[pendingCount];
+        for (int i = 0; i < pendingCount; i++) {
+            grouped[i] = false;
+        }
+        
+        for (int i = 0; i < pendingCount; i++) {
+            if (grouped[i]) continue;
+            string vehicleType = vehicleTypeForEmergency(pending[i]->emergencyType);
+            
+            int groupCount = 0;
+            for (int j = i; j < pendingCount; j++) {
+                if (!grouped[j] && vehicleTypeForEmergency(pending[j]->emergencyType) == vehicleType) {
+                    groupEmergencies[groupCount] = pending[j];
+                    groupCount++;
+                    grouped[j] = true;
+                }
+            }
+            
+            dispatchBatchForType(vehicleType, groupEmergencies, groupCount, routes, routeCount);
+        }
+        
+        delete[] grouped;
+        delete[] groupEmergencies;
+    }
+    
+    // Emergencies that could not be served stay queued for the next round
+    for (int i = 0; i < pendingCount; i++) {
+        if (pending[i]->assignedVehicleID.empty()) {
+            emergencyQueue->insert(pending[i]->emergencyID, (double)pending[i]->priority, pending[i]);
+        }
+    }
+    delete[] pending;
+    
+    if (routeCount == 0 && routes != nullptr) {
+        delete[] routes;
+        routes = nullptr;
+    }
+    return routes;
+}
+
+// Helper function to solve the batch assignment for emergencies served by one vehicle type
+void EmergencyManager::dispatchBatchForType(const string& vehicleType, Emergency** emergencies, int emergencyCount,
+                                            EmergencyRoute** routes, int& routeCount) {
+    VehiclePool* pool = findVehiclePool(vehicleType);
+    if (pool == nullptr || pool->availableCount == 0 || emergencyCount == 0) return;
+    
+    // Snapshot the idle pool (dispatching reorders it)
+    int vehicleTotal = pool->availableCount;
+    EmergencyVehicle** vehicles = new EmergencyVehicle*[vehicleTotal];
+    string* vehicleStops = new string[vehicleTotal];
+    for (int i = 0; i < vehicleTotal; i++) {
+        vehicles[i] = pool->available[i];
+        vehicleStops[i] = vehicles[i]->getCurrentStopID();
+    }
+    
+    // Cost matrix: one bounded search per emergency reaches every idle vehicle of this type
+    double* cost = new double[emergencyCount * vehicleTotal];
+    int* foundIndices = new int[vehicleTotal];
+    double* foundDistances = new double[vehicleTotal];
+    for (int e = 0; e < emergencyCount; e++) {
+        for (int i = 0; i < vehicleTotal; i++) {
+            cost[e * vehicleTotal + i] = UNREACHABLE_COST;
+        }
+        int found = cityGraph->findNearestTargets(emergencies[e]->location, vehicleStops, vehicleTotal,
+                                                  vehicleTotal, foundIndices, foundDistances);
+        for (int f = 0; f < found; f++) {
+            cost[e * vehicleTotal + foundIndices[f]] = foundDistances[f];
+        }
+    }
+    
+    // Priority tiers are solved in order, so a lower tier never takes a vehicle a higher tier could use
+    bool* vehicleTaken = new bool[vehicleTotal];
+    for (int i = 0; i < vehicleTotal; i++) {
+        vehicleTaken[i] = false;
+    }
+    int* rows = new int[emergencyCount];
+    int* cols = new int[vehicleTotal];
+    int* assignment = new int[emergencyCount];
+    double* tierCost = new double[emergencyCount * vehicleTotal];
+    
+    for (int tier = 1; tier <= 3; tier++) {
+        int rowCount = 0;
+        for (int e = 0; e < emergencyCount; e++) {
+            if (emergencies[e]->priority == tier) {
+                rows[rowCount] = e;
+                rowCount++;
+            }
+        }
+        int colCount = 0;
+        for (int i = 0; i < vehicleTotal; i++) {
+            if (!vehicleTaken[i]) {
+                cols[colCount] = i;
+                colCount++;
+            }
+        }
+        if (rowCount == 0 || colCount == 0) continue;
+        
+        for (int r = 0; r < rowCount; r++) {
+            for (int c = 0; c < colCount; c++) {
+                tierCost[r * colCount + c] = cost[rows[r] * vehicleTotal + cols[c]];
+            }
+        }
+        solveAssignment(tierCost, rowCount, colCount, assignment);
+        
+        for (int r = 0; r < rowCount; r++) {
+            int c = assignment[r];
+            if (c < 0 || tierCost[r * colCount + c] >= UNREACHABLE_COST) continue;
+            
+            EmergencyRoute* route = assignVehicleToEmergency(emergencies[rows[r]], vehicles[cols[c]]);
+            if (route != nullptr) {
+                routes[routeCount] = route;
+                routeCount++;
+                vehicleTaken[cols[c]] = true;
+            }
+        }
+    }
+    
+    delete[] vehicles;
+    delete[] vehicleStops;
+    delete[] cost;
+    delete[] foundIndices;
+    delete[] foundDistances;
+    delete[] vehicleTaken;
+    delete[] rows;
+    delete[] cols;
+    delete[] assignment;
+    delete[] tierCost;
+}
+
 // Complete an emergency
 bool EmergencyManager::completeEmergency(const string& emergencyID) {
     if (emergencyID.empty()) return false;
@@ -479,8 +791,8 @@ bool EmergencyManager::completeEmergency(const string& emergencyID) {
     // Make vehicle available again
     if (!emergency->assignedVehicleID.empty()) {
         EmergencyVehicle* vehicle = findVehicleByID(emergency->assignedVehicleID);
-        if (vehicle != nullptr) {
-            vehicle->completeEmergency();
+        if (vehicle != nullptr && vehicle->completeEmergency()) {
+            markVehicleAvailable(vehicle);
         }
     }
     
@@ -514,6 +826,14 @@ Hospital* EmergencyManager::findBestHospital(const string& emergencyLocation, co
     
     // If specialization is required, try to find hospital with that specialization
     if (!requiredSpecialization.empty()) {
+        // Nearest specialized hospital with a free bed (only matching hospitals are measured)
+        Hospital* specWithBeds = medicalSector->findNearestHospitalWithSpecialization(requiredSpecialization,
+                                                                                    lat, lon, true);
+        if (specWithBeds != nullptr) {
+            return specWithBeds;
+        }
+        
+        // Fallback: every specialized hospital is full, so take the one closest by route
         int specCount = 0;
         Hospital** specHospitals = medicalSector->findHospitalsBySpecialization(requiredSpecialization, specCount);
         if (specHospitals != nullptr && specCount > 0) {
@@ -534,8 +854,9 @@ Hospital* EmergencyManager::findBestHospital(const string& emergencyLocation, co
             if (bestSpec != nullptr) {
                 return bestSpec;
             }
+        } else if (specHospitals != nullptr) {
+            delete[] specHospitals;
         }
-        if (specHospitals != nullptr) delete[] specHospitals;
     }
     
     if (mostBeds != nullptr) {
@@ -648,7 +969,9 @@ void EmergencyManager::clearAllEmergencies() {
     getAllVehicles(vehicles, count);
     
     for (int i = 0; i < count; i++) {
-        vehicles[i]->completeEmergency();
+        if (vehicles[i]->completeEmergency()) {
+            markVehicleAvailable(vehicles[i]);
+        }
     }
     
     delete[] vehicles;
@@ -659,6 +982,24 @@ void EmergencyManager::clearAllEmergencies() {
         emergencyQueue = new MinHeap(100);
     }
     
+    // Delete every emergency ever reported (completed ones stay in the table until now)
+    if (allEmergenciesList != nullptr && activeEmergencies != nullptr) {
+        int idCount = allEmergenciesList->getSize();
+        if (idCount > 0) {
+            string* emergencyIDs = new string[idCount];
+            int actualCount = 0;
+            allEmergenciesList->toArray(emergencyIDs, actualCount);
+            for (int i = 0; i < actualCount; i++) {
+                Emergency* emergency = (Emergency*)activeEmergencies->search(emergencyIDs[i]);
+                if (emergency != nullptr) {
+                    delete emergency;
+                }
+            }
+            delete[] emergencyIDs;
+        }
+        allEmergenciesList->clear();
+    }
+    
     if (activeEmergencies != nullptr) {
         activeEmergencies->clear();
     }
@@ -679,12 +1020,31 @@ void EmergencyManager::clear() {
     
     delete[] vehicles;
     
+    // Delete per-type pools
+    if (vehicleTypesList != nullptr && vehiclesByType != nullptr) {
+        int typeCount = vehicleTypesList->getSize();
+        if (typeCount > 0) {
+            string* types = new string[typeCount];
+            int actualCount = 0;
+            vehicleTypesList->toArray(types, actualCount);
+            for (int i = 0; i < actualCount; i++) {
+                VehiclePool* pool = findVehiclePool(types[i]);
+                if (pool != nullptr) {
+                    delete pool;
+                }
+            }
+            delete[] types;
+        }
+    }
+    
     // Clear hash tables and list
     if (vehiclesByID != nullptr) vehiclesByID->clear();
     if (vehiclesByType != nullptr) vehiclesByType->clear();
     if (allVehiclesList != nullptr) allVehiclesList->clear();
+    if (vehicleTypesList != nullptr) vehicleTypesList->clear();
     
     vehicleCount = 0;
+    availableVehicleCount = 0;
     emergencyCounter = 1;
 }
 
@@ -36,18 +36,51 @@ struct EmergencyRoute {
     string hospitalID;            // Destination hospital
 };
 
+// Structure holding all vehicles of one type, split into idle and dispatched pools
+// Each vehicle stores its slot (EmergencyVehicle::poolIndex) so moving it between
+// pools is a swap-with-last removal plus an append: O(1)
+struct VehiclePool {
+    string vehicleType;               // Vehicle type shared by every vehicle in the pool
+    EmergencyVehicle** available;     // Idle vehicles (candidates for dispatch)
+    int availableCount;               // Number of idle vehicles
+    int availableCapacity;            // Allocated size of available array
+    EmergencyVehicle** busy;          // Vehicles currently on an emergency call
+    int busyCount;                    // Number of busy vehicles
+    int busyCapacity;                 // Allocated size of busy array
+    
+    VehiclePool(const string& type);
+    ~VehiclePool();
+    
+    // Add a newly registered vehicle to the pool matching its availability
+    // Complexity: O(1) amortized
+    void addVehicle(EmergencyVehicle* vehicle);
+    
+    // Move a vehicle from the available pool to the busy pool
+    // Returns: false if the vehicle was not in the available pool
+    // Complexity: O(1) amortized
+    bool markBusy(EmergencyVehicle* vehicle);
+    
+    // Move a vehicle from the busy pool back to the available pool
+    // Returns: false if the vehicle was not in the busy pool
+    // Complexity: O(1) amortized
+    bool markAvailable(EmergencyVehicle* vehicle);
+};
+
 // EmergencyManager class - Central manager for emergency transport routing
 // Used for: Emergency transport routing (bonus module)
 class EmergencyManager {
 private:
     HashTable* vehiclesByID;          // Hash table for vehicle lookup by ID (key = vehicleID, value = EmergencyVehicle*)
-    HashTable* vehiclesByType;        // Hash table for vehicle lookup by type (key = type, value = EmergencyVehicle*)
+    HashTable* vehiclesByType;        // Hash table for per-type vehicle pools (key = type, value = VehiclePool*)
+    SinglyLinkedList* vehicleTypesList; // Linked list to track all vehicle types (stores type, for pool cleanup)
     HashTable* activeEmergencies;     // Hash table for active emergencies (key = emergencyID, value = Emergency*)
+    SinglyLinkedList* allEmergenciesList; // Linked list to track every reported emergency (stores emergencyID, for cleanup)
     MinHeap* emergencyQueue;          // Priority queue for emergencies (priority 1=highest, 3=lowest)
     SinglyLinkedList* allVehiclesList; // Linked list to track all vehicles (stores vehicleID)
     Graph* cityGraph;                 // Pointer to shared city graph (for pathfinding)
     MedicalSector* medicalSector;     // Pointer to medical sector (for hospital selection)
     int vehicleCount;                  // Current number of emergency vehicles
+    int availableVehicleCount;         // Current number of idle vehicles across all pools
     int emergencyCounter;              // Counter for generating unique emergency IDs
     
     // Helper function to get all vehicles as array
@@ -56,8 +89,23 @@ private:
     // Helper function to get all available vehicles of a type
     void getAvailableVehicles(const string& vehicleType, EmergencyVehicle** vehicles, int& count) const;
     
-    // Helper function to calculate distance between two locations (graph edges only)
-    double calculateRouteDistance(const string& fromLocation, const string& toLocation);
+    // Helper function to get the pool for a vehicle type
+    // Returns: VehiclePool pointer, nullptr if no vehicle of that type is registered
+    VehiclePool* findVehiclePool(const string& vehicleType) const;
+    
+    // Helper functions to keep the pools in sync with a vehicle's availability
+    void markVehicleBusy(EmergencyVehicle* vehicle);
+    void markVehicleAvailable(EmergencyVehicle* vehicle);
+    
+    // Helper function to pick a hospital, build the route and dispatch a chosen vehicle
+    // Returns: EmergencyRoute pointer if successful, nullptr otherwise
+    EmergencyRoute* assignVehicleToEmergency(Emergency* emergency, EmergencyVehicle* vehicle);
+    
+    // Helper function to assign idle vehicles of one type to a batch of emergencies
+    // Builds a vehicle x emergency distance matrix and solves it tier by tier (priority 1, 2, 3)
+    // Parameters: vehicleType, emergencies array, emergencyCount, routes (output, appended), routeCount (in/out)
+    void dispatchBatchForType(const string& vehicleType, Emergency** emergencies, int emergencyCount,
+                              EmergencyRoute** routes, int& routeCount);
     
     // Helper function to calculate complete distance from coordinates to coordinates
     // Returns: total distance (source coords -> source stop -> dest stop -> dest coords)
@@ -98,6 +146,14 @@ public:
     // Returns: Pointer to EmergencyVehicle if found, nullptr otherwise
     EmergencyVehicle* findVehicleByID(const string& vehicleID) const;
     
+    // Find the k nearest available vehicles of a specific type
+    // Uses one bounded Dijkstra search from fromLocation that stops once k idle vehicles are reached
+    // Parameters: vehicleType, fromLocation (stop ID), vehicles (output, nearest first), distances (output, km), k
+    // Returns: number of vehicles found (at most k)
+    // Note: Caller must allocate vehicles and distances arrays with at least k entries
+    int findNearestAvailableVehicles(const string& vehicleType, const string& fromLocation,
+                                     EmergencyVehicle** vehicles, double* distances, int k);
+    
     // Find nearest available vehicle of a specific type
     // Parameters: vehicleType, fromLocation (stop ID)
     // Returns: Pointer to nearest available EmergencyVehicle, nullptr if none available
@@ -114,6 +170,11 @@ public:
     // Get number of available vehicles
     int getAvailableVehicleCount() const;
     
+    // Get number of available vehicles of one type
+    // Returns: 0 if no vehicle of that type is registered
+    // Complexity: O(1) average
+    int getAvailableVehicleCount(const string& vehicleType) const;
+    
     // Display all vehicles
     void displayAllVehicles() const;
     
@@ -133,12 +194,22 @@ public:
     // Note: Caller must delete the EmergencyRoute and route array
     EmergencyRoute* dispatchToEmergency(const string& emergencyID);
     
+    // Dispatch vehicles to every pending emergency in the priority queue at once
+    // Minimises total response distance per vehicle type (Hungarian algorithm), serving
+    // priority 1 emergencies first, then 2, then 3; unserved emergencies stay queued
+    // Parameters: routeCount (output)
+    // Returns: Array of EmergencyRoute pointers (nullptr if none were dispatched)
+    // Note: Caller must delete each EmergencyRoute (and its route array) and the returned array
+    EmergencyRoute** dispatchAllPending(int& routeCount);
+    
     // Complete an emergency (make vehicle available again)
     // Parameters: emergencyID
     // Returns: true if successful, false otherwise
     bool completeEmergency(const string& emergencyID);
     
     // Find best hospital for emergency (combines beds, distance, specialization)
+    // With a specialization: the nearest matching hospital with a free bed; if every match is
+    // full, the match closest by route
     // Parameters: emergencyLocation, requiredSpecialization
     // Returns: Hospital pointer if found, nullptr otherwise
     Hospital* findBestHospital(const string& emergencyLocation, const string& requiredSpecialization = "");
@@ -157,7 +228,7 @@ public:
     // Display all active emergencies
     void displayActiveEmergencies() const;
     
-    // Clear all emergencies and make all vehicles available
+    // Clear all emergencies (deleting them) and make all vehicles available
     void clearAllEmergencies();
     
     // Clear all vehicles
@@ -0,0 +1,376 @@
+#include "EmergencySimulator.h"
+#include <iostream>
+#include <cmath>
+#include <chrono>
+#include <sstream>
+using namespace std;
+
+// Priority weighting used when encoding waiting emergencies (tier first, then report time)
+const double WAITING_TIER_WEIGHT = 1.0e7;
+
+// Vehicle type serving each emergency type index (Medical, Fire, Police)
+static const string SIM_VEHICLE_TYPES[SIM_VEHICLE_TYPE_COUNT] = { "Ambulance", "FireTruck", "Police" };
+
+// Helper function to sort latency samples in ascending order (shell sort)
+static void sortAscending(double* values, int count) {
+    for (int gap = count / 2; gap > 0; gap /= 2) {
+        for (int i = gap; i < count; i++) {
+            double value = values[i];
+            int j = i;
+            while (j >= gap && values[j - gap] > value) {
+                values[j] = values[j - gap];
+                j -= gap;
+            }
+            values[j] = value;
+        }
+    }
+}
+
+// Helper function to read a percentile from sorted samples (nearest-rank method)
+static double percentile(const double* sortedValues, int count, double fraction) {
+    if (count == 0) return 0.0;
+    int rank = (int)ceil(fraction * count) - 1;
+    if (rank < 0) rank = 0;
+    if (rank >= count) rank = count - 1;
+    return sortedValues[rank];
+}
+
+// SimulationConfig Implementation
+SimulationConfig::SimulationConfig()
+    : emergencyCount(500), arrivalsPerHour(30.0), vehiclesPerType(6), vehicleSpeedKmh(40.0),
+      meanServiceMinutes(20.0), randomSeed(42), useBatchDispatch(false) {
+}
+
+// SimulationReport Implementation
+SimulationReport::SimulationReport()
+    : emergenciesGenerated(0), emergenciesDispatched(0), emergenciesCompleted(0), emergenciesDropped(0), dispatchCalls(0),
+      eventsProcessed(0), simulatedMinutes(0.0), wallSeconds(0.0), eventsPerSecond(0.0),
+      latencyP50(0.0), latencyP90(0.0), latencyP99(0.0), latencyMax(0.0),
+      meanWaitMinutes(0.0), meanCallMinutes(0.0) {
+}
+
+// Constructor
+EmergencySimulator::EmergencySimulator(Graph* graph, MedicalSector* medical)
+    : cityGraph(graph), medicalSector(medical), manager(nullptr), stopIDs(nullptr), stopCount(0),
+      reportTimeValues(nullptr), randomState(42), latencyCount(0), latencyCapacity(256),
+      totalWaitMinutes(0.0), totalCallMinutes(0.0) {
+    eventQueue = new MinHeap(256);
+    for (int t = 0; t < SIM_VEHICLE_TYPE_COUNT; t++) {
+        waitingQueues[t] = new MinHeap(64);
+    }
+    reportTimes = new HashTable(101);
+    latencies = new double[latencyCapacity];
+}
+
+// Destructor
+EmergencySimulator::~EmergencySimulator() {
+    resetRun();
+
+    if (eventQueue != nullptr) {
+        delete eventQueue;
+        eventQueue = nullptr;
+    }
+    for (int t = 0; t < SIM_VEHICLE_TYPE_COUNT; t++) {
+        if (waitingQueues[t] != nullptr) {
+            delete waitingQueues[t];
+            waitingQueues[t] = nullptr;
+        }
+    }
+    if (reportTimes != nullptr) {
+        delete reportTimes;
+        reportTimes = nullptr;
+    }
+    if (latencies != nullptr) {
+        delete[] latencies;
+        latencies = nullptr;
+    }
+}
+
+double EmergencySimulator::nextUniform() {
+    // 64-bit LCG (Knuth MMIX constants); top 53 bits give a double in [0, 1)
+    randomState = randomState * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(randomState >> 11) / 9007199254740992.0;
+}
+
+double EmergencySimulator::nextExponential(double mean) {
+    return -mean * log(1.0 - nextUniform());
+}
+
+int EmergencySimulator::nextIndex(int count) {
+    if (count <= 0) return 0;
+    int index = (int)(nextUniform() * count);
+    return (index < count) ? index : count - 1;
+}
+
+void EmergencySimulator::collectStops() {
+    if (stopIDs != nullptr) {
+        delete[] stopIDs;
+        stopIDs = nullptr;
+    }
+    stopCount = 0;
+    if (cityGraph == nullptr) return;
+
+    int vertexTotal = cityGraph->getVertexCount();
+    if (vertexTotal == 0) return;
+
+    stopIDs = new string[vertexTotal];
+    for (int i = 0; i < vertexTotal; i++) {
+        Vertex* vertex = cityGraph->getVertexAt(i);
+        if (vertex != nullptr && vertex->vertexID.length() >= 4 && vertex->vertexID.substr(0, 4) == "Stop") {
+            stopIDs[stopCount] = vertex->vertexID;
+            stopCount++;
+        }
+    }
+}
+
+void EmergencySimulator::createFleet(int vehiclesPerType) {
+    const string prefixes[SIM_VEHICLE_TYPE_COUNT] = { "SIM-AMB", "SIM-FIRE", "SIM-POL" };
+
+    for (int t = 0; t < SIM_VEHICLE_TYPE_COUNT; t++) {
+        for (int i = 1; i <= vehiclesPerType; i++) {
+            stringstream ss;
+            ss << prefixes[t] << i;
+            string vehicleID = ss.str();
+
+            EmergencyVehicle* vehicle = new EmergencyVehicle(vehicleID, SIM_VEHICLE_TYPES[t], vehicleID, "Simulation",
+                                                             stopIDs[nextIndex(stopCount)]);
+            if (!manager->addVehicle(vehicle)) {
+                delete vehicle;
+            }
+        }
+    }
+}
+
+void EmergencySimulator::recordLatency(double microseconds) {
+    if (latencyCount >= latencyCapacity) {
+        int newCapacity = latencyCapacity * 2;
+        double* newLatencies = new double[newCapacity];
+        for (int i = 0; i < latencyCount; i++) {
+            newLatencies[i] = latencies[i];
+        }
+        delete[] latencies;
+        latencies = newLatencies;
+        latencyCapacity = newCapacity;
+    }
+    latencies[latencyCount] = microseconds;
+    latencyCount++;
+}
+
+void EmergencySimulator::scheduleCompletion(EmergencyRoute* route, double now, const SimulationConfig& config,
+                                            SimulationReport& report) {
+    if (route == nullptr) return;
+
+    report.emergenciesDispatched++;
+    void* data = reportTimes->search(route->emergencyID);
+    if (data != nullptr) {
+        totalWaitMinutes += now - *(double*)data;
+    }
+
+    // Drive the whole route (vehicle -> emergency -> hospital), then spend time on scene
+    double travelMinutes = route->totalDistance / config.vehicleSpeedKmh * 60.0;
+    double serviceMinutes = nextExponential(config.meanServiceMinutes);
+
+    SimulationEvent* event = new SimulationEvent();
+    event->eventType = SIM_EVENT_COMPLETION;
+    event->emergencyID = route->emergencyID;
+    event->finalLocation = (route->routeLength > 0) ? route->route[route->routeLength - 1] : "";
+    eventQueue->insert(route->emergencyID, now + travelMinutes + serviceMinutes, event);
+
+    delete[] route->route;
+    delete route;
+}
+
+void EmergencySimulator::dispatchPending(double now, const SimulationConfig& config, SimulationReport& report) {
+    if (manager->getAvailableVehicleCount() == 0) return;
+
+    if (config.useBatchDispatch) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        int routeCount = 0;
+        EmergencyRoute** routes = manager->dispatchAllPending(routeCount);
+        chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+        report.dispatchCalls++;
+        recordLatency(chrono::duration<double, micro>(end - start).count());
+
+        for (int i = 0; i < routeCount; i++) {
+            scheduleCompletion(routes[i], now, config, report);
+        }
+        if (routes != nullptr) delete[] routes;
+        return;
+    }
+
+    // Single dispatch: serve each type's queue in priority order until its fleet runs out
+    for (int t = 0; t < SIM_VEHICLE_TYPE_COUNT; t++) {
+        MinHeap* waiting = waitingQueues[t];
+        while (!waiting->isEmpty() && manager->getAvailableVehicleCount(SIM_VEHICLE_TYPES[t]) > 0) {
+            HeapNode node = waiting->peekMin();
+
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            EmergencyRoute* route = manager->dispatchToEmergency(node.identifier);
+            chrono::steady_clock::time_point end = chrono::steady_clock::now();
+
+            report.dispatchCalls++;
+            recordLatency(chrono::duration<double, micro>(end - start).count());
+
+            // A vehicle of this type is free but cannot be routed there (e.g., no path from
+            // its stop): drop the emergency so it does not block the queue behind it
+            waiting->extractMin();
+            if (route == nullptr) {
+                report.emergenciesDropped++;
+                continue;
+            }
+            scheduleCompletion(route, now, config, report);
+        }
+    }
+}
+
+void EmergencySimulator::resetRun() {
+    while (eventQueue != nullptr && !eventQueue->isEmpty()) {
+        HeapNode node = eventQueue->extractMin();
+        delete (SimulationEvent*)node.data;
+    }
+    for (int t = 0; t < SIM_VEHICLE_TYPE_COUNT; t++) {
+        if (waitingQueues[t] != nullptr) waitingQueues[t]->clear();
+    }
+    if (reportTimes != nullptr) reportTimes->clear();
+
+    if (reportTimeValues != nullptr) {
+        delete[] reportTimeValues;
+        reportTimeValues = nullptr;
+    }
+    if (stopIDs != nullptr) {
+        delete[] stopIDs;
+        stopIDs = nullptr;
+    }
+    stopCount = 0;
+    if (manager != nullptr) {
+        delete manager;
+        manager = nullptr;
+    }
+
+    latencyCount = 0;
+    totalWaitMinutes = 0.0;
+    totalCallMinutes = 0.0;
+}
+
+// Run a simulation
+SimulationReport EmergencySimulator::run(const SimulationConfig& config) {
+    SimulationReport report;
+    resetRun();
+    if (cityGraph == nullptr || config.emergencyCount <= 0 || config.arrivalsPerHour <= 0.0 ||
+        config.vehicleSpeedKmh <= 0.0) {
+        return report;
+    }
+
+    collectStops();
+    if (stopCount == 0) return report;
+
+    randomState = config.randomSeed;
+    manager = new EmergencyManager(cityGraph, medicalSector);
+    createFleet(config.vehiclesPerType);
+    reportTimeValues = new double[config.emergencyCount];
+
+    // Indexed like the fleet types: Medical -> Ambulance, Fire -> FireTruck, Police -> Police
+    const string emergencyTypes[SIM_VEHICLE_TYPE_COUNT] = { "Medical", "Fire", "Police" };
+    double meanGapMinutes = 60.0 / config.arrivalsPerHour;
+    double now = 0.0;
+
+    // First arrival; each arrival schedules the next one (Poisson process)
+    SimulationEvent* firstArrival = new SimulationEvent();
+    firstArrival->eventType = SIM_EVENT_ARRIVAL;
+    eventQueue->insert("ARRIVAL", nextExponential(meanGapMinutes), firstArrival);
+
+    chrono::steady_clock::time_point wallStart = chrono::steady_clock::now();
+
+    while (!eventQueue->isEmpty()) {
+        HeapNode node = eventQueue->extractMin();
+        SimulationEvent* event = (SimulationEvent*)node.data;
+        now = node.priority;
+        report.eventsProcessed++;
+
+        if (event->eventType == SIM_EVENT_ARRIVAL) {
+            // Mix: 20% critical, 30% urgent, 50% normal; 60% medical, 25% fire, 15% police
+            double roll = nextUniform();
+            int priority = (roll < 0.2) ? 1 : (roll < 0.5 ? 2 : 3);
+            roll = nextUniform();
+            int typeIndex = (roll < 0.6) ? 0 : (roll < 0.85 ? 1 : 2);
+            string type = emergencyTypes[typeIndex];
+            string stopID = stopIDs[nextIndex(stopCount)];
+
+            string emergencyID = manager->reportEmergency(stopID, 0.0, 0.0, priority, type);
+            if (!emergencyID.empty()) {
+                reportTimeValues[report.emergenciesGenerated] = now;
+                reportTimes->insert(emergencyID, (void*)&reportTimeValues[report.emergenciesGenerated]);
+                report.emergenciesGenerated++;
+                if (!config.useBatchDispatch) {
+                    waitingQueues[typeIndex]->insert(emergencyID, priority * WAITING_TIER_WEIGHT + now, nullptr);
+                }
+            }
+
+            if (report.emergenciesGenerated < config.emergencyCount && !emergencyID.empty()) {
+                event->eventType = SIM_EVENT_ARRIVAL;
+                eventQueue->insert("ARRIVAL", now + nextExponential(meanGapMinutes), event);
+                event = nullptr; // Reused for the next arrival
+            }
+        } else {
+            Emergency info;
+            if (manager->getEmergencyInfo(event->emergencyID, info)) {
+                // Vehicle stays where its route ended (scene or hospital)
+                EmergencyVehicle* vehicle = manager->findVehicleByID(info.assignedVehicleID);
+                if (manager->completeEmergency(event->emergencyID)) {
+                    report.emergenciesCompleted++;
+                    if (vehicle != nullptr && !event->finalLocation.empty()) {
+                        vehicle->setCurrentStopID(event->finalLocation);
+                    }
+                    void* data = reportTimes->search(event->emergencyID);
+                    if (data != nullptr) {
+                        totalCallMinutes += now - *(double*)data;
+                    }
+                }
+            }
+        }
+
+        if (event != nullptr) delete event;
+        dispatchPending(now, config, report);
+    }
+
+    chrono::steady_clock::time_point wallEnd = chrono::steady_clock::now();
+    report.wallSeconds = chrono::duration<double>(wallEnd - wallStart).count();
+    report.simulatedMinutes = now;
+    if (report.wallSeconds > 0.0) {
+        report.eventsPerSecond = report.eventsProcessed / report.wallSeconds;
+    }
+
+    sortAscending(latencies, latencyCount);
+    report.latencyP50 = percentile(latencies, latencyCount, 0.50);
+    report.latencyP90 = percentile(latencies, latencyCount, 0.90);
+    report.latencyP99 = percentile(latencies, latencyCount, 0.99);
+    report.latencyMax = (latencyCount > 0) ? latencies[latencyCount - 1] : 0.0;
+    if (report.emergenciesDispatched > 0) {
+        report.meanWaitMinutes = totalWaitMinutes / report.emergenciesDispatched;
+    }
+    if (report.emergenciesCompleted > 0) {
+        report.meanCallMinutes = totalCallMinutes / report.emergenciesCompleted;
+    }
+
+    resetRun();
+    return report;
+}
+
+// Display a simulation report
+void EmergencySimulator::displayReport(const SimulationReport& report) const {
+    cout << "Emergency Simulation Report:" << endl;
+    cout << "  Emergencies generated:  " << report.emergenciesGenerated << endl;
+    cout << "  Emergencies dispatched: " << report.emergenciesDispatched << endl;
+    cout << "  Emergencies completed:  " << report.emergenciesCompleted << endl;
+    cout << "  Emergencies dropped:    " << report.emergenciesDropped << endl;
+    cout << "  Simulated time:         " << report.simulatedMinutes / 60.0 << " hours" << endl;
+    cout << "  Mean wait for vehicle:  " << report.meanWaitMinutes << " min" << endl;
+    cout << "  Mean call duration:     " << report.meanCallMinutes << " min" << endl;
+    cout << "  Events processed:       " << report.eventsProcessed << endl;
+    cout << "  Wall time:              " << report.wallSeconds << " s" << endl;
+    cout << "  Throughput:             " << report.eventsPerSecond << " events/s" << endl;
+    cout << "  Dispatch calls:         " << report.dispatchCalls << endl;
+    cout << "  Dispatch latency (us):  p50=" << report.latencyP50 << "  p90=" << report.latencyP90
+         << "  p99=" << report.latencyP99 << "  max=" << report.latencyMax << endl;
+}
@@ -0,0 +1,122 @@
+#ifndef EMERGENCYSIMULATOR_H
+#define EMERGENCYSIMULATOR_H
+
+#include <string>
+#include "core_classes/Graph.h"
+#include "core_classes/MinHeap.h"
+#include "core_classes/HashTable.h"
+#include "EmergencyManager.h"
+#include "MedicalSector.h"
+using namespace std;
+
+// Event types processed by the simulator
+const int SIM_EVENT_ARRIVAL = 1;      // A new emergency is reported
+const int SIM_EVENT_COMPLETION = 2;   // A vehicle finishes its call and becomes available
+
+// Number of vehicle types in the simulated fleet (Ambulance, FireTruck, Police)
+const int SIM_VEHICLE_TYPE_COUNT = 3;
+
+// Structure for a scheduled simulation event (stored as MinHeap data, keyed by time)
+struct SimulationEvent {
+    int eventType;                // SIM_EVENT_ARRIVAL or SIM_EVENT_COMPLETION
+    string emergencyID;           // Emergency the event belongs to (completion only)
+    string finalLocation;         // Vertex where the vehicle ends its route (completion only)
+};
+
+// Structure holding simulation parameters
+struct SimulationConfig {
+    int emergencyCount;           // Number of emergencies to generate
+    double arrivalsPerHour;       // Mean arrival rate of the Poisson process
+    int vehiclesPerType;          // Ambulances, fire trucks and police cars placed at random stops
+    double vehicleSpeedKmh;       // Average speed used to turn route distance into travel time
+    double meanServiceMinutes;    // Mean on-scene time (exponentially distributed)
+    unsigned int randomSeed;      // Seed for reproducible runs
+    bool useBatchDispatch;        // true = dispatchAllPending, false = dispatchToEmergency per call
+
+    SimulationConfig();
+};
+
+// Structure holding the results of a simulation run
+struct SimulationReport {
+    int emergenciesGenerated;     // Emergencies reported
+    int emergenciesDispatched;    // Emergencies that received a vehicle
+    int emergenciesCompleted;     // Emergencies whose vehicle finished the call
+    int emergenciesDropped;       // Emergencies no free vehicle could be routed to (single dispatch mode)
+    int dispatchCalls;            // Number of timed dispatch calls
+    int eventsProcessed;          // Arrival + completion events handled
+    double simulatedMinutes;      // Simulated time at the last event
+    double wallSeconds;           // Real time spent in the event loop
+    double eventsPerSecond;       // eventsProcessed / wallSeconds
+    double latencyP50;            // Dispatch call latency percentiles (microseconds)
+    double latencyP90;
+    double latencyP99;
+    double latencyMax;
+    double meanWaitMinutes;       // Simulated time from report to dispatch
+    double meanCallMinutes;       // Simulated time from report to vehicle becoming free
+
+    SimulationReport();
+};
+
+// EmergencySimulator class - Discrete-event load generator for the emergency module
+// Used for: Measuring dispatch latency and throughput of EmergencyManager under realistic load
+// Runs on its own EmergencyManager (sharing the city graph and medical sector) so live data is untouched
+class EmergencySimulator {
+private:
+    Graph* cityGraph;                 // Pointer to shared city graph (stops and routing)
+    MedicalSector* medicalSector;     // Pointer to medical sector (hospital selection)
+    EmergencyManager* manager;        // Emergency manager being exercised (owned, rebuilt per run)
+    MinHeap* eventQueue;              // Future events keyed by simulated minute
+    MinHeap* waitingQueues[SIM_VEHICLE_TYPE_COUNT]; // Emergencies without a vehicle per vehicle type (single dispatch mode), keyed by priority then time
+    string* stopIDs;                  // Bus stops emergencies and vehicles are placed at
+    int stopCount;                    // Number of stops
+    HashTable* reportTimes;           // Report minute per emergency (key = emergencyID, value = double* into reportTimeValues)
+    double* reportTimeValues;         // Storage for report minutes (one per generated emergency)
+    unsigned long long randomState;   // State of the simulator's random generator
+    double* latencies;                // Dispatch call latencies (microseconds)
+    int latencyCount;                 // Number of recorded latencies
+    int latencyCapacity;              // Allocated size of latencies array
+    double totalWaitMinutes;          // Sum of report-to-dispatch times for the current run
+    double totalCallMinutes;          // Sum of report-to-completion times for the current run
+
+    // Random number helpers (64-bit LCG, independent of rand())
+    double nextUniform();
+    double nextExponential(double mean);
+    int nextIndex(int count);
+
+    // Helper function to collect bus stops from the graph
+    void collectStops();
+
+    // Helper function to place vehiclesPerType vehicles of each type at random stops
+    void createFleet(int vehiclesPerType);
+
+    // Helper function to record a dispatch latency sample
+    void recordLatency(double microseconds);
+
+    // Helper function to schedule the completion of a dispatched route
+    void scheduleCompletion(EmergencyRoute* route, double now, const SimulationConfig& config,
+                            SimulationReport& report);
+
+    // Helper function to dispatch waiting emergencies after an arrival or completion
+    void dispatchPending(double now, const SimulationConfig& config, SimulationReport& report);
+
+    // Helper function to release all scheduled events and run state
+    void resetRun();
+
+public:
+    // Constructor
+    // Parameters: graph - pointer to shared city graph, medical - pointer to medical sector (optional)
+    EmergencySimulator(Graph* graph = nullptr, MedicalSector* medical = nullptr);
+
+    // Destructor
+    ~EmergencySimulator();
+
+    // Run a simulation
+    // Parameters: config - simulation parameters
+    // Returns: SimulationReport with throughput and latency figures (all zero if the graph has no stops)
+    SimulationReport run(const SimulationConfig& config);
+
+    // Display a simulation report
+    void displayReport(const SimulationReport& report) const;
+};
+
+#endif // EMERGENCYSIMULATOR_H
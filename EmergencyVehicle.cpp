@@ -7,7 +7,7 @@ EmergencyVehicle::EmergencyVehicle(const string& vehID, const string& type,
                                    const string& busNo, const string& comp,
                                    const string& currentStop)
     : Bus(busNo, comp, currentStop), vehicleID(vehID), vehicleType(type),
-      isAvailable(true), priorityLevel(1), currentEmergencyID("") {
+      isAvailable(true), priorityLevel(1), currentEmergencyID(""), poolIndex(-1) {
 }
 
 // Destructor
@@ -36,6 +36,10 @@ string EmergencyVehicle::getCurrentEmergencyID() const {
     return currentEmergencyID;
 }
 
+int EmergencyVehicle::getPoolIndex() const {
+    return poolIndex;
+}
+
 // Setters
 void EmergencyVehicle::setVehicleType(const string& type) {
     vehicleType = type;
@@ -59,6 +63,10 @@ void EmergencyVehicle::setCurrentEmergencyID(const string& emergencyID) {
     currentEmergencyID = emergencyID;
 }
 
+void EmergencyVehicle::setPoolIndex(int index) {
+    poolIndex = index;
+}
+
 // Dispatch vehicle to an emergency
 bool EmergencyVehicle::dispatchToEmergency(const string& emergencyID) {
     if (emergencyID.empty()) return false;
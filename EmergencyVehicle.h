@@ -15,6 +15,7 @@ private:
     bool isAvailable;         // Currently available for dispatch
     int priorityLevel;        // 1=Critical, 2=Urgent, 3=Normal (for vehicle priority)
     string currentEmergencyID; // ID of current emergency being handled (empty if available)
+    int poolIndex;            // Slot in EmergencyManager's per-type available/busy pool (-1 if not pooled)
     
 public:
     // Constructor
@@ -34,6 +35,7 @@ public:
     bool getIsAvailable() const;
     int getPriorityLevel() const;
     string getCurrentEmergencyID() const;
+    int getPoolIndex() const;
     
     // Setters
     void setVehicleType(const string& type);
@@ -41,6 +43,7 @@ public:
     void setIsAvailable(bool available);
     void setPriorityLevel(int level);
     void setCurrentEmergencyID(const string& emergencyID);
+    void setPoolIndex(int index);
     
     // Emergency operations
     // Dispatch vehicle to an emergency
@@ -3,43 +3,8 @@
 using namespace std;
 
 // Helper function to get approximate coordinates for Islamabad sectors
-void FacilityManager::getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
-    // Base coordinates for Islamabad (approximate center)
-    double baseLat = 33.684;
-    double baseLon = 73.047;
-    
-    // Default to base coordinates
-    latitude = baseLat;
-    longitude = baseLon;
-    
-    // Map common sectors to approximate coordinates (Islamabad layout)
-    if (sector == "G-10" || sector == "G10") {
-        latitude = 33.684; longitude = 73.025;
-    } else if (sector == "F-8" || sector == "F8") {
-        latitude = 33.700; longitude = 73.037;
-    } else if (sector == "F-6" || sector == "F6") {
-        latitude = 33.715; longitude = 73.045;
-    } else if (sector == "G-9" || sector == "G9") {
-        latitude = 33.690; longitude = 73.030;
-    } else if (sector == "F-7" || sector == "F7") {
-        latitude = 33.707; longitude = 73.040;
-    } else if (sector == "G-8" || sector == "G8") {
-        latitude = 33.694; longitude = 73.032;
-    } else if (sector == "H-8" || sector == "H8") {
-        latitude = 33.710; longitude = 73.042;
-    } else if (sector == "I-8" || sector == "I8") {
-        latitude = 33.720; longitude = 73.048;
-    } else if (sector == "G-6" || sector == "G6") {
-        latitude = 33.709; longitude = 73.044;
-    } else if (sector == "F-10" || sector == "F10") {
-        latitude = 33.705; longitude = 73.038;
-    } else if (sector == "Blue Area") {
-        latitude = 33.697; longitude = 73.039;
-    } else {
-        // For unknown sectors, use base coordinates
-        latitude = baseLat;
-        longitude = baseLon;
-    }
+bool FacilityManager::getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
+    return SectorGazetteer::getShared()->getCoordinates(sector, latitude, longitude);
 }
 
 // Helper function to calculate simple squared distance
@@ -49,13 +14,139 @@ static double calculateDistanceSquared(double lat1, double lon1, double lat2, do
     return dLat * dLat + dLon * dLon;
 }
 
+// FacilityTypeList Implementation
+FacilityTypeList::FacilityTypeList(const string& t)
+    : type(t), spatialReady(true), locatedCount(0), count(0), capacity(8) {
+    facilities = new Facility*[capacity];
+    vertexIDs = new string[capacity];
+    latitudes = new double[capacity];
+    longitudes = new double[capacity];
+    latitudeOrder = new int[capacity];
+}
+
+FacilityTypeList::~FacilityTypeList() {
+    delete[] facilities;
+    delete[] vertexIDs;
+    delete[] latitudes;
+    delete[] longitudes;
+    delete[] latitudeOrder;
+    facilities = nullptr;
+    vertexIDs = nullptr;
+    latitudes = nullptr;
+    longitudes = nullptr;
+    latitudeOrder = nullptr;
+}
+
+void FacilityTypeList::add(Facility* facility) {
+    if (count >= capacity) {
+        int newCapacity = capacity * 2;
+        Facility** newFacilities = new Facility*[newCapacity];
+        string* newVertexIDs = new string[newCapacity];
+        double* newLatitudes = new double[newCapacity];
+        double* newLongitudes = new double[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newFacilities[i] = facilities[i];
+            newVertexIDs[i].swap(vertexIDs[i]);
+            newLatitudes[i] = latitudes[i];
+            newLongitudes[i] = longitudes[i];
+        }
+        delete[] facilities;
+        delete[] vertexIDs;
+        delete[] latitudes;
+        delete[] longitudes;
+        delete[] latitudeOrder;
+        facilities = newFacilities;
+        vertexIDs = newVertexIDs;
+        latitudes = newLatitudes;
+        longitudes = newLongitudes;
+        latitudeOrder = new int[newCapacity];
+        capacity = newCapacity;
+    }
+    
+    facilities[count] = facility;
+    vertexIDs[count] = facility->getVertexID();
+    latitudes[count] = 0.0;
+    longitudes[count] = 0.0;
+    count++;
+    
+    // The facility's graph vertex is usually added after the facility itself,
+    // so coordinates are looked up when the index is next queried
+    spatialReady = false;
+}
+
+void FacilityTypeList::buildSpatialIndex(Graph* graph) {
+    // Facilities with no graph vertex and an unknown sector are left out of the index
+    locatedCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (graph == nullptr || !graph->getVertexCoordinates(vertexIDs[i], latitudes[i], longitudes[i])) {
+            if (!SectorGazetteer::getShared()->getCoordinates(facilities[i]->getSector(),
+                                                              latitudes[i], longitudes[i])) {
+                continue;
+            }
+        }
+        latitudeOrder[locatedCount++] = i;
+    }
+    
+    if (locatedCount > 1) {
+        int* buffer = new int[locatedCount];
+        int* source = latitudeOrder;
+        int* target = buffer;
+        for (int width = 1; width < locatedCount; width *= 2) {
+            for (int low = 0; low < locatedCount; low += 2 * width) {
+                int mid = (low + width < locatedCount) ? low + width : locatedCount;
+                int high = (low + 2 * width < locatedCount) ? low + 2 * width : locatedCount;
+                int i = low, j = mid, k = low;
+                while (i < mid && j < high) {
+                    if (latitudes[source[j]] < latitudes[source[i]]) {
+                        target[k++] = source[j++];
+                    } else {
+                        target[k++] = source[i++];
+                    }
+                }
+                while (i < mid) target[k++] = source[i++];
+                while (j < high) target[k++] = source[j++];
+            }
+            int* temp = source;
+            source = target;
+            target = temp;
+        }
+        
+        // Keep the sorted run in latitudeOrder
+        if (source != latitudeOrder) {
+            for (int i = 0; i < locatedCount; i++) {
+                latitudeOrder[i] = source[i];
+            }
+            delete[] source;
+        } else {
+            delete[] target;
+        }
+    }
+    
+    spatialReady = true;
+}
+
+int FacilityTypeList::lowerBound(double latitude) const {
+    int low = 0;
+    int high = locatedCount;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (latitudes[latitudeOrder[mid]] < latitude) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
 // Constructor
 FacilityManager::FacilityManager(Graph* graph)
-    : cityGraph(graph), facilityCount(0) {
+    : typeListCount(0), typeListCapacity(8), cityGraph(graph), facilityCount(0) {
     // Initialize hash tables with reasonable sizes (prime numbers)
     facilitiesByID = new HashTable(101);
     facilitiesByName = new HashTable(101);
     facilitiesByType = new HashTable(31); // Smaller size for types (fewer types than facilities)
+    typeLists = new FacilityTypeList*[typeListCapacity];
     allFacilitiesList = new SinglyLinkedList();
 }
 
@@ -76,6 +167,10 @@ FacilityManager::~FacilityManager() {
         delete facilitiesByType;
         facilitiesByType = nullptr;
     }
+    if (typeLists != nullptr) {
+        delete[] typeLists;
+        typeLists = nullptr;
+    }
     if (allFacilitiesList != nullptr) {
         delete allFacilitiesList;
         allFacilitiesList = nullptr;
@@ -117,6 +212,30 @@ void FacilityManager::getAllFacilities(Facility** facilities, int& count) const
     delete[] facilityIDs;
 }
 
+// Helper function to get a type's list, creating it if new
+FacilityTypeList* FacilityManager::getOrCreateTypeList(const string& type) {
+    FacilityTypeList* list = (FacilityTypeList*)facilitiesByType->search(type);
+    if (list != nullptr) {
+        return list;
+    }
+    
+    if (typeListCount >= typeListCapacity) {
+        int newCapacity = typeListCapacity * 2;
+        FacilityTypeList** newLists = new FacilityTypeList*[newCapacity];
+        for (int i = 0; i < typeListCount; i++) {
+            newLists[i] = typeLists[i];
+        }
+        delete[] typeLists;
+        typeLists = newLists;
+        typeListCapacity = newCapacity;
+    }
+    
+    list = new FacilityTypeList(type);
+    typeLists[typeListCount++] = list;
+    facilitiesByType->insert(type, (void*)list);
+    return list;
+}
+
 // Add a facility to the manager
 bool FacilityManager::addFacility(Facility* facility) {
     if (facility == nullptr) return false;
@@ -130,7 +249,7 @@ bool FacilityManager::addFacility(Facility* facility) {
     // Add to all hash tables
     facilitiesByID->insert(facility->getFacilityID(), (void*)facility);
     facilitiesByName->insert(facility->getName(), (void*)facility);
-    facilitiesByType->insert(facility->getType(), (void*)facility);
+    getOrCreateTypeList(facility->getType())->add(facility);
     
     // Add facility ID to list for iteration
     allFacilitiesList->insertAtTail(facility->getFacilityID());
@@ -166,20 +285,33 @@ void FacilityManager::findFacilitiesByType(const string& type, Facility** result
     count = 0;
     if (results == nullptr || type.empty()) return;
     
-    // Get all facilities
-    Facility** facilities = new Facility*[facilityCount];
-    int totalCount = 0;
-    getAllFacilities(facilities, totalCount);
+    FacilityTypeList* list = (FacilityTypeList*)facilitiesByType->search(type);
+    if (list == nullptr) return;
     
-    // Filter by type
-    for (int i = 0; i < totalCount; i++) {
-        if (facilities[i]->getType() == type) {
-            results[count] = facilities[i];
-            count++;
-        }
+    for (int i = 0; i < list->count; i++) {
+        results[count] = list->facilities[i];
+        count++;
     }
+}
+
+// Get number of facilities of a specific type
+int FacilityManager::getFacilityCountByType(const string& type) const {
+    if (type.empty()) return 0;
     
-    delete[] facilities;
+    FacilityTypeList* list = (FacilityTypeList*)facilitiesByType->search(type);
+    return (list != nullptr) ? list->count : 0;
+}
+
+// Get every facility type
+string* FacilityManager::getFacilityTypes(int& count) const {
+    count = 0;
+    if (typeListCount == 0) return nullptr;
+    
+    string* types = new string[typeListCount];
+    for (int i = 0; i < typeListCount; i++) {
+        types[count++] = typeLists[i]->type;
+    }
+    return types;
 }
 
 // Get number of facilities
@@ -284,7 +416,8 @@ Facility* FacilityManager::findNearestFacility(double latitude, double longitude
             }
         } else {
             // Fallback: use sector coordinates if graph vertex not found
-            getSectorCoordinates(facility->getSector(), facilityLat, facilityLon);
+            // (skip facilities in unknown sectors rather than placing them at the city center)
+            if (!getSectorCoordinates(facility->getSector(), facilityLat, facilityLon)) continue;
             double distSquared = calculateDistanceSquared(latitude, longitude, facilityLat, facilityLon);
             
             if (distSquared < minDistance) {
@@ -300,45 +433,105 @@ Facility* FacilityManager::findNearestFacility(double latitude, double longitude
 
 // Find nearest facility of a specific type
 Facility* FacilityManager::findNearestFacilityByType(const string& type, const string& fromStopID) {
-    if (type.empty() || fromStopID.empty() || cityGraph == nullptr || facilityCount == 0) {
+    int count = 0;
+    Facility** nearest = findNearestFacilitiesByType(type, fromStopID, 1, count);
+    if (nearest == nullptr) return nullptr;
+    
+    Facility* facility = nearest[0];
+    delete[] nearest;
+    return facility;
+}
+
+// Find the k facilities of a type closest to a stop by road distance
+Facility** FacilityManager::findNearestFacilitiesByType(const string& type, const string& fromStopID, int k,
+                                                        int& count, double* distances) {
+    count = 0;
+    if (type.empty() || fromStopID.empty() || cityGraph == nullptr || k <= 0) {
         return nullptr;
     }
     
-    // Get all facilities of the specified type
-    Facility** typeFacilities = new Facility*[facilityCount];
-    int typeCount = 0;
-    findFacilitiesByType(type, typeFacilities, typeCount);
-    
-    if (typeCount == 0) {
-        delete[] typeFacilities;
-        return nullptr;
+    FacilityTypeList* list = (FacilityTypeList*)facilitiesByType->search(type);
+    if (list == nullptr || list->count == 0) return nullptr;
+    if (k > list->count) k = list->count;
+    
+    // One Dijkstra search from the stop, stopped once k of the type's vertices are settled
+    int* found = new int[k];
+    double* foundDistances = new double[k];
+    int foundCount = cityGraph->findNearestTargets(fromStopID, list->vertexIDs, list->count, k,
+                                                   found, foundDistances);
+    
+    Facility** results = nullptr;
+    if (foundCount > 0) {
+        results = new Facility*[foundCount];
+        for (int i = 0; i < foundCount; i++) {
+            results[i] = list->facilities[found[i]];
+            if (distances != nullptr) {
+                distances[i] = foundDistances[i];
+            }
+        }
+        count = foundCount;
     }
     
-    Facility* nearestFacility = nullptr;
-    double minDistance = -1.0;
+    delete[] found;
+    delete[] foundDistances;
+    return results;
+}
+
+// Find the k facilities of a type closest to given coordinates
+Facility** FacilityManager::findNearestFacilitiesByType(const string& type, double latitude, double longitude,
+                                                        int k, int& count) {
+    count = 0;
+    if (type.empty() || k <= 0) return nullptr;
     
-    // For each facility of the type, calculate distance
-    for (int i = 0; i < typeCount; i++) {
-        string facilityVertexID = typeFacilities[i]->getVertexID();
-        if (facilityVertexID.empty()) continue;
+    FacilityTypeList* list = (FacilityTypeList*)facilitiesByType->search(type);
+    if (list == nullptr || list->count == 0) return nullptr;
+    
+    if (!list->spatialReady) {
+        list->buildSpatialIndex(cityGraph);
+    }
+    if (list->locatedCount == 0) return nullptr;
+    if (k > list->locatedCount) k = list->locatedCount;
+    
+    // Best k so far, nearest first
+    Facility** best = new Facility*[k];
+    double* bestDistances = new double[k];
+    
+    // Walk outwards from the query latitude, always taking the side with the smaller gap
+    int below = list->lowerBound(latitude) - 1;
+    int above = below + 1;
+    while (below >= 0 || above < list->locatedCount) {
+        int position;
+        double gap;
+        double gapBelow = (below >= 0) ? latitude - list->latitudes[list->latitudeOrder[below]] : -1.0;
+        double gapAbove = (above < list->locatedCount) ? list->latitudes[list->latitudeOrder[above]] - latitude : -1.0;
+        if (gapAbove < 0.0 || (gapBelow >= 0.0 && gapBelow <= gapAbove)) {
+            position = list->latitudeOrder[below--];
+            gap = gapBelow;
+        } else {
+            position = list->latitudeOrder[above++];
+            gap = gapAbove;
+        }
         
-        // Use graph to find shortest path
-        int pathLength = 0;
-        double distance = 0.0;
-        string* path = cityGraph->findShortestPath(fromStopID, facilityVertexID, pathLength, distance);
+        // Every remaining facility is at least this far away in latitude alone
+        if (count == k && gap * gap >= bestDistances[k - 1]) break;
         
-        if (path != nullptr && distance >= 0.0) {
-            // Valid path found
-            if (minDistance < 0.0 || distance < minDistance) {
-                minDistance = distance;
-                nearestFacility = typeFacilities[i];
-            }
-            delete[] path;
+        double distSquared = calculateDistanceSquared(latitude, longitude,
+                                                      list->latitudes[position], list->longitudes[position]);
+        if (count == k && distSquared >= bestDistances[k - 1]) continue;
+        
+        // Insert after every facility at the same or a smaller distance
+        int slot = (count < k) ? count++ : k - 1;
+        while (slot > 0 && bestDistances[slot - 1] > distSquared) {
+            best[slot] = best[slot - 1];
+            bestDistances[slot] = bestDistances[slot - 1];
+            slot--;
         }
+        best[slot] = list->facilities[position];
+        bestDistances[slot] = distSquared;
     }
     
-    delete[] typeFacilities;
-    return nearestFacility;
+    delete[] bestDistances;
+    return best;
 }
 
 // Helper function to parse coordinates from string "lat, lon"
@@ -419,6 +612,29 @@ static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     return true;
 }
 
+// Build a query table of every facility
+QueryTable* FacilityManager::buildFacilityView() const {
+    QueryTable* view = new QueryTable("Facilities");
+    int typeColumn = view->addCategoryColumn("Type");
+    int sectorColumn = view->addCategoryColumn("Sector");
+    int nameColumn = view->addCategoryColumn("Name");
+    if (facilityCount == 0) return view;
+    
+    Facility** facilities = new Facility*[facilityCount];
+    int count = 0;
+    getAllFacilities(facilities, count);
+    
+    for (int i = 0; i < count; i++) {
+        int row = view->addRow();
+        view->setCategory(row, typeColumn, facilities[i]->getType());
+        view->setCategory(row, sectorColumn, facilities[i]->getSector());
+        view->setCategory(row, nameColumn, facilities[i]->getName());
+    }
+    
+    delete[] facilities;
+    return view;
+}
+
 // Load facilities from CSV data
 bool FacilityManager::loadFacilitiesFromCSVData(CSVRow* facilityData, int facilityCount) {
     if (facilityData == nullptr || facilityCount <= 0 || cityGraph == nullptr) return false;
@@ -487,6 +703,10 @@ void FacilityManager::clear() {
     if (facilitiesByType != nullptr) {
         facilitiesByType->clear();
     }
+    for (int i = 0; i < typeListCount; i++) {
+        delete typeLists[i];
+    }
+    typeListCount = 0;
     if (allFacilitiesList != nullptr) {
         allFacilitiesList->clear();
     }
@@ -7,16 +7,52 @@
 #include "core_classes/SinglyLinkedList.h"
 #include "core_classes/MinHeap.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/SectorGazetteer.h"
+#include "core_classes/QueryTable.h"
 #include "Facility.h"
 using namespace std;
 
+// Structure for all facilities of one type, with a latitude-sorted spatial index
+struct FacilityTypeList {
+    string type;              // Type as written in the data (e.g., "Mosque")
+    Facility** facilities;    // Facilities in insertion order (not owned)
+    string* vertexIDs;        // Graph vertex of each facility (targets for road-distance k-NN)
+    double* latitudes;        // Coordinate columns aligned with facilities
+    double* longitudes;
+    int* latitudeOrder;       // Facility positions sorted by latitude (located facilities only)
+    bool spatialReady;        // False until coordinates are resolved after the last insert
+    int locatedCount;         // Facilities with known coordinates (length of latitudeOrder)
+    int count;                // Number of facilities in the list
+    int capacity;             // Allocated size of all arrays
+    
+    FacilityTypeList(const string& t);
+    ~FacilityTypeList();
+    
+    // Append a facility (the spatial index is rebuilt on the next coordinate query)
+    // Complexity: O(1) amortized
+    void add(Facility* facility);
+    
+    // Resolve coordinates and sort latitudeOrder
+    // Parameters: graph - source of vertex coordinates (sector centroid is the fallback;
+    //             facilities in unknown sectors are skipped)
+    // Complexity: O(n log n) - bottom-up merge sort
+    void buildSpatialIndex(Graph* graph);
+    
+    // Position in latitudeOrder of the first facility at or above latitude
+    // Complexity: O(log n)
+    int lowerBound(double latitude) const;
+};
+
 // FacilityManager class - Central manager for all public facilities
 // Used for: Public facilities management, facility searches, nearest facility queries
 class FacilityManager {
 private:
     HashTable* facilitiesByID;          // Hash table for facility lookup by ID (key = facilityID, value = Facility*)
     HashTable* facilitiesByName;        // Hash table for facility lookup by name (key = facility name, value = Facility*)
-    HashTable* facilitiesByType;        // Hash table for facility lookup by type (key = type, value = Facility*)
+    HashTable* facilitiesByType;        // Type index (key = type, value = FacilityTypeList*)
+    FacilityTypeList** typeLists;       // Owned type lists (for cleanup)
+    int typeListCount;
+    int typeListCapacity;
     SinglyLinkedList* allFacilitiesList; // Linked list to track all facilities for iteration (stores facilityID)
     Graph* cityGraph;                    // Pointer to shared city graph (for nearest facility queries)
     int facilityCount;                   // Current number of facilities
@@ -25,7 +61,11 @@ private:
     void getAllFacilities(Facility** facilities, int& count) const;
     
     // Helper: Get sector coordinates for coordinate-based searches
-    static void getSectorCoordinates(const string& sector, double& latitude, double& longitude);
+    // Returns: false if the sector is unknown (coordinates are set to the city center)
+    static bool getSectorCoordinates(const string& sector, double& latitude, double& longitude);
+    
+    // Helper function to get a type's list, creating it if new
+    FacilityTypeList* getOrCreateTypeList(const string& type);
     
 public:
     // Constructor
@@ -54,11 +94,20 @@ public:
     // Returns: Pointer to Facility if found, nullptr otherwise
     Facility* findFacilityByName(const string& name) const;
     
-    // Find all facilities of a specific type
+    // Find all facilities of a specific type (in the order they were added)
     // Parameters: type, results array (output), count (output)
-    // Note: Caller must allocate results array with sufficient size
+    // Note: Caller must allocate results array with getFacilityCountByType(type) entries
+    // Complexity: O(1) lookup + O(t) copy where t is number of facilities of the type
     void findFacilitiesByType(const string& type, Facility** results, int& count);
     
+    // Get number of facilities of a specific type
+    // Complexity: O(1)
+    int getFacilityCountByType(const string& type) const;
+    
+    // Get every facility type, in the order first seen
+    // Returns: Array of types (caller must delete[]), nullptr if there are none
+    string* getFacilityTypes(int& count) const;
+    
     // Get number of facilities
     int getFacilityCount() const;
     
@@ -78,6 +127,28 @@ public:
     // Returns: Pointer to nearest Facility of given type, nullptr if not found
     Facility* findNearestFacilityByType(const string& type, const string& fromStopID);
     
+    // Find the k facilities of a type closest to a stop by road distance
+    // One bounded Dijkstra search over the type's vertices, stopped at the k-th facility
+    // Parameters: type, fromStopID, k, count (output),
+    //             distances (optional output, caller allocates k entries; km, aligned with the result)
+    // Returns: Array of facilities, nearest first (caller must delete[]), nullptr if none reachable
+    // Complexity: O((V' + E') log V') where V', E' are explored before the k-th facility
+    Facility** findNearestFacilitiesByType(const string& type, const string& fromStopID, int k,
+                                           int& count, double* distances = nullptr);
+    
+    // Find the k facilities of a type closest to given coordinates (straight-line)
+    // Scans outwards from the query latitude and stops once the latitude gap alone
+    // exceeds the k-th best distance
+    // Returns: Array of facilities, nearest first (caller must delete[]), nullptr if none
+    // Complexity: O(log t + m × k) where m is number of facilities inspected
+    Facility** findNearestFacilitiesByType(const string& type, double latitude, double longitude,
+                                           int k, int& count);
+    
+    // Build a query table of every facility (columns: Type, Sector, Name)
+    // Returns: New QueryTable (caller must delete)
+    // Complexity: O(f) where f is number of facilities
+    QueryTable* buildFacilityView() const;
+    
     // CSV data loading
     // Load facilities from CSV data
     // Parameters: facilityData - array of CSVRow from DataLoader, facilityCount - number of rows
@@ -2,13 +2,15 @@
 using namespace std;
 
 // Default constructor
-Hospital::Hospital() : hospitalID(""), name(""), sector(""), emergencyBeds(0), specialization("") {
+Hospital::Hospital() : hospitalID(""), name(""), sector(""), emergencyBeds(0), specialization(""),
+                       bedHeapHandle(-1) {
 }
 
 // Parameterized constructor
 Hospital::Hospital(const string& id, const string& n, const string& sec, 
                    int beds, const string& spec) 
-    : hospitalID(id), name(n), sector(sec), emergencyBeds(beds), specialization(spec) {
+    : hospitalID(id), name(n), sector(sec), emergencyBeds(beds), specialization(spec),
+      bedHeapHandle(-1) {
 }
 
 // Destructor
@@ -36,6 +38,10 @@ string Hospital::getSpecialization() const {
     return specialization;
 }
 
+int Hospital::getBedHeapHandle() const {
+    return bedHeapHandle;
+}
+
 // Setters
 void Hospital::setHospitalID(const string& id) {
     hospitalID = id;
@@ -57,6 +63,10 @@ void Hospital::setSpecialization(const string& spec) {
     specialization = spec;
 }
 
+void Hospital::setBedHeapHandle(int handle) {
+    bedHeapHandle = handle;
+}
+
 // Check if hospital has available emergency beds
 bool Hospital::hasAvailableBeds() const {
     return emergencyBeds > 0;
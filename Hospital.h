@@ -13,6 +13,7 @@ private:
     string sector;          // Location sector (e.g., G-8, H-8)
     int emergencyBeds;           // Number of emergency beds available
     string specialization;  // Medical specialization(s) (e.g., "General, Cardiology")
+    int bedHeapHandle;           // Handle in MedicalSector's bed availability heap (-1 if not registered)
     
 public:
     // Constructor
@@ -29,6 +30,7 @@ public:
     string getSector() const;
     int getEmergencyBeds() const;
     string getSpecialization() const;
+    int getBedHeapHandle() const;
     
     // Setters
     void setHospitalID(const string& id);
@@ -36,6 +38,7 @@ public:
     void setSector(const string& sec);
     void setEmergencyBeds(int beds);
     void setSpecialization(const string& spec);
+    void setBedHeapHandle(int handle);
     
     // Check if hospital has available emergency beds
     bool hasAvailableBeds() const;
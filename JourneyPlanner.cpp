@@ -0,0 +1,441 @@
+#include "JourneyPlanner.h"
+#include "core_classes/MinHeap.h"
+#include <iostream>
+#include <cmath>
+using namespace std;
+
+const double JourneyPlanner::BUS_SPEED = 22.0;
+const double JourneyPlanner::RAIL_SPEED = 60.0;
+const double JourneyPlanner::AIR_SPEED = 700.0;
+const double JourneyPlanner::WALK_SPEED = 4.8;
+const double JourneyPlanner::ACCESS_SPEED = 30.0;
+const double JourneyPlanner::STOP_WALK_DISTANCE = 1.0;
+
+// JourneyPlanner Implementation
+JourneyPlanner::JourneyPlanner(TransportManager* transportManager, RailwayManager* railwayManager,
+                               AirportManager* airportManager)
+    : transport(transportManager), railways(railwayManager), airports(airportManager),
+      builtRouteVersion(0), builtCityVersion(0), builtRailVersion(0), builtAirVersion(0), built(false) {
+    timetable = new Timetable();
+}
+
+JourneyPlanner::~JourneyPlanner() {
+    delete timetable;
+}
+
+int JourneyPlanner::travelMinutes(double distance, double speed) {
+    int minutes = (int)ceil(distance / speed * 60.0);
+    return (minutes > 0) ? minutes : 1;
+}
+
+bool JourneyPlanner::isStale() const {
+    if (!built) return true;
+    
+    // Version counters catch edits that keep the sizes (e.g., a changed flight distance)
+    Graph* cityGraph = (transport != nullptr) ? transport->getCityGraph() : nullptr;
+    if (transport != nullptr && transport->getRouteVersion() != builtRouteVersion) return true;
+    if (cityGraph != nullptr && cityGraph->getVersion() != builtCityVersion) return true;
+    if (railways != nullptr && railways->getRailNetwork()->getVersion() != builtRailVersion) return true;
+    if (airports != nullptr && airports->getAirNetwork()->getVersion() != builtAirVersion) return true;
+    return false;
+}
+
+int JourneyPlanner::addCityStop(const string& stopID) {
+    Graph* cityGraph = (transport != nullptr) ? transport->getCityGraph() : nullptr;
+    Vertex* vertex = (cityGraph != nullptr) ? cityGraph->findVertex(stopID) : nullptr;
+    return timetable->addStop(stopID, (vertex != nullptr) ? vertex->name : "");
+}
+
+void JourneyPlanner::addTrips(int route, const int* hops, int stopCount, int headway, int dwell, int offset) {
+    int* arrivals = new int[stopCount];
+    int* departures = new int[stopCount];
+    
+    for (int start = SERVICE_START + offset; start <= SERVICE_END; start += headway) {
+        arrivals[0] = start;
+        departures[0] = start;
+        for (int i = 1; i < stopCount; i++) {
+            arrivals[i] = departures[i - 1] + hops[i - 1];
+            departures[i] = arrivals[i] + ((i < stopCount - 1) ? dwell : 0);
+        }
+        timetable->addTrip(route, arrivals, departures);
+    }
+    
+    delete[] arrivals;
+    delete[] departures;
+}
+
+void JourneyPlanner::addLine(const string& name, int mode, const int* stops, const double* distances, int count,
+                             double speed, int headway, int dwell, int extraMinutes, bool bothWays) {
+    if (count < 2) return;
+    
+    int* hops = new int[count - 1];
+    for (int i = 0; i < count - 1; i++) {
+        hops[i] = travelMinutes(distances[i], speed) + extraMinutes;
+    }
+    
+    // Stagger first departures so routes sharing stops do not all leave together
+    int route = timetable->addRoute(name, mode, stops, count);
+    if (route >= 0) {
+        addTrips(route, hops, count, headway, dwell, (route * 3) % headway);
+    }
+    
+    if (bothWays) {
+        int* reverseStops = new int[count];
+        int* reverseHops = new int[count - 1];
+        for (int i = 0; i < count; i++) {
+            reverseStops[i] = stops[count - 1 - i];
+        }
+        for (int i = 0; i < count - 1; i++) {
+            reverseHops[i] = hops[count - 2 - i];
+        }
+        
+        route = timetable->addRoute(name + " (return)", mode, reverseStops, count);
+        if (route >= 0) {
+            addTrips(route, reverseHops, count, headway, dwell, (route * 3) % headway);
+        }
+        delete[] reverseStops;
+        delete[] reverseHops;
+    }
+    
+    delete[] hops;
+}
+
+void JourneyPlanner::addBusRoutes() {
+    if (transport == nullptr || transport->getBusCount() == 0) return;
+    Graph* cityGraph = transport->getCityGraph();
+    if (cityGraph == nullptr) return;
+    
+    int busCount = 0;
+    Bus** buses = new Bus*[transport->getBusCount()];
+    transport->getAllBusesPublic(buses, busCount);
+    
+    for (int b = 0; b < busCount; b++) {
+        Bus* bus = buses[b];
+        // School buses are not public transport
+        if (transport->getSchoolBusByNumber(bus->getBusNo()) != nullptr) continue;
+        
+        int length = bus->getRouteLength();
+        if (length < 2) continue;
+        
+        string* routeStops = new string[length];
+        int* stops = new int[length];
+        double* distances = new double[length];
+        int count = 0;
+        bus->getRouteStops(routeStops, count);
+        
+        // Road distance between consecutive stops, straight line if they are not connected by road
+        bool valid = (count >= 2);
+        for (int i = 0; i < count && valid; i++) {
+            stops[i] = addCityStop(routeStops[i]);
+            if (i == 0) continue;
+            
+            int pathLength = 0;
+            double distance = 0.0;
+            string* path = cityGraph->findShortestPath(routeStops[i - 1], routeStops[i], pathLength, distance);
+            if (path != nullptr) {
+                distances[i - 1] = distance;
+                delete[] path;
+            } else {
+                double lat1, lon1, lat2, lon2;
+                valid = cityGraph->getVertexCoordinates(routeStops[i - 1], lat1, lon1) &&
+                        cityGraph->getVertexCoordinates(routeStops[i], lat2, lon2);
+                if (valid) distances[i - 1] = Graph::calculateDistance(lat1, lon1, lat2, lon2);
+            }
+        }
+        
+        if (valid) {
+            addLine("Bus " + bus->getBusNo() + " (" + bus->getCompany() + ")", MODE_BUS,
+                    stops, distances, count, BUS_SPEED, BUS_HEADWAY, BUS_DWELL, 0, true);
+        }
+        
+        delete[] routeStops;
+        delete[] stops;
+        delete[] distances;
+    }
+    
+    delete[] buses;
+}
+
+void JourneyPlanner::addRailLines() {
+    if (railways == nullptr) return;
+    Graph* network = railways->getRailNetwork();
+    int vertexCount = network->getVertexCount();
+    
+    // Every station is a stop, so it can be walked to even without a line
+    for (int i = 0; i < vertexCount; i++) {
+        Vertex* vertex = network->getVertexAt(i);
+        timetable->addStop(vertex->vertexID, vertex->name);
+    }
+    if (vertexCount < 2 || railways->getTrackSegmentCount() == 0) return;
+    
+    // Split the track into lines: walk unused segments from a line end (a station with the
+    // fewest unused segments) until the walk gets stuck, then start the next line
+    bool* used = new bool[vertexCount * vertexCount];
+    int* remaining = new int[vertexCount];
+    int* destinations = new int[vertexCount];
+    double* weights = new double[vertexCount];
+    int* lineStops = new int[railways->getTrackSegmentCount() + 1];
+    double* lineDistances = new double[railways->getTrackSegmentCount() + 1];
+    
+    for (int i = 0; i < vertexCount * vertexCount; i++) used[i] = false;
+    for (int i = 0; i < vertexCount; i++) {
+        int edgeCount = 0;
+        network->getEdgesForVertex(i, destinations, weights, vertexCount, edgeCount);
+        remaining[i] = edgeCount;
+    }
+    
+    int lineNumber = 0;
+    while (true) {
+        int current = -1;
+        for (int i = 0; i < vertexCount; i++) {
+            if (remaining[i] > 0 && (current < 0 || remaining[i] < remaining[current])) current = i;
+        }
+        if (current < 0) break;
+        
+        int count = 0;
+        Vertex* vertex = network->getVertexAt(current);
+        lineStops[count++] = timetable->addStop(vertex->vertexID, vertex->name);
+        
+        while (remaining[current] > 0) {
+            int edgeCount = 0;
+            network->getEdgesForVertex(current, destinations, weights, vertexCount, edgeCount);
+            
+            int next = -1;
+            double distance = 0.0;
+            for (int e = 0; e < edgeCount; e++) {
+                if (!used[current * vertexCount + destinations[e]]) {
+                    next = destinations[e];
+                    distance = weights[e];
+                    break;
+                }
+            }
+            if (next < 0) break;
+            
+            used[current * vertexCount + next] = true;
+            used[next * vertexCount + current] = true;
+            remaining[current]--;
+            remaining[next]--;
+            
+            vertex = network->getVertexAt(next);
+            lineDistances[count - 1] = distance;
+            lineStops[count++] = timetable->addStop(vertex->vertexID, vertex->name);
+            current = next;
+        }
+        
+        lineNumber++;
+        addLine("Rail Line " + to_string(lineNumber), MODE_RAIL, lineStops, lineDistances, count,
+                RAIL_SPEED, RAIL_HEADWAY, RAIL_DWELL, 0, true);
+    }
+    
+    delete[] used;
+    delete[] remaining;
+    delete[] destinations;
+    delete[] weights;
+    delete[] lineStops;
+    delete[] lineDistances;
+}
+
+void JourneyPlanner::addFlightLegs() {
+    if (airports == nullptr) return;
+    Graph* network = airports->getAirNetwork();
+    int vertexCount = network->getVertexCount();
+    
+    // Every airport is a stop, so it can be walked to even without flights
+    for (int i = 0; i < vertexCount; i++) {
+        Vertex* vertex = network->getVertexAt(i);
+        timetable->addStop(vertex->vertexID, vertex->name);
+    }
+    if (vertexCount < 2) return;
+    
+    int* destinations = new int[vertexCount];
+    double* weights = new double[vertexCount];
+    
+    for (int i = 0; i < vertexCount; i++) {
+        int edgeCount = 0;
+        network->getEdgesForVertex(i, destinations, weights, vertexCount, edgeCount);
+        
+        Vertex* from = network->getVertexAt(i);
+        Airport* fromAirport = airports->findAirportByID(from->vertexID);
+        string fromCode = (fromAirport != nullptr) ? fromAirport->getCode() : from->vertexID;
+        
+        for (int e = 0; e < edgeCount; e++) {
+            Vertex* to = network->getVertexAt(destinations[e]);
+            Airport* toAirport = airports->findAirportByID(to->vertexID);
+            string toCode = (toAirport != nullptr) ? toAirport->getCode() : to->vertexID;
+            
+            int stops[2];
+            stops[0] = timetable->addStop(from->vertexID, from->name);
+            stops[1] = timetable->addStop(to->vertexID, to->name);
+            addLine("Flight " + fromCode + " -> " + toCode, MODE_AIR, stops, &weights[e], 2,
+                    AIR_SPEED, AIR_HEADWAY, 0, AIR_TAXI_MINUTES, false);
+        }
+    }
+    
+    delete[] destinations;
+    delete[] weights;
+}
+
+void JourneyPlanner::addTransfers(const TransferTable* transfers, int minutesIn, int minutesOut) {
+    if (transfers == nullptr) return;
+    
+    for (int slot = 0; slot < transfers->getNodeCount(); slot++) {
+        int node = timetable->findStop(transfers->getNodeID(slot));
+        if (node < 0) continue;
+        
+        const string* stops = nullptr;
+        const double* walks = nullptr;
+        int count = transfers->getTransfersAt(slot, stops, walks);
+        for (int i = 0; i < count; i++) {
+            int stop = addCityStop(stops[i]);
+            int walk = travelMinutes(walks[i], WALK_SPEED);
+            timetable->addFootpath(stop, node, walk + minutesIn);
+            timetable->addFootpath(node, stop, walk + minutesOut);
+        }
+        if (count > 0) continue;
+        
+        // No stop in walking range: a taxi to the nearest stop instead of a long walk
+        string accessStop;
+        double distance = 0.0;
+        if (transfers->getAccessStopAt(slot, accessStop, distance)) {
+            int stop = addCityStop(accessStop);
+            int ride = travelMinutes(distance, ACCESS_SPEED) + ACCESS_WAIT_MINUTES;
+            timetable->addFootpath(stop, node, ride + minutesIn, JourneyLeg::ACCESS);
+            timetable->addFootpath(node, stop, ride + minutesOut, JourneyLeg::ACCESS);
+        }
+    }
+}
+
+void JourneyPlanner::addStopFootpaths() {
+    Graph* cityGraph = (transport != nullptr) ? transport->getCityGraph() : nullptr;
+    if (cityGraph == nullptr) return;
+    
+    // Sort the stops by latitude
+    int vertexCount = cityGraph->getVertexCount();
+    if (vertexCount < 2) return;
+    MinHeap latitudeHeap(vertexCount);
+    for (int i = 0; i < vertexCount; i++) {
+        Vertex* vertex = cityGraph->getVertexAt(i);
+        if (vertex == nullptr || vertex->vertexID.compare(0, 4, "Stop") != 0) continue;
+        latitudeHeap.insert(vertex->vertexID, vertex->latitude, vertex);
+    }
+    
+    Vertex** sorted = new Vertex*[vertexCount];
+    int stopCount = 0;
+    while (!latitudeHeap.isEmpty()) {
+        sorted[stopCount++] = (Vertex*)latitudeHeap.extractMin().data;
+    }
+    
+    // Stops further apart in latitude than the walking range cannot be within it,
+    // so each stop is only measured against the stops after it inside that band
+    static const double KM_PER_DEGREE = 111.195;
+    double band = STOP_WALK_DISTANCE / KM_PER_DEGREE;
+    for (int i = 0; i < stopCount; i++) {
+        Vertex* a = sorted[i];
+        for (int j = i + 1; j < stopCount && sorted[j]->latitude - a->latitude <= band; j++) {
+            Vertex* b = sorted[j];
+            double distance = Graph::calculateDistance(a->latitude, a->longitude, b->latitude, b->longitude);
+            if (distance > STOP_WALK_DISTANCE) continue;
+            
+            int from = timetable->addStop(a->vertexID, a->name);
+            int to = timetable->addStop(b->vertexID, b->name);
+            int walk = travelMinutes(distance, WALK_SPEED);
+            timetable->addFootpath(from, to, walk);
+            timetable->addFootpath(to, from, walk);
+        }
+    }
+    
+    delete[] sorted;
+}
+
+void JourneyPlanner::rebuild() {
+    timetable->clear();
+    
+    addBusRoutes();
+    addRailLines();
+    addFlightLegs();
+    if (railways != nullptr) addTransfers(railways->getTransfers(), 0, 0);
+    if (airports != nullptr) addTransfers(airports->getTransfers(), CHECK_IN_MINUTES, AIRPORT_EXIT_MINUTES);
+    addStopFootpaths();
+    
+    Graph* cityGraph = (transport != nullptr) ? transport->getCityGraph() : nullptr;
+    builtRouteVersion = (transport != nullptr) ? transport->getRouteVersion() : 0;
+    builtCityVersion = (cityGraph != nullptr) ? cityGraph->getVersion() : 0;
+    builtRailVersion = (railways != nullptr) ? railways->getRailNetwork()->getVersion() : 0;
+    builtAirVersion = (airports != nullptr) ? airports->getAirNetwork()->getVersion() : 0;
+    built = true;
+}
+
+Journey* JourneyPlanner::planJourney(const string& fromID, const string& toID, int departureMinutes) {
+    if (departureMinutes < 0) return nullptr;
+    if (isStale()) rebuild();
+    
+    int source = timetable->findStop(fromID);
+    int target = timetable->findStop(toID);
+    if (source < 0 || target < 0) return nullptr;
+    
+    return timetable->earliestArrival(source, target, departureMinutes);
+}
+
+void JourneyPlanner::displayJourney(const Journey* journey) {
+    if (journey == nullptr) return;
+    
+    cout << "Depart " << formatTime(journey->departure) << ", arrive " << formatTime(journey->arrival)
+         << " (" << (journey->arrival - journey->departure) << " min, "
+         << journey->rides << " ride(s))" << endl;
+    
+    for (int i = 0; i < journey->legCount; i++) {
+        const JourneyLeg& leg = journey->legs[i];
+        cout << "  [" << (i + 1) << "] " << formatTime(leg.departure) << " - " << formatTime(leg.arrival) << "  ";
+        if (leg.route == JourneyLeg::WALK) {
+            cout << "Walk";
+        } else if (leg.route == JourneyLeg::ACCESS) {
+            cout << "Taxi";
+        } else {
+            cout << timetable->getRouteName(leg.route);
+        }
+        cout << ": " << timetable->getStopName(leg.fromStop) << " (" << timetable->getStopID(leg.fromStop) << ")"
+             << " -> " << timetable->getStopName(leg.toStop) << " (" << timetable->getStopID(leg.toStop) << ")";
+        if (leg.route == JourneyLeg::WALK || leg.route == JourneyLeg::ACCESS) {
+            cout << " [" << (leg.arrival - leg.departure) << " min]";
+        }
+        cout << endl;
+    }
+}
+
+const Timetable* JourneyPlanner::getTimetable() {
+    if (isStale()) rebuild();
+    return timetable;
+}
+
+string JourneyPlanner::formatTime(int minutes) {
+    if (minutes < 0) return "--:--";
+    
+    int days = minutes / (24 * 60);
+    int hours = (minutes / 60) % 24;
+    int mins = minutes % 60;
+    
+    string text;
+    text += (char)('0' + hours / 10);
+    text += (char)('0' + hours % 10);
+    text += ':';
+    text += (char)('0' + mins / 10);
+    text += (char)('0' + mins % 10);
+    if (days > 0) text += " +" + to_string(days) + "d";
+    return text;
+}
+
+int JourneyPlanner::parseTime(const string& text) {
+    size_t colon = text.find(':');
+    if (colon == string::npos || colon == 0 || colon > 2 || text.length() != colon + 3) return -1;
+    
+    int hours = 0;
+    for (size_t i = 0; i < colon; i++) {
+        if (text[i] < '0' || text[i] > '9') return -1;
+        hours = hours * 10 + (text[i] - '0');
+    }
+    if (text[colon + 1] < '0' || text[colon + 1] > '9' || text[colon + 2] < '0' || text[colon + 2] > '9') return -1;
+    int mins = (text[colon + 1] - '0') * 10 + (text[colon + 2] - '0');
+    
+    if (hours > 23 || mins > 59) return -1;
+    return hours * 60 + mins;
+}
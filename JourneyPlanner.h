@@ -0,0 +1,123 @@
+#ifndef JOURNEYPLANNER_H
+#define JOURNEYPLANNER_H
+
+#include <string>
+#include "core_classes/Graph.h"
+#include "core_classes/Timetable.h"
+#include "TransportManager.h"
+#include "RailwayManager.h"
+#include "AirportManager.h"
+using namespace std;
+
+// JourneyPlanner class - Multimodal (bus / rail / air) earliest-arrival journey planning
+// Used for: Cross-module trip planning between any bus stop, railway station or airport
+// The three networks are compiled into one Timetable: every public bus route (both
+// directions), every rail line (track split into lines, both directions) and every flight
+// leg becomes a route with trips at a fixed headway over the service day, and the
+// station / airport → bus stop transfer tables become walking footpaths (or a taxi access
+// link to the nearest stop when none is in walking range). Queries run RAPTOR over that
+// timetable. The dataset has no published schedules, so travel times come from distances and
+// mode speeds; the timetable is rebuilt whenever a network's version counter changes.
+class JourneyPlanner {
+private:
+    TransportManager* transport;      // Bus routes and the city graph (stops, roads)
+    RailwayManager* railways;         // Stations and the rail network
+    AirportManager* airports;         // Airports and the air network
+    Timetable* timetable;             // Compiled routes, trips and footpaths
+    
+    // Network versions the timetable was built from (a change triggers a rebuild)
+    int builtRouteVersion;            // TransportManager::getRouteVersion
+    int builtCityVersion;             // City graph
+    int builtRailVersion;             // Rail network graph
+    int builtAirVersion;              // Air network graph
+    bool built;
+    
+    // True if any network changed since the last build
+    bool isStale() const;
+    
+    // Add trips every headway minutes between SERVICE_START and SERVICE_END
+    // Parameters: hops - minutes from each stop to the next, dwell - minutes stopped at intermediate stops,
+    //             offset - first departure after SERVICE_START (staggers routes sharing stops)
+    void addTrips(int route, const int* hops, int stopCount, int headway, int dwell, int offset);
+    
+    // Add a route and its reverse with trips
+    // Parameters: stops - timetable stop indexes, distances - km from each stop to the next
+    void addLine(const string& name, int mode, const int* stops, const double* distances, int count,
+                 double speed, int headway, int dwell, int extraMinutes, bool bothWays);
+    
+    // Compile each network into the timetable
+    void addBusRoutes();
+    void addRailLines();
+    void addFlightLegs();
+    void addTransfers(const TransferTable* transfers, int minutesIn, int minutesOut);
+    
+    // Footpaths between bus stops closer than STOP_WALK_DISTANCE
+    // Stops are sorted by latitude and only pairs inside the latitude band are measured
+    // Complexity: O(V log V + P) where P is pairs of stops within the band
+    void addStopFootpaths();
+    
+    // Timetable stop for a city graph stop (name from the graph, hashed lookup)
+    int addCityStop(const string& stopID);
+    
+    // Helper: minutes to cover distance (km) at speed (km/h), at least 1
+    static int travelMinutes(double distance, double speed);
+
+public:
+    static const int MODE_BUS = 0;
+    static const int MODE_RAIL = 1;
+    static const int MODE_AIR = 2;
+    
+    static const int SERVICE_START = 6 * 60;     // First departures (minutes after midnight)
+    static const int SERVICE_END = 23 * 60;      // No departures from the first stop after this
+    static const int BUS_HEADWAY = 10;           // Minutes between trips of a route
+    static const int RAIL_HEADWAY = 20;
+    static const int AIR_HEADWAY = 120;
+    static const int BUS_DWELL = 1;              // Minutes stopped at an intermediate stop
+    static const int RAIL_DWELL = 2;
+    static const int AIR_TAXI_MINUTES = 30;      // Added to every flight (taxi, take-off, landing)
+    static const int CHECK_IN_MINUTES = 45;      // Walking into an airport before a flight
+    static const int AIRPORT_EXIT_MINUTES = 15;  // Leaving an airport after landing
+    static const int ACCESS_WAIT_MINUTES = 10;   // Waiting for a taxi on an access link
+    
+    static const double BUS_SPEED;               // 22 km/h average including traffic
+    static const double RAIL_SPEED;              // 60 km/h
+    static const double AIR_SPEED;               // 700 km/h
+    static const double WALK_SPEED;              // 4.8 km/h
+    static const double ACCESS_SPEED;            // 30 km/h, taxi to the nearest stop beyond walking range
+    static const double STOP_WALK_DISTANCE;      // 1.0 km, bus stops closer than this get a footpath
+    
+    // Constructor
+    // Parameters: transport, railways, airports - managers to plan over (any may be nullptr)
+    JourneyPlanner(TransportManager* transport, RailwayManager* railways, AirportManager* airports);
+    
+    // Destructor
+    ~JourneyPlanner();
+    
+    // Recompile the timetable from the managers
+    // Complexity: O(B × L × T + R × S^2 + V log V + P) where B is bus routes of length L with
+    //             T trips, R stations with S stops in the city graph, V stops and P nearby stop pairs
+    void rebuild();
+    
+    // Plan the earliest-arrival journey between two places
+    // Parameters: fromID, toID - bus stop, railway station or airport IDs,
+    //             departureMinutes - leave at or after this time (minutes after midnight)
+    // Returns: New Journey (caller must delete), nullptr if a place is unknown or unreachable
+    // Note: Rebuilds the timetable first if a network changed
+    // Complexity: O(K × (R × T + F log S)), see Timetable::earliestArrival
+    Journey* planJourney(const string& fromID, const string& toID, int departureMinutes);
+    
+    // Print a journey leg by leg
+    void displayJourney(const Journey* journey);
+    
+    // Get the compiled timetable (rebuilt first if a network changed)
+    const Timetable* getTimetable();
+    
+    // Format minutes after midnight as "HH:MM" ("+1d" appended past midnight)
+    static string formatTime(int minutes);
+    
+    // Parse "HH:MM" (or "H:MM")
+    // Returns: minutes after midnight, -1 if invalid
+    static int parseTime(const string& text);
+};
+
+#endif // JOURNEYPLANNER_H
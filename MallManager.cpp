@@ -1,14 +1,77 @@
 #include "MallManager.h"
+#include "core_classes/SectorGazetteer.h"
 #include <iostream>
+#include <cmath>
 using namespace std;
 
+// CategoryProductList Implementation
+CategoryProductList::CategoryProductList(const string& cat) : category(cat), count(0), capacity(8) {
+    products = new Product*[capacity];
+    prices = new double[capacity];
+}
+
+CategoryProductList::~CategoryProductList() {
+    delete[] products;
+    delete[] prices;
+    products = nullptr;
+    prices = nullptr;
+}
+
+int CategoryProductList::lowerBound(double price) const {
+    int low = 0;
+    int high = count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (prices[mid] < price) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void CategoryProductList::insertByPrice(Product* product) {
+    if (count >= capacity) {
+        int newCapacity = capacity * 2;
+        Product** newProducts = new Product*[newCapacity];
+        double* newPrices = new double[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newProducts[i] = products[i];
+            newPrices[i] = prices[i];
+        }
+        delete[] products;
+        delete[] prices;
+        products = newProducts;
+        prices = newPrices;
+        capacity = newCapacity;
+    }
+    
+    // Upper bound: equal prices keep insertion order
+    double price = product->getPrice();
+    int position = lowerBound(price);
+    while (position < count && prices[position] == price) {
+        position++;
+    }
+    
+    for (int i = count; i > position; i--) {
+        products[i] = products[i - 1];
+        prices[i] = prices[i - 1];
+    }
+    products[position] = product;
+    prices[position] = price;
+    count++;
+}
+
 // Constructor
 MallManager::MallManager(Graph* graph)
-    : cityGraph(graph), mallCount(0) {
+    : cityGraph(graph), categoryListCount(0), categoryListCapacity(16), mallCount(0) {
     mallsByID = new HashTable(101);
     mallsByName = new HashTable(101);
     allMallsList = new SinglyLinkedList();
-    globalProductsByName = new HashTable(503); // Larger size for global product search
+    productNameIndex = new PrefixTrie(256);
+    productsByCategory = new HashTable(101);
+    categoryLists = new CategoryProductList*[categoryListCapacity];
 }
 
 // Destructor
@@ -28,9 +91,17 @@ MallManager::~MallManager() {
         delete allMallsList;
         allMallsList = nullptr;
     }
-    if (globalProductsByName != nullptr) {
-        delete globalProductsByName;
-        globalProductsByName = nullptr;
+    if (productNameIndex != nullptr) {
+        delete productNameIndex;
+        productNameIndex = nullptr;
+    }
+    if (productsByCategory != nullptr) {
+        delete productsByCategory;
+        productsByCategory = nullptr;
+    }
+    if (categoryLists != nullptr) {
+        delete[] categoryLists;
+        categoryLists = nullptr;
     }
 }
 
@@ -69,6 +140,30 @@ void MallManager::getAllMalls(Mall** malls, int& count) const {
     delete[] mallIDs;
 }
 
+// Helper function to get a category's list, creating it if new
+CategoryProductList* MallManager::getOrCreateCategoryList(const string& category) {
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    if (list != nullptr) {
+        return list;
+    }
+    
+    if (categoryListCount >= categoryListCapacity) {
+        int newCapacity = categoryListCapacity * 2;
+        CategoryProductList** newLists = new CategoryProductList*[newCapacity];
+        for (int i = 0; i < categoryListCount; i++) {
+            newLists[i] = categoryLists[i];
+        }
+        delete[] categoryLists;
+        categoryLists = newLists;
+        categoryListCapacity = newCapacity;
+    }
+    
+    list = new CategoryProductList(category);
+    categoryLists[categoryListCount++] = list;
+    productsByCategory->insert(category, (void*)list);
+    return list;
+}
+
 // Add a mall to the manager
 bool MallManager::addMall(Mall* mall) {
     if (mall == nullptr) return false;
@@ -153,8 +248,13 @@ bool MallManager::addProductToMall(const string& mallID, Product* product) {
         return false; // Product already exists in mall
     }
     
-    // Also add to global products hash table for cross-mall search
-    globalProductsByName->insert(product->getName(), (void*)product);
+    // Also add to the product name index for cross-mall search
+    productNameIndex->insert(product->getName(), (void*)product);
+    
+    // And to the city-wide category index
+    if (!product->getCategory().empty()) {
+        getOrCreateCategoryList(product->getCategory())->insertByPrice(product);
+    }
     
     return true;
 }
@@ -173,11 +273,111 @@ Product* MallManager::findProductInMall(const string& mallID, const string& prod
 Product* MallManager::findProductAnywhere(const string& productName) {
     if (productName.empty()) return nullptr;
     
-    void* data = globalProductsByName->search(productName);
-    if (data != nullptr) {
-        return (Product*)data;
+    int count = 0;
+    Product** offerings = findProductEverywhere(productName, count);
+    if (offerings == nullptr) return nullptr;
+    
+    Product* cheapest = offerings[0];
+    delete[] offerings;
+    return cheapest;
+}
+
+// Find every mall's offering of a product
+Product** MallManager::findProductEverywhere(const string& productName, int& count) {
+    count = 0;
+    if (productName.empty()) return nullptr;
+    
+    // The full name is a prefix of itself; keep only exact names
+    int matchCount = 0;
+    void** matches = productNameIndex->findPrefix(productName, matchCount);
+    if (matches == nullptr) return nullptr;
+    
+    Product** exact = new Product*[matchCount];
+    for (int i = 0; i < matchCount; i++) {
+        Product* product = (Product*)matches[i];
+        if (product->getName() == productName) {
+            exact[count++] = product;
+        }
     }
-    return nullptr;
+    delete[] matches;
+    
+    if (count == 0) {
+        delete[] exact;
+        return nullptr;
+    }
+    
+    Product** ranked = rankProducts(exact, count, "");
+    delete[] exact;
+    return ranked;
+}
+
+// Search products by partial name
+Product** MallManager::searchProducts(const string& query, int& count, const string& fromStopID, int maxTypos) {
+    count = 0;
+    if (query.empty()) return nullptr;
+    
+    int matchCount = 0;
+    void** matches = productNameIndex->findPrefix(query, matchCount);
+    if (matches == nullptr && maxTypos > 0) {
+        matches = productNameIndex->findFuzzy(query, maxTypos, matchCount);
+    }
+    if (matches == nullptr) return nullptr;
+    
+    Product** ranked = rankProducts((Product**)matches, matchCount, fromStopID);
+    delete[] matches;
+    count = matchCount;
+    return ranked;
+}
+
+// Helper function to order products by price or by road distance
+Product** MallManager::rankProducts(Product** products, int count, const string& fromStopID) const {
+    // Cheapest first
+    MinHeap priceHeap(count);
+    for (int i = 0; i < count; i++) {
+        priceHeap.insert(products[i]->getProductID(), products[i]->getPrice(), products[i]);
+    }
+    Product** byPrice = new Product*[count];
+    int sorted = 0;
+    while (!priceHeap.isEmpty() && sorted < count) {
+        byPrice[sorted++] = (Product*)priceHeap.extractMin().data;
+    }
+    
+    if (fromStopID.empty() || cityGraph == nullptr) {
+        return byPrice;
+    }
+    
+    // Nearest mall first with one bounded search from the stop; equal distances keep price order
+    string* mallVertices = new string[count];
+    for (int i = 0; i < count; i++) {
+        Mall* mall = findMallByID(byPrice[i]->getMallID());
+        mallVertices[i] = (mall != nullptr) ? mall->getVertexID() : "";
+    }
+    int* found = new int[count];
+    double* distances = new double[count];
+    int foundCount = cityGraph->findNearestTargets(fromStopID, mallVertices, count, count, found, distances);
+    
+    Product** byDistance = new Product*[count];
+    bool* placed = new bool[count];
+    for (int i = 0; i < count; i++) {
+        placed[i] = false;
+    }
+    int next = 0;
+    for (int i = 0; i < foundCount; i++) {
+        byDistance[next++] = byPrice[found[i]];
+        placed[found[i]] = true;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!placed[i]) {
+            byDistance[next++] = byPrice[i];
+        }
+    }
+    
+    delete[] mallVertices;
+    delete[] found;
+    delete[] distances;
+    delete[] placed;
+    delete[] byPrice;
+    return byDistance;
 }
 
 // Find all products in a specific category across all malls
@@ -185,26 +385,105 @@ void MallManager::findProductsByCategory(const string& category, Product** resul
     count = 0;
     if (results == nullptr || category.empty()) return;
     
-    // Get all malls
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    if (list == nullptr) return;
+    
+    for (int i = 0; i < list->count; i++) {
+        results[count++] = list->products[i];
+    }
+}
+
+// Get the number of products in a category across all malls
+int MallManager::getCategoryProductCount(const string& category) const {
+    if (category.empty()) return 0;
+    
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    return (list != nullptr) ? list->count : 0;
+}
+
+// Get one page of a category's products
+Product** MallManager::getProductsByCategory(const string& category, int offset, int limit, int& count) const {
+    count = 0;
+    if (category.empty() || offset < 0) return nullptr;
+    
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    if (list == nullptr || offset >= list->count) return nullptr;
+    
+    int available = list->count - offset;
+    count = (limit > 0 && limit < available) ? limit : available;
+    Product** result = new Product*[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = list->products[offset + i];
+    }
+    return result;
+}
+
+// Find a category's products within a price range
+Product** MallManager::findProductsByCategoryInPriceRange(const string& category, double minPrice, double maxPrice,
+                                                          int& count) const {
+    count = 0;
+    if (category.empty() || minPrice > maxPrice) return nullptr;
+    
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    if (list == nullptr) return nullptr;
+    
+    int start = list->lowerBound(minPrice);
+    int end = start;
+    while (end < list->count && list->prices[end] <= maxPrice) {
+        end++;
+    }
+    if (end == start) return nullptr;
+    
+    count = end - start;
+    Product** result = new Product*[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = list->products[start + i];
+    }
+    return result;
+}
+
+// Find the cheapest products of a category near a location
+Product** MallManager::findCheapestProductsNear(const string& category, double latitude, double longitude,
+                                                double radiusKm, int k, int& count) const {
+    count = 0;
+    if (category.empty() || k <= 0 || radiusKm < 0.0 || mallCount == 0) return nullptr;
+    
+    CategoryProductList* list = (CategoryProductList*)productsByCategory->search(category);
+    if (list == nullptr) return nullptr;
+    
+    // Work out once which malls are in range (key = mallID, value = Mall*)
+    HashTable nearbyMalls(101);
     Mall** malls = new Mall*[mallCount];
-    int mallCountActual = 0;
-    getAllMalls(malls, mallCountActual);
+    int mallsFound = 0;
+    getAllMalls(malls, mallsFound);
+    for (int i = 0; i < mallsFound; i++) {
+        double mallLat, mallLon;
+        if (cityGraph == nullptr || !cityGraph->getVertexCoordinates(malls[i]->getVertexID(), mallLat, mallLon)) {
+            // Not on the map: fall back to the sector centroid (skip malls in an unknown sector)
+            if (!SectorGazetteer::getShared()->getCoordinates(malls[i]->getSector(), mallLat, mallLon)) {
+                continue;
+            }
+        }
+        if (Graph::calculateDistance(latitude, longitude, mallLat, mallLon) <= radiusKm) {
+            nearbyMalls.insert(malls[i]->getMallID(), (void*)malls[i]);
+        }
+    }
+    delete[] malls;
     
-    // Search each mall for products in the category
-    for (int i = 0; i < mallCountActual; i++) {
-        Product* mallResults[100]; // Temporary array for each mall's results
-        int mallResultCount = 0;
-        
-        malls[i]->findProductsByCategory(category, mallResults, mallResultCount);
-        
-        // Add to overall results
-        for (int j = 0; j < mallResultCount; j++) {
-            results[count] = mallResults[j];
-            count++;
+    // Walk the category cheapest first and stop at k
+    int resultSize = (k < list->count) ? k : list->count;
+    Product** result = new Product*[resultSize];
+    for (int i = 0; i < list->count && count < resultSize; i++) {
+        if (nearbyMalls.search(list->products[i]->getMallID()) != nullptr) {
+            result[count++] = list->products[i];
         }
     }
     
-    delete[] malls;
+    if (count == 0) {
+        delete[] result;
+        return nullptr;
+    }
+    return result;
 }
 
 // Find nearest mall to a given stop ID
@@ -295,6 +574,46 @@ Mall* MallManager::findNearestMall(double latitude, double longitude) {
     return nearestMall;
 }
 
+// Build a query table of every product
+QueryTable* MallManager::buildProductView() const {
+    QueryTable* view = new QueryTable("Products");
+    int mallColumn = view->addCategoryColumn("Mall");
+    int sectorColumn = view->addCategoryColumn("Sector");
+    int categoryColumn = view->addCategoryColumn("Category");
+    int productColumn = view->addCategoryColumn("Product");
+    int priceColumn = view->addNumberColumn("Price");
+    if (mallCount == 0) return view;
+    
+    Mall** malls = new Mall*[mallCount];
+    int count = 0;
+    getAllMalls(malls, count);
+    
+    for (int i = 0; i < count; i++) {
+        Mall* mall = malls[i];
+        int productCount = mall->getProductCount();
+        if (productCount == 0) continue;
+        
+        string* names = new string[productCount];
+        int nameCount = 0;
+        mall->getAllProductNames(names, nameCount);
+        for (int j = 0; j < nameCount; j++) {
+            Product* product = mall->findProduct(names[j]);
+            if (product == nullptr) continue;
+            
+            int row = view->addRow();
+            view->setCategory(row, mallColumn, mall->getName());
+            view->setCategory(row, sectorColumn, mall->getSector());
+            view->setCategory(row, categoryColumn, product->getCategory());
+            view->setCategory(row, productColumn, product->getName());
+            view->setNumber(row, priceColumn, product->getPrice());
+        }
+        delete[] names;
+    }
+    
+    delete[] malls;
+    return view;
+}
+
 // Helper function to parse coordinates from string "lat, lon"
 static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     if (coordStr.empty()) return false;
@@ -505,8 +824,17 @@ void MallManager::clear() {
     if (allMallsList != nullptr) {
         allMallsList->clear();
     }
-    if (globalProductsByName != nullptr) {
-        globalProductsByName->clear();
+    if (productNameIndex != nullptr) {
+        productNameIndex->clear();
+    }
+    
+    // Clear the category index
+    for (int i = 0; i < categoryListCount; i++) {
+        delete categoryLists[i];
+    }
+    categoryListCount = 0;
+    if (productsByCategory != nullptr) {
+        productsByCategory->clear();
     }
     
     mallCount = 0;
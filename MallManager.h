@@ -5,11 +5,35 @@
 #include "core_classes/Graph.h"
 #include "core_classes/HashTable.h"
 #include "core_classes/SinglyLinkedList.h"
+#include "core_classes/MinHeap.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/PrefixTrie.h"
+#include "core_classes/QueryTable.h"
 #include "Mall.h"
 #include "Product.h"
 using namespace std;
 
+// Structure for the products of one category across all malls, kept sorted by price
+// prices[] mirrors products[] so price scans and binary searches stay in one array
+struct CategoryProductList {
+    string category;          // Category as written in the data (e.g., "Electronics")
+    Product** products;       // Products sorted by price, cheapest first (not owned)
+    double* prices;           // Price column aligned with products
+    int count;                // Number of products in the list
+    int capacity;             // Allocated size of both arrays
+    
+    CategoryProductList(const string& cat);
+    ~CategoryProductList();
+    
+    // Index of the first product priced at or above price
+    // Complexity: O(log n)
+    int lowerBound(double price) const;
+    
+    // Insert a product after every product priced at or below it
+    // Complexity: O(log n + n) - binary search, then shift
+    void insertByPrice(Product* product);
+};
+
 // MallManager class - Central manager for all malls and commercial operations
 // Used for: Commercial sector management, mall operations, product searches, nearest mall queries
 class MallManager {
@@ -18,12 +42,24 @@ private:
     HashTable* mallsByName;            // Hash table for mall lookup by name (key = mall name, value = Mall*)
     SinglyLinkedList* allMallsList;    // Linked list to track all malls for iteration (stores mallID)
     Graph* cityGraph;                  // Pointer to shared city graph (for nearest mall queries)
-    HashTable* globalProductsByName;    // Global hash table for cross-mall product search (key = product name, value = Product*)
+    PrefixTrie* productNameIndex;       // Word-prefix index over product names across all malls (value = Product*)
+    HashTable* productsByCategory;     // City-wide category index (key = category, value = CategoryProductList*)
+    CategoryProductList** categoryLists; // Owned category lists (for cleanup)
+    int categoryListCount;
+    int categoryListCapacity;
     int mallCount;                     // Current number of malls
     
     // Helper function to get all malls as array
     void getAllMalls(Mall** malls, int& count) const;
     
+    // Helper function to get a category's list, creating it if new
+    CategoryProductList* getOrCreateCategoryList(const string& category);
+    
+    // Helper function to order products cheapest first, or nearest to fromStopID first
+    // (by road distance to the product's mall; unreachable malls follow, cheapest first)
+    // Returns: New array (caller must delete[]); products array is left unchanged
+    Product** rankProducts(Product** products, int count, const string& fromStopID) const;
+    
 public:
     // Constructor
     // Parameters: graph - pointer to shared city graph
@@ -67,14 +103,52 @@ public:
     Product* findProductInMall(const string& mallID, const string& productName);
     
     // Find a product anywhere (searches all malls)
-    // Returns: Pointer to Product if found, nullptr otherwise
+    // Returns: Pointer to the cheapest offering if several malls sell it, nullptr otherwise
     Product* findProductAnywhere(const string& productName);
     
-    // Find all products in a specific category across all malls
+    // Find every mall's offering of a product (exact name)
+    // Returns: Array of Product pointers, cheapest first (caller must delete[]), nullptr if none
+    // Complexity: O(L + s) trie lookup + O(r log r) ranking
+    Product** findProductEverywhere(const string& productName, int& count);
+    
+    // Search products by partial name (any word prefix, e.g., "lap" or "led tv")
+    // Falls back to a typo-tolerant search (up to maxTypos edits) if nothing matches exactly
+    // Parameters: query, count (output), fromStopID (rank by road distance from this stop,
+    //             empty to rank by price), maxTypos
+    // Returns: Array of Product pointers (caller must delete[]), nullptr if none
+    // Complexity: O(L + s) trie search + O(r log r) price ranking (+ one bounded Dijkstra for distance)
+    Product** searchProducts(const string& query, int& count, const string& fromStopID = "", int maxTypos = 1);
+    
+    // Find all products in a specific category across all malls, cheapest first
     // Parameters: category, results array (output), count (output)
-    // Note: Caller must allocate results array with sufficient size
+    // Note: Caller must allocate results array with getCategoryProductCount(category) entries
+    // Complexity: O(1) average lookup + O(p) copy
     void findProductsByCategory(const string& category, Product** results, int& count);
     
+    // Get the number of products in a category across all malls
+    // Complexity: O(1) average
+    int getCategoryProductCount(const string& category) const;
+    
+    // Get one page of a category's products, cheapest first
+    // Parameters: category, offset (first product to return), limit (page size, <= 0 for all), count (output)
+    // Returns: Array of Product pointers (caller must delete[]), nullptr if the page is empty
+    // Complexity: O(1) average lookup + O(page size)
+    Product** getProductsByCategory(const string& category, int offset, int limit, int& count) const;
+    
+    // Find a category's products priced within [minPrice, maxPrice], cheapest first
+    // Returns: Array of Product pointers (caller must delete[]), nullptr if none
+    // Complexity: O(log p + r) where r is number of results
+    Product** findProductsByCategoryInPriceRange(const string& category, double minPrice, double maxPrice,
+                                                 int& count) const;
+    
+    // Find the cheapest products of a category in malls within radiusKm of a location
+    // Parameters: category, latitude, longitude, radiusKm, k (max results), count (output)
+    // Returns: Array of Product pointers, cheapest first (caller must delete[]), nullptr if none
+    // Note: Malls off the map are placed at their sector centroid; malls in an unknown sector are skipped
+    // Complexity: O(m + p) worst case - mall distances once, then a price-ordered scan that stops at k
+    Product** findCheapestProductsNear(const string& category, double latitude, double longitude,
+                                       double radiusKm, int k, int& count) const;
+    
     // Nearest mall queries
     // Find nearest mall to a given stop ID
     // Returns: Pointer to nearest Mall, nullptr if no malls or graph unavailable
@@ -84,6 +158,11 @@ public:
     // Returns: Pointer to nearest Mall, nullptr if no malls or graph unavailable
     Mall* findNearestMall(double latitude, double longitude);
     
+    // Build a query table of every product (columns: Mall, Sector, Category, Product, Price)
+    // Returns: New QueryTable (caller must delete)
+    // Complexity: O(p) where p is total number of products
+    QueryTable* buildProductView() const;
+    
     // CSV data loading (stubs for DataLoader integration)
     // Load malls from CSV data
     // Parameters: mallData - array of CSVRow from DataLoader, mallCount - number of rows
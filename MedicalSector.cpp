@@ -2,44 +2,80 @@
 #include <iostream>
 using namespace std;
 
-// Helper function to get approximate coordinates for Islamabad sectors
-void MedicalSector::getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
-    // Base coordinates for Islamabad (approximate center)
-    double baseLat = 33.684;
-    double baseLon = 73.047;
-    
-    // Default to base coordinates
-    latitude = baseLat;
-    longitude = baseLon;
-    
-    // Map common sectors to approximate coordinates (Islamabad layout)
-    if (sector == "G-10" || sector == "G10") {
-        latitude = 33.684; longitude = 73.025;
-    } else if (sector == "F-8" || sector == "F8") {
-        latitude = 33.700; longitude = 73.037;
-    } else if (sector == "F-6" || sector == "F6") {
-        latitude = 33.715; longitude = 73.045;
-    } else if (sector == "G-9" || sector == "G9") {
-        latitude = 33.690; longitude = 73.030;
-    } else if (sector == "F-7" || sector == "F7") {
-        latitude = 33.707; longitude = 73.040;
-    } else if (sector == "G-8" || sector == "G8") {
-        latitude = 33.694; longitude = 73.032;
-    } else if (sector == "H-8" || sector == "H8") {
-        latitude = 33.710; longitude = 73.042;
-    } else if (sector == "I-8" || sector == "I8") {
-        latitude = 33.720; longitude = 73.048;
-    } else if (sector == "G-6" || sector == "G6") {
-        latitude = 33.709; longitude = 73.044;
-    } else if (sector == "F-10" || sector == "F10") {
-        latitude = 33.705; longitude = 73.038;
-    } else if (sector == "Blue Area") {
-        latitude = 33.697; longitude = 73.039;
-    } else {
-        // For unknown sectors, use base coordinates
-        latitude = baseLat;
-        longitude = baseLon;
+// MedicineStockEntry Implementation
+MedicineStockEntry::MedicineStockEntry() : pharmacy(nullptr), medicineName(""), price(0.0) {
+}
+
+// MedicinePostingList Implementation
+MedicinePostingList::MedicinePostingList(const string& k) : key(k), count(0), capacity(4) {
+    entries = new MedicineStockEntry[capacity];
+}
+
+MedicinePostingList::~MedicinePostingList() {
+    delete[] entries;
+    entries = nullptr;
+    count = 0;
+}
+
+int MedicinePostingList::findEntry(Pharmacy* pharmacy, const string& medicineName) const {
+    for (int i = 0; i < count; i++) {
+        if (entries[i].pharmacy == pharmacy && entries[i].medicineName == medicineName) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void MedicinePostingList::addOrUpdate(Pharmacy* pharmacy, const string& medicineName, double price) {
+    remove(pharmacy, medicineName);
+    
+    if (count >= capacity) {
+        int newCapacity = capacity * 2;
+        MedicineStockEntry* newEntries = new MedicineStockEntry[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newEntries[i].pharmacy = entries[i].pharmacy;
+            newEntries[i].medicineName.swap(entries[i].medicineName);
+            newEntries[i].price = entries[i].price;
+        }
+        delete[] entries;
+        entries = newEntries;
+        capacity = newCapacity;
+    }
+    
+    // Shift pricier entries right to keep the list sorted (equal prices keep insertion order)
+    int pos = count;
+    while (pos > 0 && entries[pos - 1].price > price) {
+        entries[pos].pharmacy = entries[pos - 1].pharmacy;
+        entries[pos].medicineName.swap(entries[pos - 1].medicineName);
+        entries[pos].price = entries[pos - 1].price;
+        pos--;
+    }
+    entries[pos].pharmacy = pharmacy;
+    entries[pos].medicineName = medicineName;
+    entries[pos].price = price;
+    count++;
+}
+
+bool MedicinePostingList::remove(Pharmacy* pharmacy, const string& medicineName) {
+    int index = findEntry(pharmacy, medicineName);
+    if (index == -1) {
+        return false;
     }
+    
+    for (int i = index; i < count - 1; i++) {
+        entries[i].pharmacy = entries[i + 1].pharmacy;
+        entries[i].medicineName.swap(entries[i + 1].medicineName);
+        entries[i].price = entries[i + 1].price;
+    }
+    count--;
+    entries[count].pharmacy = nullptr;
+    entries[count].medicineName.clear();
+    return true;
+}
+
+// Helper function to get approximate coordinates for Islamabad sectors
+bool MedicalSector::getSectorCoordinates(const string& sector, double& latitude, double& longitude) {
+    return SectorGazetteer::getShared()->getCoordinates(sector, latitude, longitude);
 }
 
 // Helper function to convert string to double (replaces stod from STL)
@@ -114,13 +150,15 @@ int MedicalSector::stringToInt(const string& str) {
 // Constructor
 MedicalSector::MedicalSector(int maxHospitals, int maxPharmacies, int maxMedicines, int hashTableSize)
     : maxHospitals(maxHospitals), maxPharmacies(maxPharmacies), maxMedicines(maxMedicines),
-      hospitalCount(0), pharmacyCount(0), medicineCount(0), ownsLocationGraph(true) {
+      hospitalCount(0), pharmacyCount(0), medicineCount(0), ownsLocationGraph(true),
+      postingListCount(0), postingListCapacity(16) {
     
     // Initialize hospital data structures
     hospitalTable = new HashTable(hashTableSize);
-    emergencyBedHeap = new MinHeap(maxHospitals); // Will use inverted priority for MaxHeap behavior
+    emergencyBedHeap = new IndexedMaxHeap(maxHospitals); // Handles are hospital registration slots
     locationGraph = new Graph(maxHospitals * 2, false); // Undirected graph for locations
     hospitalIDList = new string[maxHospitals];
+    hospitalSpecializationIndex = new TagIndex(maxHospitals);
     
     // Initialize pharmacy data structures
     pharmacyTable = new HashTable(hashTableSize);
@@ -130,10 +168,12 @@ MedicalSector::MedicalSector(int maxHospitals, int maxPharmacies, int maxMedicin
     medicineByNameTable = new HashTable(hashTableSize * 2); // Larger table for medicines
     medicineByFormulaTable = new HashTable(hashTableSize * 2);
     medicineNameList = new string[maxMedicines];
+    postingLists = new MedicinePostingList*[postingListCapacity];
     
     // Initialize doctor data structures
     doctorTable = new HashTable(hashTableSize);
     doctorSpecializationTable = new HashTable(hashTableSize);
+    doctorSpecializationIndex = new TagIndex();
     maxDoctors = 100; // Default max doctors
     doctorCount = 0;
     doctorIDList = new string[maxDoctors];
@@ -157,7 +197,15 @@ MedicalSector::~MedicalSector() {
         }
     }
     
-    // Delete all Medicine objects
+    // Delete all medicine posting lists (Medicine objects are owned by their pharmacies)
+    for (int i = 0; i < postingListCount; i++) {
+        delete postingLists[i];
+    }
+    if (postingLists != nullptr) {
+        delete[] postingLists;
+        postingLists = nullptr;
+    }
+    postingListCount = 0;
     
     // Delete data structures
     if (hospitalTable != nullptr) {
@@ -190,12 +238,28 @@ MedicalSector::~MedicalSector() {
         medicineByFormulaTable = nullptr;
     }
     
+    if (hospitalSpecializationIndex != nullptr) {
+        delete hospitalSpecializationIndex;
+        hospitalSpecializationIndex = nullptr;
+    }
+    
+    if (doctorSpecializationIndex != nullptr) {
+        delete doctorSpecializationIndex;
+        doctorSpecializationIndex = nullptr;
+    }
+    
     if (doctorTable != nullptr) {
         delete doctorTable;
         doctorTable = nullptr;
     }
     
     if (doctorSpecializationTable != nullptr) {
+        for (int i = 0; i < doctorCount; i++) {
+            string* specializationStr = (string*)doctorSpecializationTable->search(doctorIDList[i]);
+            if (specializationStr != nullptr) {
+                delete specializationStr;
+            }
+        }
         delete doctorSpecializationTable;
         doctorSpecializationTable = nullptr;
     }
@@ -248,22 +312,29 @@ bool MedicalSector::registerHospital(const string& hospitalID, const string& nam
         return false; // Maximum hospitals reached
     }
     
+    // Locate the sector (an unknown sector would put the hospital at the city center)
+    double lat, lon;
+    if (!getSectorCoordinates(sector, lat, lon)) {
+        return false; // Unknown sector
+    }
+    
     // Create new hospital
     Hospital* hospital = new Hospital(hospitalID, name, sector, emergencyBeds, specialization);
     
     // Add to HashTable
     hospitalTable->insert(hospitalID, hospital);
     
-    // Add to emergency bed heap
-    double priority = -(double)emergencyBeds; // Negative for max-heap behavior
-    emergencyBedHeap->insert(hospitalID, priority, hospital);
+    // Add to emergency bed heap (handle = registration slot)
+    hospital->setBedHeapHandle(hospitalCount);
+    emergencyBedHeap->insert(hospitalCount, (double)emergencyBeds, hospital);
+    
+    // Parse specializations once into the bitmask index
+    hospitalSpecializationIndex->setEntityTags(hospitalID, specialization, hospital);
     
     // Add to hospital ID list for iteration
     hospitalIDList[hospitalCount] = hospitalID;
     
     // Add hospital location to Graph for nearest hospital lookup
-    double lat, lon;
-    getSectorCoordinates(sector, lat, lon);
     locationGraph->addVertex(hospitalID, name, lat, lon, hospital);
     
     // Connect hospital to nearest bus stop for pathfinding
@@ -320,13 +391,75 @@ Hospital* MedicalSector::getHospitalWithMostBeds() {
         return nullptr;
     }
     
-    // Peek at the top (min priority = most negative = most beds)
-    HeapNode top = emergencyBedHeap->peekMin();
-    if (top.identifier.empty()) {
+    // Peek at the top (most beds)
+    return (Hospital*)emergencyBedHeap->peekMax().data;
+}
+
+bool MedicalSector::adjustEmergencyBeds(const string& hospitalID, int delta) {
+    Hospital* hospital = searchHospital(hospitalID);
+    if (hospital == nullptr) {
+        return false;
+    }
+    
+    return setEmergencyBeds(hospitalID, hospital->getEmergencyBeds() + delta);
+}
+
+bool MedicalSector::setEmergencyBeds(const string& hospitalID, int beds) {
+    if (beds < 0) {
+        return false; // Invalid input: negative emergency beds
+    }
+    
+    Hospital* hospital = searchHospital(hospitalID);
+    if (hospital == nullptr) {
+        return false;
+    }
+    
+    hospital->setEmergencyBeds(beds);
+    emergencyBedHeap->updatePriority(hospital->getBedHeapHandle(), (double)beds);
+    return true;
+}
+
+Hospital** MedicalSector::getTopHospitalsByBeds(int k, const string& specialization, int& count) {
+    count = 0;
+    if (k <= 0 || emergencyBedHeap->isEmpty()) {
         return nullptr;
     }
     
-    return (Hospital*)top.data;
+    if (specialization.empty()) {
+        // Best-first walk of the bed heap
+        IndexedHeapNode* top = new IndexedHeapNode[k];
+        count = emergencyBedHeap->topK(k, top);
+        Hospital** result = new Hospital*[count > 0 ? count : 1];
+        for (int i = 0; i < count; i++) {
+            result[i] = (Hospital*)top[i].data;
+        }
+        delete[] top;
+        return result;
+    }
+    
+    // Rank only the hospitals carrying the specialization: keep the best k in a min-heap on beds
+    int matchCount = 0;
+    void** matches = hospitalSpecializationIndex->findEntities(specialization, matchCount);
+    if (matches == nullptr) {
+        return nullptr;
+    }
+    
+    MinHeap best(k + 1);
+    for (int i = 0; i < matchCount; i++) {
+        Hospital* hospital = (Hospital*)matches[i];
+        best.insert(hospital->getHospitalID(), emergencyBedHeap->getPriority(hospital->getBedHeapHandle()), hospital);
+        if (best.getSize() > k) {
+            best.extractMin();
+        }
+    }
+    delete[] matches;
+    
+    count = best.getSize();
+    Hospital** result = new Hospital*[count > 0 ? count : 1];
+    for (int i = count - 1; i >= 0; i--) {
+        result[i] = (Hospital*)best.extractMin().data;
+    }
+    return result;
 }
 
 // Helper function to calculate simple squared distance
@@ -351,7 +484,7 @@ string MedicalSector::findNearestHospital(double latitude, double longitude) {
         
         // Get hospital coordinates from its sector
         double hospLat, hospLon;
-        getSectorCoordinates(hospital->getSector(), hospLat, hospLon);
+        if (!getSectorCoordinates(hospital->getSector(), hospLat, hospLon)) continue;
         
         // Calculate squared distance (no sqrt needed for comparison)
         double distSquared = calculateDistanceSquared(latitude, longitude, hospLat, hospLon);
@@ -367,21 +500,55 @@ string MedicalSector::findNearestHospital(double latitude, double longitude) {
 
 Hospital** MedicalSector::findHospitalsBySpecialization(const string& specialization, int& count) {
     count = 0;
-    Hospital** result = new Hospital*[maxHospitals];
+    void** matches = hospitalSpecializationIndex->findEntities(specialization, count);
+    if (matches == nullptr) {
+        return nullptr;
+    }
     
-    // Iterate through all registered hospitals
-    for (int i = 0; i < hospitalCount; i++) {
-        Hospital* hospital = (Hospital*)hospitalTable->search(hospitalIDList[i]);
-        if (hospital != nullptr) {
-            // Check if specialization matches (substring search)
-            string hospitalSpec = hospital->getSpecialization();
-            if (hospitalSpec.find(specialization) != string::npos) {
-                result[count++] = hospital;
-            }
+    Hospital** result = new Hospital*[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = (Hospital*)matches[i];
+    }
+    delete[] matches;
+    return result;
+}
+
+Hospital* MedicalSector::findNearestHospitalWithSpecialization(const string& specialization, double latitude,
+                                                               double longitude, bool requireBeds) {
+    int count = 0;
+    void** matches = hospitalSpecializationIndex->findEntities(specialization, count);
+    if (matches == nullptr) {
+        return nullptr;
+    }
+    
+    Hospital* nearest = nullptr;
+    double minDistance = 0.0;
+    for (int i = 0; i < count; i++) {
+        Hospital* hospital = (Hospital*)matches[i];
+        if (requireBeds && !hospital->hasAvailableBeds()) continue;
+        
+        double hospLat, hospLon;
+        if (!getSectorCoordinates(hospital->getSector(), hospLat, hospLon)) continue;
+        double distSquared = calculateDistanceSquared(latitude, longitude, hospLat, hospLon);
+        if (nearest == nullptr || distSquared < minDistance) {
+            minDistance = distSquared;
+            nearest = hospital;
         }
     }
     
-    return result;
+    delete[] matches;
+    return nearest;
+}
+
+bool MedicalSector::updateHospitalSpecialization(const string& hospitalID, const string& specialization) {
+    Hospital* hospital = searchHospital(hospitalID);
+    if (hospital == nullptr) {
+        return false;
+    }
+    
+    hospital->setSpecialization(specialization);
+    hospitalSpecializationIndex->setEntityTags(hospitalID, specialization, hospital);
+    return true;
 }
 
 void MedicalSector::displayAllHospitals() {
@@ -415,6 +582,12 @@ bool MedicalSector::registerPharmacy(const string& pharmacyID, const string& nam
         return false; // Maximum pharmacies reached
     }
     
+    // Locate the sector (an unknown sector would put the pharmacy at the city center)
+    double lat, lon;
+    if (!getSectorCoordinates(sector, lat, lon)) {
+        return false; // Unknown sector
+    }
+    
     // Create new pharmacy
     Pharmacy* pharmacy = new Pharmacy(pharmacyID, name, sector);
     
@@ -425,8 +598,6 @@ bool MedicalSector::registerPharmacy(const string& pharmacyID, const string& nam
     pharmacyIDList[pharmacyCount] = pharmacyID;
     
     // Add pharmacy location to Graph for nearest pharmacy lookup
-    double lat, lon;
-    getSectorCoordinates(sector, lat, lon);
     locationGraph->addVertex(pharmacyID, name, lat, lon, pharmacy);
     
     // Connect pharmacy to nearest bus stop for pathfinding
@@ -503,35 +674,84 @@ bool MedicalSector::addMedicineToPharmacy(const string& pharmacyID, const string
         return false; // Pharmacy not found
     }
     
+    // A re-added medicine may have changed formula: drop it from the old formula's list
+    const Medicine* existing = pharmacy->findMedicineByName(medicineName);
+    if (existing != nullptr && existing->getFormula() != formula) {
+        MedicinePostingList* oldFormulaList = (MedicinePostingList*)medicineByFormulaTable->search(existing->getFormula());
+        if (oldFormulaList != nullptr) {
+            oldFormulaList->remove(pharmacy, medicineName);
+        }
+    }
+    
     // Create medicine
     Medicine medicine(medicineName, formula, price);
     
     // Add to pharmacy
     pharmacy->addMedicine(medicine);
     
-    // Add to medicine hash tables for fast lookup
-    Medicine* medPtr = pharmacy->findMedicineByName(medicineName);
-    if (medPtr != nullptr) {
-        // Store pointer in hash tables for O(1) lookup
-        medicineByNameTable->insert(medicineName, medPtr);
-        medicineByFormulaTable->insert(formula, medPtr);
-        
-        // Add to medicine name list if not already present
-        bool exists = false;
-        for (int i = 0; i < medicineCount; i++) {
-            if (medicineNameList[i] == medicineName) {
-                exists = true;
-                break;
+    // Update the name and formula posting lists (pharmacy + price, sorted by price)
+    bool newName = false;
+    bool newFormula = false;
+    getOrCreatePostingList(medicineByNameTable, medicineName, newName)->addOrUpdate(pharmacy, medicineName, price);
+    getOrCreatePostingList(medicineByFormulaTable, formula, newFormula)->addOrUpdate(pharmacy, medicineName, price);
+    
+    // Add to medicine name list the first time this medicine is stocked anywhere
+    if (newName) {
+        if (medicineCount >= maxMedicines) {
+            int newMax = (maxMedicines > 0) ? maxMedicines * 2 : 16;
+            string* newList = new string[newMax];
+            for (int i = 0; i < medicineCount; i++) {
+                newList[i].swap(medicineNameList[i]);
             }
+            delete[] medicineNameList;
+            medicineNameList = newList;
+            maxMedicines = newMax;
         }
-        if (!exists && medicineCount < maxMedicines) {
-            medicineNameList[medicineCount++] = medicineName;
-        }
+        medicineNameList[medicineCount++] = medicineName;
     }
     
     return true;
 }
 
+MedicinePostingList* MedicalSector::getOrCreatePostingList(HashTable* table, const string& key, bool& created) {
+    created = false;
+    MedicinePostingList* list = (MedicinePostingList*)table->search(key);
+    if (list != nullptr) {
+        return list;
+    }
+    
+    list = new MedicinePostingList(key);
+    table->insert(key, list);
+    created = true;
+    
+    if (postingListCount >= postingListCapacity) {
+        int newCapacity = postingListCapacity * 2;
+        MedicinePostingList** newLists = new MedicinePostingList*[newCapacity];
+        for (int i = 0; i < postingListCount; i++) {
+            newLists[i] = postingLists[i];
+        }
+        delete[] postingLists;
+        postingLists = newLists;
+        postingListCapacity = newCapacity;
+    }
+    postingLists[postingListCount++] = list;
+    return list;
+}
+
+MedicineStockEntry* MedicalSector::copyEntries(const MedicinePostingList* list, int k, int& count) {
+    count = 0;
+    if (list == nullptr || list->count == 0 || k <= 0) {
+        return nullptr;
+    }
+    
+    count = (k < list->count) ? k : list->count;
+    MedicineStockEntry* result = new MedicineStockEntry[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = list->entries[i];
+    }
+    return result;
+}
+
 void MedicalSector::displayAllPharmacies() {
     cout << "=== All Registered Pharmacies (" << pharmacyCount << ") ===" << endl;
     for (int i = 0; i < pharmacyCount; i++) {
@@ -560,7 +780,7 @@ string MedicalSector::findNearestPharmacy(double latitude, double longitude) {
         
         // Get pharmacy coordinates from its sector
         double pharmLat, pharmLon;
-        getSectorCoordinates(pharmacy->getSector(), pharmLat, pharmLon);
+        if (!getSectorCoordinates(pharmacy->getSector(), pharmLat, pharmLon)) continue;
         
         // Calculate squared distance (no sqrt needed for comparison)
         double distSquared = calculateDistanceSquared(latitude, longitude, pharmLat, pharmLon);
@@ -576,26 +796,107 @@ string MedicalSector::findNearestPharmacy(double latitude, double longitude) {
 
 // ========== MEDICINE OPERATIONS ==========
 
-Medicine* MedicalSector::searchMedicineByName(const string& medicineName) {
-    return (Medicine*)medicineByNameTable->search(medicineName);
+const Medicine* MedicalSector::searchMedicineByName(const string& medicineName) {
+    MedicinePostingList* list = (MedicinePostingList*)medicineByNameTable->search(medicineName);
+    if (list == nullptr || list->count == 0) {
+        return nullptr;
+    }
+    
+    // Resolve through the pharmacy so the pointer is never stale after its array grows
+    return list->entries[0].pharmacy->findMedicineByName(medicineName);
 }
 
-Medicine* MedicalSector::searchMedicineByFormula(const string& formula) {
-    return (Medicine*)medicineByFormulaTable->search(formula);
+const Medicine* MedicalSector::searchMedicineByFormula(const string& formula) {
+    MedicinePostingList* list = (MedicinePostingList*)medicineByFormulaTable->search(formula);
+    if (list == nullptr || list->count == 0) {
+        return nullptr;
+    }
+    
+    return list->entries[0].pharmacy->findMedicineByName(list->entries[0].medicineName);
 }
 
 Pharmacy** MedicalSector::findPharmaciesWithMedicine(const string& medicineName, int& count) {
     count = 0;
-    Pharmacy** result = new Pharmacy*[maxPharmacies];
+    MedicinePostingList* list = (MedicinePostingList*)medicineByNameTable->search(medicineName);
+    if (list == nullptr || list->count == 0) {
+        return new Pharmacy*[1];
+    }
     
-    // Iterate through all pharmacies
-    for (int i = 0; i < pharmacyCount; i++) {
-        Pharmacy* pharmacy = (Pharmacy*)pharmacyTable->search(pharmacyIDList[i]);
-        if (pharmacy != nullptr && pharmacy->hasMedicine(medicineName)) {
-            result[count++] = pharmacy;
+    Pharmacy** result = new Pharmacy*[list->count];
+    for (int i = 0; i < list->count; i++) {
+        result[count++] = list->entries[i].pharmacy;
+    }
+    
+    return result;
+}
+
+MedicineStockEntry* MedicalSector::findCheapestStockists(const string& key, int k, int& count, bool byFormula) {
+    HashTable* table = byFormula ? medicineByFormulaTable : medicineByNameTable;
+    return copyEntries((MedicinePostingList*)table->search(key), k, count);
+}
+
+MedicineStockEntry* MedicalSector::findNearestStockists(const string& key, double latitude, double longitude,
+                                                        int k, int& count, bool byFormula) {
+    count = 0;
+    HashTable* table = byFormula ? medicineByFormulaTable : medicineByNameTable;
+    MedicinePostingList* list = (MedicinePostingList*)table->search(key);
+    if (list == nullptr || list->count == 0 || k <= 0) {
+        return nullptr;
+    }
+    
+    // Rank only the stockists by distance
+    MinHeap distanceHeap(list->count);
+    for (int i = 0; i < list->count; i++) {
+        double pharmLat, pharmLon;
+        if (!getSectorCoordinates(list->entries[i].pharmacy->getSector(), pharmLat, pharmLon)) continue;
+        double distSquared = calculateDistanceSquared(latitude, longitude, pharmLat, pharmLon);
+        distanceHeap.insert(list->entries[i].pharmacy->getPharmacyID(), distSquared, &list->entries[i]);
+    }
+    
+    int resultSize = (k < list->count) ? k : list->count;
+    MedicineStockEntry* result = new MedicineStockEntry[resultSize];
+    while (count < resultSize && !distanceHeap.isEmpty()) {
+        HeapNode node = distanceHeap.extractMin();
+        result[count++] = *(MedicineStockEntry*)node.data;
+    }
+    
+    return result;
+}
+
+MedicineStockEntry* MedicalSector::findStockistsInPriceRange(const string& key, double minPrice, double maxPrice,
+                                                             int& count, bool byFormula) {
+    count = 0;
+    HashTable* table = byFormula ? medicineByFormulaTable : medicineByNameTable;
+    MedicinePostingList* list = (MedicinePostingList*)table->search(key);
+    if (list == nullptr || list->count == 0 || minPrice > maxPrice) {
+        return nullptr;
+    }
+    
+    // Lower bound: first entry priced at or above minPrice
+    int low = 0;
+    int high = list->count;
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (list->entries[mid].price < minPrice) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
     }
     
+    int end = low;
+    while (end < list->count && list->entries[end].price <= maxPrice) {
+        end++;
+    }
+    if (end == low) {
+        return nullptr;
+    }
+    
+    count = end - low;
+    MedicineStockEntry* result = new MedicineStockEntry[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = list->entries[low + i];
+    }
     return result;
 }
 
@@ -618,6 +919,7 @@ bool MedicalSector::registerDoctor(const string& doctorID, const string& name,
     // Store specialization for searching by specialization
     string* specializationStr = new string(specialization);
     doctorSpecializationTable->insert(doctorID, specializationStr);
+    doctorSpecializationIndex->setEntityTags(doctorID, specialization, doctorData);
     
     // Add to doctor ID list for iteration
     doctorIDList[doctorCount] = doctorID;
@@ -636,22 +938,8 @@ string* MedicalSector::findDoctorsBySpecialization(const string& specialization,
         return nullptr;
     }
     
-    string* result = new string[maxDoctors]; // Allocate max size
-    
-    // Iterate through all registered doctors using ID list
-    for (int i = 0; i < doctorCount; i++) {
-        // Check specialization for this doctor
-        string* docSpecialization = (string*)doctorSpecializationTable->search(doctorIDList[i]);
-        if (docSpecialization != nullptr) {
-            // Check if specialization matches (substring search for flexibility)
-            if (docSpecialization->find(specialization) != string::npos || 
-                specialization.find(*docSpecialization) != string::npos) {
-                result[count++] = doctorIDList[i];
-            }
-        }
-    }
-    
-    return result;
+    // Also match doctors whose specialization appears inside the query (as the old lookup did)
+    return doctorSpecializationIndex->findEntityIDs(specialization, count, true);
 }
 
 // ========== UTILITY OPERATIONS ==========
@@ -668,6 +956,51 @@ int MedicalSector::getMedicineCount() const {
     return medicineCount;
 }
 
+QueryTable* MedicalSector::buildHospitalView() const {
+    QueryTable* view = new QueryTable("Hospitals", hospitalCount);
+    int hospitalColumn = view->addCategoryColumn("Hospital");
+    int sectorColumn = view->addCategoryColumn("Sector");
+    int specializationColumn = view->addCategoryColumn("Specialization");
+    int bedsColumn = view->addNumberColumn("EmergencyBeds");
+    
+    for (int i = 0; i < hospitalCount; i++) {
+        Hospital* hospital = (Hospital*)hospitalTable->search(hospitalIDList[i]);
+        if (hospital == nullptr) continue;
+        
+        int row = view->addRow();
+        view->setCategory(row, hospitalColumn, hospital->getName());
+        view->setCategory(row, sectorColumn, hospital->getSector());
+        view->setCategory(row, specializationColumn, hospital->getSpecialization());
+        view->setNumber(row, bedsColumn, hospital->getEmergencyBeds());
+    }
+    return view;
+}
+
+QueryTable* MedicalSector::buildPharmacyStockView() const {
+    QueryTable* view = new QueryTable("Pharmacy Stock");
+    int pharmacyColumn = view->addCategoryColumn("Pharmacy");
+    int sectorColumn = view->addCategoryColumn("Sector");
+    int medicineColumn = view->addCategoryColumn("Medicine");
+    int formulaColumn = view->addCategoryColumn("Formula");
+    int priceColumn = view->addNumberColumn("Price");
+    
+    for (int i = 0; i < pharmacyCount; i++) {
+        Pharmacy* pharmacy = (Pharmacy*)pharmacyTable->search(pharmacyIDList[i]);
+        if (pharmacy == nullptr) continue;
+        
+        const Medicine* medicines = pharmacy->getMedicines();
+        for (int j = 0; j < pharmacy->getMedicineCount(); j++) {
+            int row = view->addRow();
+            view->setCategory(row, pharmacyColumn, pharmacy->getName());
+            view->setCategory(row, sectorColumn, pharmacy->getSector());
+            view->setCategory(row, medicineColumn, medicines[j].getMedicineName());
+            view->setCategory(row, formulaColumn, medicines[j].getFormula());
+            view->setNumber(row, priceColumn, medicines[j].getPrice());
+        }
+    }
+    return view;
+}
+
 void MedicalSector::setCityGraph(Graph* graph) {
     if (graph == nullptr) {
         return; // Invalid graph
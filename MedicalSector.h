@@ -4,33 +4,77 @@
 #include <string>
 #include "core_classes/HashTable.h"
 #include "core_classes/MinHeap.h"
+#include "core_classes/IndexedMaxHeap.h"
 #include "core_classes/Graph.h"
+#include "core_classes/TagIndex.h"
 #include "Hospital.h"
 #include "Pharmacy.h"
 #include "Medicine.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/SectorGazetteer.h"
+#include "core_classes/QueryTable.h"
 using namespace std;
 
+// Structure for one stockist in a medicine posting list
+struct MedicineStockEntry {
+    Pharmacy* pharmacy;       // Pharmacy that stocks the medicine
+    string medicineName;      // Brand stocked (differs per entry in formula lists)
+    double price;             // Price at this pharmacy in PKR
+    
+    MedicineStockEntry();
+};
+
+// Structure for a posting list: every pharmacy stocking one medicine name or formula
+// Entries are kept sorted by price (cheapest first), one entry per (pharmacy, medicine name)
+struct MedicinePostingList {
+    string key;                       // Medicine name or formula this list belongs to
+    MedicineStockEntry* entries;      // Stockists sorted by ascending price
+    int count;                        // Number of stockists
+    int capacity;                     // Allocated size of entries array
+    
+    MedicinePostingList(const string& k);
+    ~MedicinePostingList();
+    
+    // Find the entry for a pharmacy/medicine pair
+    // Returns: index in entries, or -1 if not present
+    // Complexity: O(n) where n is number of stockists
+    int findEntry(Pharmacy* pharmacy, const string& medicineName) const;
+    
+    // Add a stockist, or move it to its new price position if already present
+    // Complexity: O(n) where n is number of stockists
+    void addOrUpdate(Pharmacy* pharmacy, const string& medicineName, double price);
+    
+    // Remove a stockist
+    // Returns: false if the pair was not in the list
+    // Complexity: O(n) where n is number of stockists
+    bool remove(Pharmacy* pharmacy, const string& medicineName);
+};
+
 // Medical Sector Manager Class
 // Manages hospitals, pharmacies, medicines, and doctors in the smart city system
 class MedicalSector {
 private:
     // Hospital Management
     HashTable* hospitalTable;         // HashTable for HospitalID → Hospital* lookup
-    MinHeap* emergencyBedHeap;        // MinHeap with inverted priority for MaxHeap behavior (hospitals with most beds first)
+    IndexedMaxHeap* emergencyBedHeap; // Addressable MaxHeap of available beds, keyed by Hospital::bedHeapHandle
     Graph* locationGraph;             // Graph for nearest hospital queries
     bool ownsLocationGraph;           // Flag to track if we own the graph (for shared graph support)
+    TagIndex* hospitalSpecializationIndex; // Specialization vocabulary, per-hospital bitset, specialization → hospitals
     
     // Pharmacy Management
     HashTable* pharmacyTable;         // HashTable for PharmacyID → Pharmacy* lookup
     
-    // Medicine Management (dual indexing for fast lookup)
-    HashTable* medicineByNameTable;   // HashTable for MedicineName → Medicine* lookup
-    HashTable* medicineByFormulaTable;// HashTable for Formula → Medicine* lookup
+    // Medicine Management (inverted index: medicine → pharmacies stocking it)
+    HashTable* medicineByNameTable;   // HashTable for MedicineName → MedicinePostingList*
+    HashTable* medicineByFormulaTable;// HashTable for Formula → MedicinePostingList*
+    MedicinePostingList** postingLists; // All posting lists (owned, for cleanup)
+    int postingListCount;
+    int postingListCapacity;
     
     // Doctor Management
     HashTable* doctorTable;           // HashTable for DoctorID → Doctor data lookup
     HashTable* doctorSpecializationTable; // HashTable for DoctorID → Specialization lookup
+    TagIndex* doctorSpecializationIndex;  // Specialization vocabulary, per-doctor bitset, specialization → doctors
     
     // Helper lists for iteration
     string* hospitalIDList;      // List of all hospital IDs
@@ -48,8 +92,16 @@ private:
     int medicineCount;
     int doctorCount;
     
+    // Helper: Get the posting list for a key, creating it if needed
+    // Parameters: created (output) - true if a new list was made
+    MedicinePostingList* getOrCreatePostingList(HashTable* table, const string& key, bool& created);
+    
+    // Helper: Copy the first k entries of a posting list (caller must delete[])
+    static MedicineStockEntry* copyEntries(const MedicinePostingList* list, int k, int& count);
+    
     // Helper: Get sector coordinates for Graph
-    static void getSectorCoordinates(const string& sector, double& latitude, double& longitude);
+    // Returns: false if the sector is unknown (coordinates are set to the city center)
+    static bool getSectorCoordinates(const string& sector, double& latitude, double& longitude);
     
     // Helper: Convert string to double (replaces stod)
     static double stringToDouble(const string& str);
@@ -67,7 +119,7 @@ public:
     // ========== HOSPITAL OPERATIONS ==========
     
     // Register a new hospital
-    // Returns: true if successful, false if hospital already exists
+    // Returns: true if successful, false if hospital already exists or the sector is unknown
     bool registerHospital(const string& hospitalID, const string& name,
                          const string& sector, int emergencyBeds, const string& specialization);
     
@@ -81,23 +133,54 @@ public:
     
     // Get hospital with most emergency beds available (MaxHeap behavior)
     // Returns: Hospital pointer, or nullptr if no hospitals available
+    // Complexity: O(1)
     Hospital* getHospitalWithMostBeds();
     
+    // Admit (negative delta) or free (positive delta) emergency beds at a hospital
+    // Returns: false if hospital not found or beds would drop below zero
+    // Complexity: O(log n)
+    bool adjustEmergencyBeds(const string& hospitalID, int delta);
+    
+    // Set a hospital's available emergency beds (e.g., from a live capacity feed)
+    // Note: Use this (not Hospital::setEmergencyBeds) so the bed heap stays ordered
+    // Returns: false if hospital not found or beds is negative
+    // Complexity: O(log n)
+    bool setEmergencyBeds(const string& hospitalID, int beds);
+    
+    // Get the k hospitals with the most available beds, optionally filtered by specialization
+    // Returns: Array of Hospital pointers, most beds first (caller must delete[]), and count
+    // Complexity: O(k log k) without a filter, O(p log k) with one (p = hospitals with the specialization)
+    Hospital** getTopHospitalsByBeds(int k, const string& specialization, int& count);
+    
     // Find nearest hospital to given location (using Graph)
     // Returns: HospitalID of nearest hospital, or empty string if not found
     string findNearestHospital(double latitude, double longitude);
     
-    // Search hospitals by specialization
-    // Returns: Array of Hospital pointers, and count
+    // Search hospitals by specialization (comma separated list = hospital must have all of them)
+    // Each term matches any specialization containing it, case-insensitively
+    // (e.g., "surgery" finds "Surgery" and "Neurosurgery")
+    // Returns: Array of Hospital pointers (caller must delete[]), and count; nullptr if none match
+    // Complexity: O(p × q) using the specialization index (p = hospitals with the rarest specialization)
     Hospital** findHospitalsBySpecialization(const string& specialization, int& count);
     
+    // Find the nearest hospital with the given specialization(s)
+    // Parameters: requireBeds - skip hospitals without available emergency beds
+    // Returns: Hospital pointer, or nullptr if no hospital qualifies
+    // Complexity: O(p × q) - only hospitals carrying the specialization are measured
+    Hospital* findNearestHospitalWithSpecialization(const string& specialization, double latitude,
+                                                    double longitude, bool requireBeds = true);
+    
+    // Change a hospital's specialization and re-index it
+    // Returns: false if hospital not found
+    bool updateHospitalSpecialization(const string& hospitalID, const string& specialization);
+    
     // Display all hospitals
     void displayAllHospitals();
     
     // ========== PHARMACY OPERATIONS ==========
     
     // Register a new pharmacy
-    // Returns: true if successful, false if pharmacy already exists
+    // Returns: true if successful, false if pharmacy already exists or the sector is unknown
     bool registerPharmacy(const string& pharmacyID, const string& name, const string& sector);
     
     // Load pharmacies from CSV file using DataLoader
@@ -123,17 +206,37 @@ public:
     // ========== MEDICINE OPERATIONS ==========
     
     // Search medicine by name (O(1) lookup using HashTable)
-    // Returns: Pointer to Medicine, or nullptr if not found
-    Medicine* searchMedicineByName(const string& medicineName);
+    // Returns: Pointer to the cheapest stocked Medicine (read-only, change prices through
+    //          addMedicineToPharmacy so the posting lists stay sorted), or nullptr if not found
+    const Medicine* searchMedicineByName(const string& medicineName);
     
     // Search medicine by formula (O(1) lookup using HashTable)
-    // Returns: Pointer to Medicine, or nullptr if not found
-    Medicine* searchMedicineByFormula(const string& formula);
+    // Returns: Pointer to the cheapest stocked Medicine (read-only), or nullptr if not found
+    const Medicine* searchMedicineByFormula(const string& formula);
     
-    // Find pharmacies that have a specific medicine
-    // Returns: Array of Pharmacy pointers, and count
+    // Find pharmacies that have a specific medicine (from the posting list, cheapest first)
+    // Returns: Array of Pharmacy pointers, and count (caller must delete[])
+    // Complexity: O(s) where s is number of stockists
     Pharmacy** findPharmaciesWithMedicine(const string& medicineName, int& count);
     
+    // Find the k cheapest stockists of a medicine name (or formula if byFormula is true)
+    // Returns: Array of MedicineStockEntry (cheapest first), and count (caller must delete[])
+    // Complexity: O(k) - posting lists are kept sorted by price
+    MedicineStockEntry* findCheapestStockists(const string& key, int k, int& count, bool byFormula = false);
+    
+    // Find the k nearest stockists of a medicine name (or formula if byFormula is true)
+    // Returns: Array of MedicineStockEntry (nearest first), and count (caller must delete[])
+    // Complexity: O(s log s) where s is number of stockists (no scan of other pharmacies)
+    MedicineStockEntry* findNearestStockists(const string& key, double latitude, double longitude,
+                                             int k, int& count, bool byFormula = false);
+    
+    // Find every stockist of a medicine name (or formula if byFormula is true) priced within [minPrice, maxPrice]
+    // e.g. all paracetamol formulations under 100 PKR: ("Paracetamol", 0, 100, count, true)
+    // Returns: Array of MedicineStockEntry (cheapest first), and count (caller must delete[])
+    // Complexity: O(log s + r) where r is number of results - binary search on the price-sorted list
+    MedicineStockEntry* findStockistsInPriceRange(const string& key, double minPrice, double maxPrice,
+                                                  int& count, bool byFormula = false);
+    
     // ========== DOCTOR OPERATIONS ==========
     
     // Register a doctor
@@ -145,8 +248,11 @@ public:
     // Returns: Doctor data pointer, or nullptr if not found
     void* searchDoctor(const string& doctorID);
     
-    // Search doctors by specialization
-    // Returns: Array of doctor IDs, and count (requires iteration)
+    // Search doctors by specialization (comma separated list = doctor must have all of them)
+    // Each term matches a specialization containing it or contained in it
+    // (e.g., "Pediatric Cardiology" finds a "Cardiology" doctor)
+    // Returns: Array of doctor IDs (caller must delete[]), and count; nullptr if none match
+    // Complexity: O(p × q) using the specialization index
     string* findDoctorsBySpecialization(const string& specialization, int& count);
     
     // ========== UTILITY OPERATIONS ==========
@@ -156,6 +262,14 @@ public:
     int getPharmacyCount() const;
     int getMedicineCount() const;
     
+    // Build query tables for the statistics menu
+    // Hospitals: Hospital, Sector, Specialization, EmergencyBeds (one row per hospital)
+    // Pharmacy stock: Pharmacy, Sector, Medicine, Formula, Price (one row per stocked medicine)
+    // Returns: New QueryTable (caller must delete)
+    // Complexity: O(h) / O(s) where s is number of stocked medicines
+    QueryTable* buildHospitalView() const;
+    QueryTable* buildPharmacyStockView() const;
+    
     // Set city graph (for shared graph support - use single graph for entire city)
     // If external graph is provided, it will be used instead of internal graph
     // NOTE: Caller must ensure graph exists for lifetime of MedicalSector
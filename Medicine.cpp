@@ -1,4 +1,5 @@
 #include "Medicine.h"
+#include <utility>
 using namespace std;
 
 // Default constructor
@@ -14,6 +15,36 @@ Medicine::Medicine(const string& name, const string& form, double pr)
 Medicine::~Medicine() {
 }
 
+// Copy constructor
+Medicine::Medicine(const Medicine& other)
+    : medicineName(other.medicineName), formula(other.formula), price(other.price) {
+}
+
+// Move constructor
+Medicine::Medicine(Medicine&& other) noexcept
+    : medicineName(std::move(other.medicineName)), formula(std::move(other.formula)), price(other.price) {
+}
+
+// Copy assignment
+Medicine& Medicine::operator=(const Medicine& other) {
+    if (this != &other) {
+        medicineName = other.medicineName;
+        formula = other.formula;
+        price = other.price;
+    }
+    return *this;
+}
+
+// Move assignment
+Medicine& Medicine::operator=(Medicine&& other) noexcept {
+    if (this != &other) {
+        medicineName = std::move(other.medicineName);
+        formula = std::move(other.formula);
+        price = other.price;
+    }
+    return *this;
+}
+
 // Getters
 string Medicine::getMedicineName() const {
     return medicineName;
@@ -20,6 +20,12 @@ public:
     // Destructor
     ~Medicine();
     
+    // Copy and move (move is used when a pharmacy catalogue grows)
+    Medicine(const Medicine& other);
+    Medicine(Medicine&& other) noexcept;
+    Medicine& operator=(const Medicine& other);
+    Medicine& operator=(Medicine&& other) noexcept;
+    
     // Getters
     string getMedicineName() const;
     string getFormula() const;
@@ -1,40 +1,35 @@
 #include "Pharmacy.h"
+#include <utility>
 using namespace std;
 
+// Initial sizes of the catalogue arrays
+const int INITIAL_MEDICINE_CAPACITY = 5;
+const int INITIAL_SLOT_CAPACITY = 16;
+
 // Default constructor
-Pharmacy::Pharmacy() : pharmacyID(""), name(""), sector(""), medicines(nullptr), 
-                       medicineCount(0), medicineCapacity(0) {
+Pharmacy::Pharmacy() : pharmacyID(""), name(""), sector(""), medicines(nullptr), prices(nullptr),
+                       nextSameFormula(nullptr), medicineCount(0), medicineCapacity(0),
+                       nameSlots(nullptr), formulaSlots(nullptr), formulaTails(nullptr), slotCapacity(0) {
 }
 
 // Parameterized constructor
 Pharmacy::Pharmacy(const string& id, const string& n, const string& sec)
-    : pharmacyID(id), name(n), sector(sec), medicines(nullptr), 
-      medicineCount(0), medicineCapacity(0) {
+    : pharmacyID(id), name(n), sector(sec), medicines(nullptr), prices(nullptr),
+      nextSameFormula(nullptr), medicineCount(0), medicineCapacity(0),
+      nameSlots(nullptr), formulaSlots(nullptr), formulaTails(nullptr), slotCapacity(0) {
 }
 
 // Destructor
 Pharmacy::~Pharmacy() {
-    if (medicines != nullptr) {
-        delete[] medicines;
-        medicines = nullptr;
-    }
-    medicineCount = 0;
-    medicineCapacity = 0;
+    releaseCatalogue();
 }
 
 // Copy constructor
-Pharmacy::Pharmacy(const Pharmacy& other) 
-    : pharmacyID(other.pharmacyID), name(other.name), sector(other.sector),
-      medicineCount(other.medicineCount), medicineCapacity(other.medicineCapacity) {
-    
-    if (other.medicines != nullptr && medicineCount > 0) {
-        medicines = new Medicine[medicineCapacity];
-        for (int i = 0; i < medicineCount; i++) {
-            medicines[i] = other.medicines[i];
-        }
-    } else {
-        medicines = nullptr;
-    }
+Pharmacy::Pharmacy(const Pharmacy& other)
+    : pharmacyID(other.pharmacyID), name(other.name), sector(other.sector), medicines(nullptr),
+      prices(nullptr), nextSameFormula(nullptr), medicineCount(0), medicineCapacity(0),
+      nameSlots(nullptr), formulaSlots(nullptr), formulaTails(nullptr), slotCapacity(0) {
+    copyCatalogue(other);
 }
 
 // Assignment operator
@@ -43,51 +38,173 @@ Pharmacy& Pharmacy::operator=(const Pharmacy& other) {
         return *this;  // Self-assignment check
     }
     
-    // Clean up existing medicines
-    if (medicines != nullptr) {
-        delete[] medicines;
-        medicines = nullptr;
-    }
+    // Clean up existing catalogue
+    releaseCatalogue();
     
     // Copy basic fields
     pharmacyID = other.pharmacyID;
     name = other.name;
     sector = other.sector;
+    
+    // Copy catalogue
+    copyCatalogue(other);
+    
+    return *this;
+}
+
+void Pharmacy::copyCatalogue(const Pharmacy& other) {
+    if (other.medicines == nullptr || other.medicineCount == 0) {
+        return;
+    }
+    
     medicineCount = other.medicineCount;
     medicineCapacity = other.medicineCapacity;
+    medicines = new Medicine[medicineCapacity];
+    prices = new double[medicineCapacity];
+    nextSameFormula = new int[medicineCapacity];
+    for (int i = 0; i < medicineCount; i++) {
+        medicines[i] = other.medicines[i];
+        prices[i] = other.prices[i];
+        nextSameFormula[i] = other.nextSameFormula[i];
+    }
     
-    // Copy medicines array
-    if (other.medicines != nullptr && medicineCount > 0) {
-        medicines = new Medicine[medicineCapacity];
-        for (int i = 0; i < medicineCount; i++) {
-            medicines[i] = other.medicines[i];
-        }
-    } else {
+    slotCapacity = other.slotCapacity;
+    nameSlots = new int[slotCapacity];
+    formulaSlots = new int[slotCapacity];
+    formulaTails = new int[slotCapacity];
+    for (int i = 0; i < slotCapacity; i++) {
+        nameSlots[i] = other.nameSlots[i];
+        formulaSlots[i] = other.formulaSlots[i];
+        formulaTails[i] = other.formulaTails[i];
+    }
+}
+
+void Pharmacy::releaseCatalogue() {
+    if (medicines != nullptr) {
+        delete[] medicines;
         medicines = nullptr;
     }
-    
-    return *this;
+    if (prices != nullptr) {
+        delete[] prices;
+        prices = nullptr;
+    }
+    if (nextSameFormula != nullptr) {
+        delete[] nextSameFormula;
+        nextSameFormula = nullptr;
+    }
+    if (nameSlots != nullptr) {
+        delete[] nameSlots;
+        nameSlots = nullptr;
+    }
+    if (formulaSlots != nullptr) {
+        delete[] formulaSlots;
+        formulaSlots = nullptr;
+    }
+    if (formulaTails != nullptr) {
+        delete[] formulaTails;
+        formulaTails = nullptr;
+    }
+    medicineCount = 0;
+    medicineCapacity = 0;
+    slotCapacity = 0;
 }
 
 // Helper: Resize medicines array when needed
 void Pharmacy::resizeMedicines() {
     if (medicineCapacity == 0) {
-        medicineCapacity = 5;  // Initial capacity
+        medicineCapacity = INITIAL_MEDICINE_CAPACITY;
         medicines = new Medicine[medicineCapacity];
+        prices = new double[medicineCapacity];
+        nextSameFormula = new int[medicineCapacity];
+        rebuildIndexes(INITIAL_SLOT_CAPACITY);
     } else if (medicineCount >= medicineCapacity) {
         int newCapacity = medicineCapacity * 2;
         Medicine* newMedicines = new Medicine[newCapacity];
+        double* newPrices = new double[newCapacity];
+        int* newNext = new int[newCapacity];
         
-        // Copy existing medicines
+        // Move existing medicines (indices stay the same, so the indexes remain valid)
         for (int i = 0; i < medicineCount; i++) {
-            newMedicines[i] = medicines[i];
+            newMedicines[i] = std::move(medicines[i]);
+            newPrices[i] = prices[i];
+            newNext[i] = nextSameFormula[i];
         }
         
-        // Delete old array
+        // Delete old arrays
         delete[] medicines;
+        delete[] prices;
+        delete[] nextSameFormula;
         medicines = newMedicines;
+        prices = newPrices;
+        nextSameFormula = newNext;
         medicineCapacity = newCapacity;
     }
+    
+    // Keep the slot tables at most half full
+    if ((medicineCount + 1) * 2 > slotCapacity) {
+        rebuildIndexes(slotCapacity * 2);
+    }
+}
+
+unsigned int Pharmacy::hashKey(const string& key) {
+    // FNV-1a
+    unsigned int hashValue = 2166136261u;
+    for (int i = 0; i < (int)key.length(); i++) {
+        hashValue ^= (unsigned char)key[i];
+        hashValue *= 16777619u;
+    }
+    return hashValue;
+}
+
+int Pharmacy::findNameSlot(const string& medicineName) const {
+    int mask = slotCapacity - 1;
+    int slot = (int)(hashKey(medicineName) & (unsigned int)mask);
+    while (nameSlots[slot] != -1 && medicines[nameSlots[slot]].getMedicineName() != medicineName) {
+        slot = (slot + 1) & mask; // Linear probing
+    }
+    return slot;
+}
+
+int Pharmacy::findFormulaSlot(const string& formula) const {
+    int mask = slotCapacity - 1;
+    int slot = (int)(hashKey(formula) & (unsigned int)mask);
+    while (formulaSlots[slot] != -1 && medicines[formulaSlots[slot]].getFormula() != formula) {
+        slot = (slot + 1) & mask; // Linear probing
+    }
+    return slot;
+}
+
+void Pharmacy::rebuildIndexes(int newSlotCapacity) {
+    if (nameSlots != nullptr) delete[] nameSlots;
+    if (formulaSlots != nullptr) delete[] formulaSlots;
+    if (formulaTails != nullptr) delete[] formulaTails;
+    
+    slotCapacity = newSlotCapacity;
+    nameSlots = new int[slotCapacity];
+    formulaSlots = new int[slotCapacity];
+    formulaTails = new int[slotCapacity];
+    for (int i = 0; i < slotCapacity; i++) {
+        nameSlots[i] = -1;
+        formulaSlots[i] = -1;
+        formulaTails[i] = -1;
+    }
+    
+    for (int i = 0; i < medicineCount; i++) {
+        nameSlots[findNameSlot(medicines[i].getMedicineName())] = i;
+        linkFormula(i);
+    }
+}
+
+void Pharmacy::linkFormula(int index) {
+    // Appending keeps the first medicine added with a formula at the head of its chain
+    int formulaSlot = findFormulaSlot(medicines[index].getFormula());
+    nextSameFormula[index] = -1;
+    if (formulaSlots[formulaSlot] == -1) {
+        formulaSlots[formulaSlot] = index;
+    } else {
+        nextSameFormula[formulaTails[formulaSlot]] = index;
+    }
+    formulaTails[formulaSlot] = index;
 }
 
 // Getters
@@ -107,7 +224,7 @@ int Pharmacy::getMedicineCount() const {
     return medicineCount;
 }
 
-Medicine* Pharmacy::getMedicines() const {
+const Medicine* Pharmacy::getMedicines() const {
     return medicines;
 }
 
@@ -127,47 +244,96 @@ void Pharmacy::setSector(const string& sec) {
 // Add a medicine to the pharmacy
 void Pharmacy::addMedicine(const Medicine& medicine) {
     // Check if medicine already exists
-    for (int i = 0; i < medicineCount; i++) {
-        if (medicines[i].getMedicineName() == medicine.getMedicineName()) {
+    if (medicineCount > 0) {
+        int index = nameSlots[findNameSlot(medicine.getMedicineName())];
+        if (index != -1) {
             // Update existing medicine
-            medicines[i] = medicine;
+            bool formulaChanged = medicines[index].getFormula() != medicine.getFormula();
+            medicines[index] = medicine;
+            prices[index] = medicine.getPrice();
+            if (formulaChanged) {
+                // Rare: relink the formula chains from scratch
+                rebuildIndexes(slotCapacity);
+            }
             return;
         }
     }
     
     // Add new medicine
     resizeMedicines();
-    medicines[medicineCount] = medicine;
+    int index = medicineCount;
+    medicines[index] = medicine;
+    prices[index] = medicine.getPrice();
     medicineCount++;
+    
+    nameSlots[findNameSlot(medicine.getMedicineName())] = index;
+    linkFormula(index);
 }
 
 // Search for a medicine by name
-Medicine* Pharmacy::findMedicineByName(const string& name) {
-    for (int i = 0; i < medicineCount; i++) {
-        if (medicines[i].matchesName(name)) {
-            return &medicines[i];
-        }
+const Medicine* Pharmacy::findMedicineByName(const string& name) const {
+    if (medicineCount == 0) {
+        return nullptr;
     }
-    return nullptr;
+    int index = nameSlots[findNameSlot(name)];
+    return (index != -1) ? &medicines[index] : nullptr;
 }
 
 // Search for a medicine by formula
-Medicine* Pharmacy::findMedicineByFormula(const string& formula) {
-    for (int i = 0; i < medicineCount; i++) {
-        if (medicines[i].matchesFormula(formula)) {
-            return &medicines[i];
-        }
+const Medicine* Pharmacy::findMedicineByFormula(const string& formula) const {
+    if (medicineCount == 0) {
+        return nullptr;
     }
-    return nullptr;
+    int index = formulaSlots[findFormulaSlot(formula)];
+    return (index != -1) ? &medicines[index] : nullptr;
 }
 
 // Check if pharmacy has a specific medicine
 bool Pharmacy::hasMedicine(const string& name) const {
-    for (int i = 0; i < medicineCount; i++) {
-        if (medicines[i].matchesName(name)) {
-            return true;
+    if (medicineCount == 0) {
+        return false;
+    }
+    return nameSlots[findNameSlot(name)] != -1;
+}
+
+// Find medicines of a formula priced within [minPrice, maxPrice]
+const Medicine** Pharmacy::findMedicinesByFormulaInPriceRange(const string& formula, double minPrice, double maxPrice,
+                                                              int& count) const {
+    count = 0;
+    if (medicineCount == 0) {
+        return nullptr;
+    }
+    
+    int head = formulaSlots[findFormulaSlot(formula)];
+    int chainLength = 0;
+    for (int i = head; i != -1; i = nextSameFormula[i]) {
+        chainLength++;
+    }
+    if (chainLength == 0) {
+        return nullptr;
+    }
+    
+    const Medicine** result = new const Medicine*[chainLength];
+    for (int i = head; i != -1; i = nextSameFormula[i]) {
+        if (prices[i] >= minPrice && prices[i] <= maxPrice) {
+            result[count++] = &medicines[i];
         }
     }
-    return false;
+    return result;
 }
 
+// Find all medicines priced within [minPrice, maxPrice]
+const Medicine** Pharmacy::findMedicinesInPriceRange(double minPrice, double maxPrice, int& count) const {
+    count = 0;
+    if (medicineCount == 0) {
+        return nullptr;
+    }
+    
+    const Medicine** result = new const Medicine*[medicineCount];
+    for (int i = 0; i < medicineCount; i++) {
+        if (prices[i] >= minPrice && prices[i] <= maxPrice) {
+            result[count++] = &medicines[i];
+        }
+    }
+    return result;
+}
@@ -7,18 +7,51 @@ using namespace std;
 
 // Pharmacy entity class
 // Represents a pharmacy in the smart city system
+// The medicine catalogue is indexed by name and by formula (open addressing,
+// slot tables hold indices into medicines) and keeps prices in a separate column
+// so price range queries do not touch the string data
 class Pharmacy {
 private:
     string pharmacyID;      // Unique identifier (e.g., P01, P02)
     string name;            // Pharmacy name (e.g., Sehat Pharmacy)
     string sector;          // Location sector (e.g., F-8, G-10)
     Medicine* medicines;         // Dynamic array of medicines
+    double* prices;              // Price column parallel to medicines (for range scans)
+    int* nextSameFormula;        // Next medicine index with the same formula, in insertion order (-1 ends the chain)
     int medicineCount;           // Number of medicines
     int medicineCapacity;        // Capacity of medicines array
+    int* nameSlots;              // Name index: slot → medicine index (-1 = empty)
+    int* formulaSlots;           // Formula index: slot → first medicine index with that formula (-1 = empty)
+    int* formulaTails;           // Formula index: slot → last medicine index with that formula (for appends)
+    int slotCapacity;            // Size of both slot tables (power of two, at least 2 × medicineCount)
     
-    // Helper: Resize medicines array when needed
+    // Helper: Resize medicines array when needed (moves records, no string copies)
     void resizeMedicines();
     
+    // Helper: Hash a medicine name or formula
+    static unsigned int hashKey(const string& key);
+    
+    // Helper: Find the name slot holding name, or the empty slot where it belongs
+    // Complexity: O(1) average
+    int findNameSlot(const string& medicineName) const;
+    
+    // Helper: Find the formula slot holding formula, or the empty slot where it belongs
+    // Complexity: O(1) average
+    int findFormulaSlot(const string& formula) const;
+    
+    // Helper: Rebuild both indexes with the given slot capacity
+    // Complexity: O(n) where n is number of medicines
+    void rebuildIndexes(int newSlotCapacity);
+    
+    // Helper: Deep copy another pharmacy's catalogue (arrays must be released first)
+    void copyCatalogue(const Pharmacy& other);
+    
+    // Helper: Free catalogue arrays
+    void releaseCatalogue();
+    
+    // Helper: Append a medicine index to the end of its formula chain
+    void linkFormula(int index);
+
 public:
     // Constructor
     Pharmacy();
@@ -38,25 +71,43 @@ public:
     string getName() const;
     string getSector() const;
     int getMedicineCount() const;
-    Medicine* getMedicines() const;
+    
+    // Read-only view of the catalogue (change prices through addMedicine)
+    const Medicine* getMedicines() const;
     
     // Setters
     void setPharmacyID(const string& id);
     void setName(const string& n);
     void setSector(const string& sec);
     
-    // Add a medicine to the pharmacy
+    // Add a medicine to the pharmacy (replaces an existing medicine with the same name)
+    // Note: This is the only way to change a price, so the price column stays in sync;
+    //       lookups return const Medicine* for that reason
+    // Complexity: O(1) amortized
     void addMedicine(const Medicine& medicine);
     
     // Search for a medicine by name
-    Medicine* findMedicineByName(const string& name);
+    // Complexity: O(1) average
+    const Medicine* findMedicineByName(const string& name) const;
     
-    // Search for a medicine by formula
-    Medicine* findMedicineByFormula(const string& formula);
+    // Search for a medicine by formula (the first medicine added with that formula)
+    // Complexity: O(1) average
+    const Medicine* findMedicineByFormula(const string& formula) const;
     
     // Check if pharmacy has a specific medicine
+    // Complexity: O(1) average
     bool hasMedicine(const string& name) const;
+    
+    // Find medicines of a formula priced within [minPrice, maxPrice]
+    // Returns: Array of Medicine pointers in the order they were added (caller must delete[]), and count
+    // Complexity: O(f) where f is number of medicines with that formula
+    const Medicine** findMedicinesByFormulaInPriceRange(const string& formula, double minPrice, double maxPrice,
+                                                        int& count) const;
+    
+    // Find all medicines priced within [minPrice, maxPrice] (scans the price column only)
+    // Returns: Array of Medicine pointers (caller must delete[]), and count
+    // Complexity: O(n) where n is number of medicines
+    const Medicine** findMedicinesInPriceRange(double minPrice, double maxPrice, int& count) const;
 };
 
 #endif // PHARMACY_H
-
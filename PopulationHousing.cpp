@@ -2,11 +2,85 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include <cmath>
+#include "core_classes/SectorGazetteer.h"
 using namespace std;
 
+//population totals implementation
+//----------------------------
+popstats::popstats() : members(0), under18(0), adults(0), seniors(0), male(0), female(0), other(0),
+    occTotal(0), occCapacity(8) {
+    occupations = new string[occCapacity];
+    occCounts = new int[occCapacity];
+}
+
+popstats::~popstats() {
+    delete[] occupations;
+    delete[] occCounts;
+}
+
+int popstats::findOccupation(const string& occ) {
+    for (int i = 0; i < occTotal; ++i) {
+        if (occupations[i] == occ) return i;
+    }
+    return -1;
+}
+
+void popstats::add(citizeninfo* c) {
+    if (!c) return;
+    members++;
+
+    if (c->age < 18) under18++;
+    else if (c->age < 60) adults++;
+    else seniors++;
+
+    if (c->gender == "Male") male++;
+    else if (c->gender == "Female") female++;
+    else other++;
+
+    int idx = findOccupation(c->occupation);
+    if (idx == -1) {
+        if (occTotal >= occCapacity) {
+            int newCapacity = occCapacity * 2;
+            string* newOcc = new string[newCapacity];
+            int* newCounts = new int[newCapacity];
+            for (int i = 0; i < occTotal; ++i) {
+                newOcc[i].swap(occupations[i]);
+                newCounts[i] = occCounts[i];
+            }
+            delete[] occupations;
+            delete[] occCounts;
+            occupations = newOcc;
+            occCounts = newCounts;
+            occCapacity = newCapacity;
+        }
+        idx = occTotal++;
+        occupations[idx] = c->occupation;
+        occCounts[idx] = 0;
+    }
+    occCounts[idx]++;
+}
+
+void popstats::remove(citizeninfo* c) {
+    if (!c) return;
+    members--;
+
+    if (c->age < 18) under18--;
+    else if (c->age < 60) adults--;
+    else seniors--;
+
+    if (c->gender == "Male") male--;
+    else if (c->gender == "Female") female--;
+    else other--;
+
+    // zero counts stay in the histogram (reports skip them)
+    int idx = findOccupation(c->occupation);
+    if (idx != -1) occCounts[idx]--;
+}
+
 //family tree implementation 
 //----------------------------
-famtree::famtree() : root(nullptr) {}
+famtree::famtree(housenode* h) : root(nullptr), home(h) {}
 
 famtree::~famtree() { 
     deltree(root);
@@ -26,12 +100,13 @@ void famtree::deltree(famnode* node) {
 
 }
 
-void famtree::sethead(citizeninfo* headfam) {
+famnode* famtree::sethead(citizeninfo* headfam) {
     if (root) {
         deltree(root);
     }
 
-    root = new famnode(headfam);
+    root = new famnode(headfam, nullptr, home);
+    return root;
 }
 
 void famtree::addnode(string parcnic, citizeninfo* child) {
@@ -41,9 +116,19 @@ void famtree::addnode(string parcnic, citizeninfo* child) {
         return;
     }
 
-    famnode* tempchild = new famnode(child);
+    addchild(parent, child);
+}
+
+famnode* famtree::addchild(famnode* parent, citizeninfo* child, famnode* lastchild) {
+    if (!parent) {
+        return nullptr;
+    }
+
+    famnode* tempchild = new famnode(child, parent, home);
     if (!parent->child)
         parent->child = tempchild;
+    else if (lastchild)
+        lastchild->sibling = tempchild;
     else {
         famnode* curr = parent->child;
         while (curr->sibling) {
@@ -53,6 +138,28 @@ void famtree::addnode(string parcnic, citizeninfo* child) {
         curr->sibling = tempchild;
 
     }
+    return tempchild;
+}
+
+bool famtree::movetree(famtree* target) {
+    if (!target || target == this || !root || target->root) {
+        return false;
+    }
+
+    target->root = root;
+    root = nullptr;
+    target->sethouse(target->root);
+    return true;
+}
+
+void famtree::sethouse(famnode* node) {
+    if (!node) {
+        return;
+    }
+
+    node->house = home;
+    sethouse(node->child);
+    sethouse(node->sibling);
 }
 
 
@@ -112,54 +219,64 @@ famnode* famtree::findNode(famnode* node, string cnic) {
 }
 
 
+// dataset mein ghar ki coordinates nahi hain, to ghar ko uske sector ke bounding box mein
+// street/house number se ek fixed jagah par rakhte hain (golden ratio se numbers phail jate hain,
+// same street ke ghar ek latitude band mein). Sector na mile to ghar located nahi hota,
+// city center par rakhne se wahan jhoota hotspot ban jata.
+static void placehouse(housenode* h) {
+    SectorGazetteer* gaz = SectorGazetteer::getShared();
+    string name = (h->street && h->street->sector) ? h->street->sector->sectorName : "";
+    int streetNum = h->street ? h->street->streetNumber : 0;
+
+    double minLat, minLon, maxLat, maxLon;
+    if (!gaz->getBoundingBox(name, minLat, minLon, maxLat, maxLon)) {
+        h->located = false;
+        return;
+    }
+    double fLat = streetNum * 0.618034;
+    double fLon = h->houseNumber * 0.618034 + streetNum * 0.31;
+    fLat -= floor(fLat);
+    fLon -= floor(fLon);
+    h->lat = minLat + fLat * (maxLat - minLat);
+    h->lon = minLon + fLon * (maxLon - minLon);
+    h->located = true;
+}
+
 //Street implementation class
 void Street::addHouse(int houseNum) {
     if (findHouse(houseNum)) {
         return;
     }
-    housenode* temphouse = new housenode(houseNum);
+    housenode* temphouse = new housenode(houseNum, this);
+    placehouse(temphouse);
     if (!houses) houses = temphouse;
-    else {
-        housenode* curr = houses;
-        while (curr->next) curr = curr->next;
-        curr->next = temphouse;
-    }
+    else lastHouse->next = temphouse;
+    lastHouse = temphouse;
+    houseHash->insert(to_string(houseNum), temphouse);
 }
 
 housenode* Street::findHouse(int houseNum) {
-    housenode* curr = houses;
-    while (curr) {
-        if (curr->houseNumber == houseNum) {
-            return curr;
-        }
-        curr = curr->next;
-    }
-    return nullptr;
+    return static_cast<housenode*>(houseHash->search(to_string(houseNum)));
 }
 
 // -------------------------- Sector Implementation --------------------------
 void Sector::addStreet(int streetNum) {
     if (findStreet(streetNum)) return;
-    Street* newStreet = new Street(streetNum);
+    Street* newStreet = new Street(streetNum, this);
     if (!streets) streets = newStreet;
-    else {
-        Street* curr = streets;
-        while (curr->next) curr = curr->next;
-        curr->next = newStreet;
-    }
+    else lastStreet->next = newStreet;
+    lastStreet = newStreet;
+    streetHash->insert(to_string(streetNum), newStreet);
 }
 
 Street* Sector::findStreet(int streetNum) {
-    Street* curr = streets;
-    while (curr) {
-        if (curr->streetNumber == streetNum) return curr;
-        curr = curr->next;
-    }
-    return nullptr;
+    return static_cast<Street*>(streetHash->search(to_string(streetNum)));
 }
 
 // -------------------------- City Implementation --------------------------
-City::City(string name) : cityName(name), sectors(nullptr) {}
+City::City(string name) : cityName(name), sectors(nullptr), lastSector(nullptr) {
+    sectorHash = new HashTable(31);
+}
 
 City::~City() {
     Sector* curr = sectors;
@@ -168,26 +285,20 @@ City::~City() {
         curr = curr->next;
         delete temp;
     }
+    delete sectorHash;
 }
 
 void City::addSector(string sectorName) {
     if (findSector(sectorName)) return;
     Sector* newSector = new Sector(sectorName);
     if (!sectors) sectors = newSector;
-    else {
-        Sector* curr = sectors;
-        while (curr->next) curr = curr->next;
-        curr->next = newSector;
-    }
+    else lastSector->next = newSector;
+    lastSector = newSector;
+    sectorHash->insert(sectorName, newSector);
 }
 
 Sector* City::findSector(string sectorName) {
-    Sector* curr = sectors;
-    while (curr) {
-        if (curr->sectorName == sectorName) return curr;
-        curr = curr->next;
-    }
-    return nullptr;
+    return static_cast<Sector*>(sectorHash->search(sectorName));
 }
 
 void City::printHierarchy(Sector* sector, int level) {
@@ -222,11 +333,19 @@ void City::printCityHierarchy() {
 PopulationManager::PopulationManager() {
     city = new City("Islamabad");
     citizenHash = new HashTable(101);
+    famnodeHash = new HashTable(101);
+    citizenTable = new CitizenTable();
+    density = nullptr;
+    ungeocoded = 0;
+    rebuildDensity(DensityGrid::DEFAULT_CELL_SIZE);
 }
 
 PopulationManager::~PopulationManager() {
     delete city;
     delete citizenHash;
+    delete famnodeHash;
+    delete citizenTable;
+    delete density;
 }
 
 void PopulationManager::addSector(string sectorName) {
@@ -247,39 +366,159 @@ void PopulationManager::addHouse(string sectorName, int streetNum, int houseNum)
     st->addHouse(houseNum);
 }
 
-void PopulationManager::addFamily(string sectorName, int streetNum, int houseNum, citizeninfo* headOfFamily) {
+housenode* PopulationManager::resolveHouse(string sectorName, int streetNum, int houseNum) {
     Sector* s = city->findSector(sectorName);
-    if (!s) return;
+    if (!s) return nullptr;
     Street* st = s->findStreet(streetNum);
-    if (!st) return;
-    housenode* house = st->findHouse(houseNum);
+    if (!st) return nullptr;
+    return st->findHouse(houseNum);
+}
+
+void PopulationManager::addFamily(string sectorName, int streetNum, int houseNum, citizeninfo* headOfFamily) {
+    housenode* house = resolveHouse(sectorName, streetNum, houseNum);
     if (!house) return;
-    house->family->sethead(headOfFamily);
+
+    // sethead deletes the old family, so drop its members from the indexes first
+    if (house->family->getroot()) {
+        unindexFamily(house->family->getroot());
+    }
+    famnode* head = house->family->sethead(headOfFamily);
     citizenHash->insert(headOfFamily->cnic, headOfFamily);
+    famnodeHash->insert(headOfFamily->cnic, head);
+    countCitizen(head, true);
+}
+
+bool PopulationManager::addFamilyMember(string parentCNIC, citizeninfo* member) {
+    // Parent ka node seedha index se, poora sheher scan karne ki zaroorat nahi
+    famnode* parent = findFamilyNode(parentCNIC);
+    if (!parent || !parent->house) return false;
+
+    famnode* node = parent->house->family->addchild(parent, member);
+    citizenHash->insert(member->cnic, member);
+    famnodeHash->insert(member->cnic, node);
+    countCitizen(node, true);
+    return true;
+}
+
+bool PopulationManager::moveFamily(string headCNIC, string sectorName, int streetNum, int houseNum) {
+    famnode* head = findFamilyNode(headCNIC);
+    if (!head || head->parent || !head->house) return false; // only a family head moves the family
+
+    housenode* target = resolveHouse(sectorName, streetNum, houseNum);
+    if (!target) return false;
+
+    // famnodes stay the same, so the index entries stay valid
+    housenode* fromHouse = head->house;
+    Sector* fromSector = fromHouse->street ? fromHouse->street->sector : nullptr;
+    if (!fromHouse->family->movetree(target->family)) return false;
+
+    // poori family ek ghar se doosre ghar, grid mein do cells badalte hain
+    int members = target->family->getmembers();
+    placePeople(fromHouse, members, false);
+    placePeople(target, members, true);
+
+    // city totals don't change, only the two sectors do
+    Sector* toSector = target->street ? target->street->sector : nullptr;
+    if (fromSector != toSector) {
+        countFamily(head, fromSector, false);
+        countFamily(head, toSector, true);
+    }
+    return true;
+}
+
+void PopulationManager::unindexFamily(famnode* node) {
+    if (!node) return;
+    if (famnodeHash->search(node->citizen->cnic) == node) {
+        famnodeHash->remove(node->citizen->cnic);
+        citizenHash->remove(node->citizen->cnic);
+    }
+    countCitizen(node, false);
+    unindexFamily(node->child);
+    unindexFamily(node->sibling);
+}
+
+void PopulationManager::countCitizen(famnode* node, bool adding) {
+    if (!node) return;
+    Sector* sector = (node->house && node->house->street) ? node->house->street->sector : nullptr;
+    citizeninfo* c = node->citizen;
+    if (adding) {
+        city->stats.add(c);
+        if (sector) sector->stats.add(c);
+        node->row = citizenTable->append(c->cnic, c->age, c->gender, c->occupation,
+            sector ? sector->sectorName : "");
+        placePeople(node->house, 1, true);
+    }
+    else {
+        city->stats.remove(c);
+        if (sector) sector->stats.remove(c);
+        placePeople(node->house, 1, false);
+        citizenTable->removeRow(node->row);
+        node->row = -1;
+    }
+}
+
+void PopulationManager::countFamily(famnode* node, Sector* sector, bool adding) {
+    if (!node || !sector) return;
+    if (adding) {
+        sector->stats.add(node->citizen);
+        citizenTable->setSector(node->row, sector->sectorName);
+    }
+    else sector->stats.remove(node->citizen);
+    countFamily(node->child, sector, adding);
+    countFamily(node->sibling, sector, adding);
+}
+
+void PopulationManager::placePeople(housenode* house, int people, bool adding) {
+    if (!house) return;
+    if (!house->located) ungeocoded += adding ? people : -people;
+    else if (adding) density->add(house->lat, house->lon, people);
+    else density->remove(house->lat, house->lon, people);
 }
 
-void PopulationManager::addFamilyMember(string parentCNIC, citizeninfo* member) {
-    // Traverse all houses to find parent and add child
-    Sector* curr_sector = city->sectors;
-    while (curr_sector) {
-        Street* st = curr_sector->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                h->family->addnode(parentCNIC, member);
-                h = h->next;
+void PopulationManager::rebuildDensity(double cellSizeMeters) {
+    // grid sab sectors ko cover kare (thora margin ke saath)
+    SectorGazetteer* gaz = SectorGazetteer::getShared();
+    double minLat = SectorGazetteer::CITY_CENTER_LATITUDE, maxLat = minLat;
+    double minLon = SectorGazetteer::CITY_CENTER_LONGITUDE, maxLon = minLon;
+    for (int i = 0; i < gaz->getSectorCount(); i++) {
+        const SectorInfo* info = gaz->getSectorAt(i);
+        if (info->minLatitude < minLat) minLat = info->minLatitude;
+        if (info->minLongitude < minLon) minLon = info->minLongitude;
+        if (info->maxLatitude > maxLat) maxLat = info->maxLatitude;
+        if (info->maxLongitude > maxLon) maxLon = info->maxLongitude;
+    }
+    const double margin = 0.01;
+
+    delete density;
+    density = new DensityGrid(minLat - margin, minLon - margin, maxLat + margin, maxLon + margin, cellSizeMeters);
+    ungeocoded = 0;
+
+    for (Sector* s = city->sectors; s; s = s->next) {
+        for (Street* st = s->streets; st; st = st->next) {
+            for (housenode* h = st->houses; h; h = h->next) {
+                placePeople(h, h->family->getmembers(), true);
             }
-            st = st->next;
         }
-        curr_sector = curr_sector->next;
     }
-    citizenHash->insert(member->cnic, member);
+}
+
+void PopulationManager::setDensityCellSize(double meters) {
+    rebuildDensity(meters);
 }
 
 citizeninfo* PopulationManager::searchCitizen(string cnic) {
     return static_cast<citizeninfo*>(citizenHash->search(cnic));
 }
 
+famnode* PopulationManager::findFamilyNode(string cnic) {
+    return static_cast<famnode*>(famnodeHash->search(cnic));
+}
+
+housenode* PopulationManager::findCitizenHouse(string cnic) {
+    famnode* node = findFamilyNode(cnic);
+    return node ? node->house : nullptr;
+}
+
 void PopulationManager::displayCitizenInfo(string cnic) {
     citizeninfo* cit = searchCitizen(cnic);
     if (!cit) {
@@ -298,109 +537,28 @@ void PopulationManager::displayAllCitizens() {
     citizenHash->display();
 }
 
-// Helper: collect all citizens from family tree
-void PopulationManager::collectAllCitizens(famnode* node, citizeninfo** citizens, int& count) {
-    if (!node) return;
-    citizens[count++] = node->citizen;
-    collectAllCitizens(node->child, citizens, count);
-    collectAllCitizens(node->sibling, citizens, count);
-}
-
-void PopulationManager::traverseHousesForCitizens(housenode* house, citizeninfo** citizens, int& count) {
-    while (house) {
-        if (house->family && house->family->getroot())
-            collectAllCitizens(house->family->getroot(), citizens, count);
-        house = house->next;
-    }
-}
-
-void PopulationManager::traverseStreetsForCitizens(Street* street, citizeninfo** citizens, int& count) {
-    while (street) {
-        traverseHousesForCitizens(street->houses, citizens, count);
-        street = street->next;
-    }
-}
-
-void PopulationManager::traverseSectorsForCitizens(Sector* sector, citizeninfo** citizens, int& count) {
-    while (sector) {
-        traverseStreetsForCitizens(sector->streets, citizens, count);
-        sector = sector->next;
-    }
-}
-
 // Report: Age Distribution
 void PopulationManager::generateAgeDistribution() {
-    const int MAX_POP = 10000;
-    citizeninfo* citizens[MAX_POP];
-    int count = 0;
-
-    Sector* curr_sector = city->sectors;
-    traverseSectorsForCitizens(curr_sector, citizens, count);
-
-    int under18 = 0, adults = 0, seniors = 0;
-    for (int i = 0; i < count; ++i) {
-        if (citizens[i]->age < 18) under18++;
-        else if (citizens[i]->age < 60) adults++;
-        else seniors++;
-    }
+    popstats& st = city->stats;
     cout << "Age Distribution:\n";
-    cout << "Under 18: " << under18 << ", Adults (18-59): " << adults << ", Seniors (60+): " << seniors << endl;
+    cout << "Under 18: " << st.under18 << ", Adults (18-59): " << st.adults << ", Seniors (60+): " << st.seniors << endl;
 }
 
 // Report: Gender Ratio
 void PopulationManager::generateGenderRatio() {
-    const int MAX_POP = 10000;
-    citizeninfo* citizens[MAX_POP];
-    int count = 0;
-
-    Sector* curr_sector = city->sectors;
-    traverseSectorsForCitizens(curr_sector, citizens, count);
-
-    int male = 0, female = 0, other = 0;
-    for (int i = 0; i < count; ++i) {
-        if (citizens[i]->gender == "Male") male++;
-        else if (citizens[i]->gender == "Female") female++;
-        else other++;
-    }
+    popstats& st = city->stats;
     cout << "Gender Ratio:\n";
-    cout << "Males: " << male << ", Females: " << female << ", Others: " << other << endl;
+    cout << "Males: " << st.male << ", Females: " << st.female << ", Others: " << st.other << endl;
 }
 
 // Report: Occupation Breakdown
 void PopulationManager::generateOccupationBreakdown() {
-    const int MAX_POP = 10000;
-    const int MAX_OCCUPATIONS = 100;
-    citizeninfo* citizens[MAX_POP];
-    int count = 0;
-
-    Sector* curr_sector = city->sectors;
-    traverseSectorsForCitizens(curr_sector, citizens, count);
-
-    // Simple occupation counting
-    string occupations[MAX_OCCUPATIONS];
-    int occ_counts[MAX_OCCUPATIONS];
-    int occ_total = 0;
-
-    for (int i = 0; i < count; ++i) {
-        string curr_occ = citizens[i]->occupation;
-        bool found = false;
-        for (int j = 0; j < occ_total; ++j) {
-            if (occupations[j] == curr_occ) {
-                occ_counts[j]++;
-                found = true;
-                break;
-            }
-        }
-        if (!found && occ_total < MAX_OCCUPATIONS) {
-            occupations[occ_total] = curr_occ;
-            occ_counts[occ_total] = 1;
-            occ_total++;
-        }
-    }
-
+    popstats& st = city->stats;
     cout << "Occupation Breakdown:\n";
-    for (int i = 0; i < occ_total; ++i) {
-        cout << occupations[i] << " : " << occ_counts[i] << endl;
+    for (int i = 0; i < st.occTotal; ++i) {
+        if (st.occCounts[i] > 0) {
+            cout << st.occupations[i] << " : " << st.occCounts[i] << endl;
+        }
     }
 }
 
@@ -409,37 +567,32 @@ void PopulationManager::generatePopulationDensity() {
     cout << "Population Density per Sector:\n";
     Sector* s = city->sectors;
     while (s) {
-        int sectorCount = 0;
-        Street* st = s->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                sectorCount += h->family->getmembers();
-                h = h->next;
-            }
-            st = st->next;
-        }
-        cout << "Sector " << s->sectorName << " : " << sectorCount << " people\n";
+        cout << "Sector " << s->sectorName << " : " << s->stats.members << " people\n";
         s = s->next;
     }
 }
 
 int PopulationManager::getTotalPopulation() {
-    int total = 0;
-    Sector* s = city->sectors;
-    while (s) {
-        Street* st = s->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                total += h->family->getmembers();
-                h = h->next;
-            }
-            st = st->next;
-        }
-        s = s->next;
+    return city->stats.members;
+}
+
+// citizen table ke live rows se query view banao (removed rows skip)
+QueryTable* PopulationManager::buildCitizenView() {
+    QueryTable* view = new QueryTable("Citizens", citizenTable->getLiveCount());
+    int sectorCol = view->addCategoryColumn("Sector");
+    int genderCol = view->addCategoryColumn("Gender");
+    int occupationCol = view->addCategoryColumn("Occupation");
+    int ageCol = view->addNumberColumn("Age");
+
+    for (int r = 0; r < citizenTable->getRowCount(); r++) {
+        if (!citizenTable->isLive(r)) continue;
+        int row = view->addRow();
+        view->setCategory(row, sectorCol, citizenTable->getSector(r));
+        view->setCategory(row, genderCol, citizenTable->getGender(r));
+        view->setCategory(row, occupationCol, citizenTable->getOccupation(r));
+        view->setNumber(row, ageCol, citizenTable->getAge(r));
     }
-    return total;
+    return view;
 }
 
 // ============================================
@@ -464,34 +617,14 @@ void PopulationManager::displayColorHeatmap() {
         return;
     }
 
-    const int MAX_SECTORS = 100;
-    string sectorNames[MAX_SECTORS];
-    int sectorPops[MAX_SECTORS];
-    int sectorCount = 0;
+    // pehle max/total, phir list dobara chal kar print (jitne bhi sectors hon)
     int maxPop = 0;
     int totalPop = 0;
 
-    Sector* tempSector = city->sectors;
-    while (tempSector && sectorCount < MAX_SECTORS) {
-        int pop = 0;
-        Street* tempStreet = tempSector->streets;
-        while (tempStreet) {
-            housenode* tempHouse = tempStreet->houses;
-            while (tempHouse) {
-                pop += tempHouse->family->getmembers();
-                tempHouse = tempHouse->next;
-            }
-            tempStreet = tempStreet->next;
-        }
-
-        sectorNames[sectorCount] = tempSector->sectorName;
-        sectorPops[sectorCount] = pop;
+    for (Sector* tempSector = city->sectors; tempSector; tempSector = tempSector->next) {
+        int pop = tempSector->stats.members;
         totalPop += pop;
-
         if (pop > maxPop) maxPop = pop;
-
-        sectorCount++;
-        tempSector = tempSector->next;
     }
 
     if (maxPop == 0) {
@@ -510,8 +643,10 @@ void PopulationManager::displayColorHeatmap() {
     cout << "Sector Name          Population  Density\n";
     cout << "-------------------------------------------\n";
 
-    for (int i = 0; i < sectorCount; i++) {
-        double percentage = (double)sectorPops[i] / maxPop * 100.0;
+    for (Sector* tempSector = city->sectors; tempSector; tempSector = tempSector->next) {
+        const string& sectorName = tempSector->sectorName;
+        int pop = tempSector->stats.members;
+        double percentage = (double)pop / maxPop * 100.0;
 
         const char* colorCode = COLOR_RESET;
         if (percentage >= 80.0) colorCode = COLOR_RED_BG;
@@ -520,12 +655,12 @@ void PopulationManager::displayColorHeatmap() {
         else if (percentage >= 20.0) colorCode = COLOR_BLUE_BG;
         else colorCode = COLOR_CYAN_BG;
 
-        cout << colorCode << " " << sectorNames[i];
-        for (int j = (int)sectorNames[i].length(); j < 18; j++) {
+        cout << colorCode << " " << sectorName;
+        for (int j = (int)sectorName.length(); j < 18; j++) {
             cout << " ";
         }
-        cout << "  " << sectorPops[i];
-        for (int j = 0; j < 10 - (sectorPops[i] >= 10 ? 2 : 1); j++) cout << " ";
+        cout << "  " << pop;
+        for (int j = 0; j < 10 - (pop >= 10 ? 2 : 1); j++) cout << " ";
         cout << (int)percentage << "%" << COLOR_RESET << "\n";
     }
 
@@ -570,34 +705,14 @@ void PopulationManager::displaySectorHeatmap() {
         return;
     }
 
-    const int MAX_SECTORS = 100;
-    string sectorNames[MAX_SECTORS];
-    int sectorPops[MAX_SECTORS];
-    int sectorCount = 0;
+    // pehle max/total, phir list dobara chal kar print (jitne bhi sectors hon)
     int maxPop = 0;
     int totalPop = 0;
 
-    Sector* s = city->sectors;
-    while (s && sectorCount < MAX_SECTORS) {
-        int pop = 0;
-        Street* st = s->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                pop += h->family->getmembers();
-                h = h->next;
-            }
-            st = st->next;
-        }
-
-        sectorNames[sectorCount] = s->sectorName;
-        sectorPops[sectorCount] = pop;
+    for (Sector* s = city->sectors; s; s = s->next) {
+        int pop = s->stats.members;
         totalPop += pop;
-
         if (pop > maxPop) maxPop = pop;
-
-        sectorCount++;
-        s = s->next;
     }
 
     if (maxPop == 0) {
@@ -616,8 +731,10 @@ void PopulationManager::displaySectorHeatmap() {
     cout << "\nSector Name          | Population | Density Bar\n";
     cout << "---------------------+------------+------------------\n";
 
-    for (int i = 0; i < sectorCount; i++) {
-        double percentage = (double)sectorPops[i] / maxPop * 100.0;
+    for (Sector* s = city->sectors; s; s = s->next) {
+        const string& sectorName = s->sectorName;
+        int pop = s->stats.members;
+        double percentage = (double)pop / maxPop * 100.0;
 
         const char* colorCode = COLOR_RESET;
         if (percentage >= 80.0) colorCode = COLOR_RED;
@@ -626,16 +743,16 @@ void PopulationManager::displaySectorHeatmap() {
         else if (percentage >= 20.0) colorCode = COLOR_BLUE;
         else colorCode = COLOR_CYAN;
 
-        cout << sectorNames[i];
-        for (int j = (int)sectorNames[i].length(); j < 20; j++) cout << " ";
+        cout << sectorName;
+        for (int j = (int)sectorName.length(); j < 20; j++) cout << " ";
 
         cout << " | ";
-        if (sectorPops[i] < 10) cout << "   ";
-        else if (sectorPops[i] < 100) cout << "  ";
-        else if (sectorPops[i] < 1000) cout << " ";
-        cout << sectorPops[i] << "      ";
+        if (pop < 10) cout << "   ";
+        else if (pop < 100) cout << "  ";
+        else if (pop < 1000) cout << " ";
+        cout << pop << "      ";
 
-        cout << " | " << colorCode << getHeatmapSymbol(sectorPops[i], maxPop) << COLOR_RESET;
+        cout << " | " << colorCode << getHeatmapSymbol(pop, maxPop) << COLOR_RESET;
 
         cout << " (" << (int)percentage << "%)\n";
     }
@@ -651,57 +768,35 @@ void PopulationManager::generatePopulationHeatmap() {
 
     cout << "\n--- Density Analysis ---\n";
 
-    const int MAX_SECTORS = 100;
-    string sectorNames[MAX_SECTORS];
-    int sectorPops[MAX_SECTORS];
-    int sectorCount = 0;
-
-    Sector* s = city->sectors;
-    while (s && sectorCount < MAX_SECTORS) {
-        int pop = 0;
-        Street* st = s->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                pop += h->family->getmembers();
-                h = h->next;
-            }
-            st = st->next;
-        }
-
-        sectorNames[sectorCount] = s->sectorName;
-        sectorPops[sectorCount] = pop;
-        sectorCount++;
-        s = s->next;
-    }
-
-    if (sectorCount == 0) {
+    if (!city->sectors) {
         cout << "No sectors available.\n";
         return;
     }
 
-    int maxIdx = 0, minIdx = 0;
-    for (int i = 1; i < sectorCount; i++) {
-        if (sectorPops[i] > sectorPops[maxIdx]) maxIdx = i;
-        if (sectorPops[i] < sectorPops[minIdx]) minIdx = i;
+    // seedha sector list par, koi fixed array ya cap nahi
+    Sector* most = city->sectors;
+    Sector* least = city->sectors;
+    int sectorCount = 0;
+    int total = 0;
+    for (Sector* s = city->sectors; s; s = s->next) {
+        if (s->stats.members > most->stats.members) most = s;
+        if (s->stats.members < least->stats.members) least = s;
+        total += s->stats.members;
+        sectorCount++;
     }
 
-    cout << "Most Populated: " << sectorNames[maxIdx]
-        << " (" << sectorPops[maxIdx] << " people)\n";
-    cout << "Least Populated: " << sectorNames[minIdx]
-        << " (" << sectorPops[minIdx] << " people)\n";
+    cout << "Most Populated: " << most->sectorName
+        << " (" << most->stats.members << " people)\n";
+    cout << "Least Populated: " << least->sectorName
+        << " (" << least->stats.members << " people)\n";
 
-    int total = 0;
-    for (int i = 0; i < sectorCount; i++) {
-        total += sectorPops[i];
-    }
     double avg = (double)total / sectorCount;
     cout << "Average per Sector: " << (int)avg << " people\n";
 
     int veryhigh = 0, high = 0, medium = 0, low = 0, verylow = 0, empty = 0;
-    int maxPop = sectorPops[maxIdx];
-    for (int i = 0; i < sectorCount; i++) {
-        double percentage = (double)sectorPops[i] / maxPop * 100.0;
+    int maxPop = most->stats.members;
+    for (Sector* s = city->sectors; s; s = s->next) {
+        double percentage = maxPop > 0 ? (double)s->stats.members / maxPop * 100.0 : 0.0;
 
         if (percentage >= 80.0) veryhigh++;
         else if (percentage >= 60.0) high++;
@@ -724,31 +819,13 @@ void PopulationManager::exportHeatmapToFile(const string& filename) {
     cout << "\n=== Exporting Heatmap to File ===\n";
     cout << "Exporting to: " << filename << "\n";
 
-    const int MAX_SECTORS = 100;
-    string sectorNames[MAX_SECTORS];
-    int sectorPops[MAX_SECTORS];
+    // pehle count/max, phir list dobara chal kar likhte hain (jitne bhi sectors hon)
     int sectorCount = 0;
     int maxPop = 0;
 
-    Sector* s = city->sectors;
-    while (s && sectorCount < MAX_SECTORS) {
-        int pop = 0;
-        Street* st = s->streets;
-        while (st) {
-            housenode* h = st->houses;
-            while (h) {
-                pop += h->family->getmembers();
-                h = h->next;
-            }
-            st = st->next;
-        }
-
-        sectorNames[sectorCount] = s->sectorName;
-        sectorPops[sectorCount] = pop;
-        if (pop > maxPop) maxPop = pop;
-
+    for (Sector* s = city->sectors; s; s = s->next) {
+        if (s->stats.members > maxPop) maxPop = s->stats.members;
         sectorCount++;
-        s = s->next;
     }
 
     if (sectorCount == 0) {
@@ -768,8 +845,9 @@ void PopulationManager::exportHeatmapToFile(const string& filename) {
     outFile << "Sector,Population,DensityLevel,DensityPercentage\n";
 
     // Write data rows
-    for (int i = 0; i < sectorCount; i++) {
-        double percentage = maxPop > 0 ? (double)sectorPops[i] / maxPop * 100.0 : 0;
+    for (Sector* s = city->sectors; s; s = s->next) {
+        int pop = s->stats.members;
+        double percentage = maxPop > 0 ? (double)pop / maxPop * 100.0 : 0;
 
         string level;
         if (percentage >= 80.0) level = "VeryHigh";
@@ -780,7 +858,7 @@ void PopulationManager::exportHeatmapToFile(const string& filename) {
         else level = "Empty";
 
         // Write to file
-        outFile << sectorNames[i] << "," << sectorPops[i] << "," << level << "," << (int)percentage << "\n";
+        outFile << s->sectorName << "," << pop << "," << level << "," << (int)percentage << "\n";
     }
 
     // Close file
@@ -813,6 +891,7 @@ void PopulationManager::run() {
     string cnic, name, gender, occupation;
     int age;
     string mcnic;
+    citizeninfo* member;
 
     while (choice != 0) {
         displayMenu();
@@ -891,8 +970,14 @@ void PopulationManager::run() {
             cout << "Occupation: ";
             cin.ignore();
             getline(cin, occupation);
-            addFamilyMember(cnic, new citizeninfo(mcnic, name, age, gender, occupation));
-            cout << "Family member added successfully!\n";
+            member = new citizeninfo(mcnic, name, age, gender, occupation);
+            if (addFamilyMember(cnic, member)) {
+                cout << "Family member added successfully!\n";
+            } else {
+                // parent nahi mila, member abhi bhi hamara hai
+                delete member;
+                cout << "Parent not found! Family member not added.\n";
+            }
             break;
 
         case 6:
@@ -978,103 +1063,176 @@ void loadSampleData(PopulationManager* pm) {
 
 
 // -------------------------- CSV Data Loading --------------------------
-bool PopulationManager::loadPopulationFromCSV(const string& filename) {
-    const int MAX_ROWS = 1000;
-    CSVRow populationData[MAX_ROWS];
-    int actualRows = 0;
-
-    DataLoader loader;
-
-    cout << "Loading population data from: " << filename << endl;
-
-    if (!loader.loadPopulation(filename, populationData, MAX_ROWS, actualRows)) {
-        cout << "Failed to load population data!" << endl;
-        return false;
+// one parsed census row, waiting to be placed in the hierarchy
+struct poprow {
+    citizeninfo* citizen;
+    int sector; // code in the loader's sector dictionary
+    int street;
+    int house;
+};
+
+// digits only, baaki characters ignore (e.g. "Street 5" -> 5)
+static int parsedigits(const string& text) {
+    int value = 0;
+    for (size_t j = 0; j < text.length(); j++) {
+        if (text[j] >= '0' && text[j] <= '9') {
+            value = value * 10 + (text[j] - '0');
+        }
     }
+    return value;
+}
 
-    cout << "Processing " << actualRows << " population records..." << endl;
-
-    // CSV Format: CNIC, Name, Gender, Age, Sector, Street, HouseNo, Occupation
-    for (int i = 0; i < actualRows; i++) {
-        CSVRow& row = populationData[i];
-
-        if (row.fieldCount < 8) {
-            cout << "Skipping incomplete row " << (i + 1) << " (expected 8 fields, got " << row.fieldCount << ")" << endl;
-            continue;
-        }
+static bool rowbefore(const poprow& a, const poprow& b) {
+    if (a.sector != b.sector) return a.sector < b.sector;
+    if (a.street != b.street) return a.street < b.street;
+    return a.house < b.house;
+}
 
-        // Extract data from CSV row according to new format
-        string cnic = row.fields[0];      // CNIC
-        string name = row.fields[1];      // Name
-        string gender = row.fields[2];    // Gender 
-        int age = 0;
-
-        // Convert age string to int (manual conversion)
-        // Age is now at position 3 (was position 2)
-        for (size_t j = 0; j < row.fields[3].length(); j++) {
-            if (row.fields[3][j] >= '0' && row.fields[3][j] <= '9') {
-                age = age * 10 + (row.fields[3][j] - '0');
+// stable bottom-up merge sort, so file order is kept inside a house (pehla row = head)
+static void sortrows(poprow* rows, int count) {
+    poprow* temp = new poprow[count];
+    for (int width = 1; width < count; width *= 2) {
+        for (int left = 0; left < count; left += 2 * width) {
+            int mid = (left + width < count) ? left + width : count;
+            int right = (left + 2 * width < count) ? left + 2 * width : count;
+            int i = left, j = mid, k = left;
+            while (i < mid && j < right) {
+                if (rowbefore(rows[j], rows[i])) temp[k++] = rows[j++];
+                else temp[k++] = rows[i++];
             }
+            while (i < mid) temp[k++] = rows[i++];
+            while (j < right) temp[k++] = rows[j++];
         }
+        for (int i = 0; i < count; i++) rows[i] = temp[i];
+    }
+    delete[] temp;
+}
 
-        string sector = row.fields[4];    // Sector
-        int streetNum = 0;
-
-        // Convert street to int
-        // Street is now at position 5 
-        for (size_t j = 0; j < row.fields[5].length(); j++) {
-            if (row.fields[5][j] >= '0' && row.fields[5][j] <= '9') {
-                streetNum = streetNum * 10 + (row.fields[5][j] - '0');
+int PopulationManager::buildFromSortedRows(poprow* rows, int count, StringDictionary* sectorNames) {
+    int added = 0;
+    int i = 0;
+    while (i < count) {
+        int sectorEnd = i;
+        while (sectorEnd < count && rows[sectorEnd].sector == rows[i].sector) sectorEnd++;
+
+        string sectorName = sectorNames->decode(rows[i].sector);
+        city->addSector(sectorName);
+        Sector* sec = city->findSector(sectorName);
+
+        while (i < sectorEnd) {
+            int streetEnd = i;
+            while (streetEnd < sectorEnd && rows[streetEnd].street == rows[i].street) streetEnd++;
+
+            sec->addStreet(rows[i].street);
+            Street* st = sec->findStreet(rows[i].street);
+
+            while (i < streetEnd) {
+                int houseEnd = i;
+                while (houseEnd < streetEnd && rows[houseEnd].house == rows[i].house) houseEnd++;
+
+                st->addHouse(rows[i].house);
+                housenode* house = st->findHouse(rows[i].house);
+
+                // pehla row head banta hai, baaki ghar wale uske members
+                // (agar ghar mein pehle se family hai to sab usi head ke neeche)
+                famnode* head = house->family->getroot();
+                famnode* last = head ? head->child : nullptr;
+                while (last && last->sibling) last = last->sibling;
+
+                for (; i < houseEnd; i++) {
+                    citizeninfo* c = rows[i].citizen;
+                    if (citizenHash->search(c->cnic)) {
+                        delete c; // same CNIC dobara, skip
+                        continue;
+                    }
+
+                    famnode* node;
+                    if (!head) {
+                        node = head = house->family->sethead(c);
+                    }
+                    else {
+                        node = house->family->addchild(head, c, last);
+                        last = node;
+                    }
+                    citizenHash->insert(c->cnic, c);
+                    famnodeHash->insert(c->cnic, node);
+                    countCitizen(node, true);
+                    added++;
+                }
             }
         }
+    }
+    return added;
+}
 
-        int houseNum = 0;
+// CSV Format: CNIC, Name, Gender, Age, Sector, Street, HouseNo, Occupation
+// Rows are streamed (no fixed buffer), grouped by (sector, street, house) with one sort,
+// and the hierarchy is built bottom-up so each sector/street/house is looked up once
+bool PopulationManager::loadPopulationFromCSV(const string& filename) {
+    CSVStream csv(8);
 
-        // Convert house to int
-        // HouseNo is now at position 6
-        for (size_t j = 0; j < row.fields[6].length(); j++) {
-            if (row.fields[6][j] >= '0' && row.fields[6][j] <= '9') {
-                houseNum = houseNum * 10 + (row.fields[6][j] - '0');
-            }
-        }
+    cout << "Loading population data from: " << filename << endl;
+
+    if (!csv.open(filename)) {
+        cout << "Failed to load population data!" << endl;
+        return false;
+    }
 
-        string occupation = row.fields[7]; // Occupation (now at position 7)
+    int capacity = 1024;
+    int count = 0;
+    int skipped = 0;
+    poprow* rows = new poprow[capacity];
+    StringDictionary sectorNames(32);
 
-        // Add sector if doesn't exist
-        if (!city->findSector(sector)) {
-            addSector(sector);
+    while (csv.next()) {
+        if (csv.getFieldCount() < 8 || csv.field(0).empty() || csv.field(4).empty()) {
+            skipped++;
+            continue;
         }
 
-        // Add street if doesn't exist
-        Sector* sec = city->findSector(sector);
-        if (sec && !sec->findStreet(streetNum)) {
-            addStreet(sector, streetNum);
+        if (count >= capacity) {
+            int newCapacity = capacity * 2;
+            poprow* newRows = new poprow[newCapacity];
+            for (int i = 0; i < count; i++) newRows[i] = rows[i];
+            delete[] rows;
+            rows = newRows;
+            capacity = newCapacity;
         }
 
-        // Add house if doesn't exist
-        if (sec) {
-            Street* st = sec->findStreet(streetNum);
-            if (st && !st->findHouse(houseNum)) {
-                addHouse(sector, streetNum, houseNum);
-            }
+        // fields swap karke lo, copy nahi
+        citizeninfo* c = new citizeninfo();
+        c->cnic.swap(csv.field(0));
+        c->name.swap(csv.field(1));
+        c->gender.swap(csv.field(2));
+        c->age = parsedigits(csv.field(3));
+        c->occupation.swap(csv.field(7));
+
+        poprow& row = rows[count++];
+        row.citizen = c;
+        row.sector = sectorNames.encode(csv.field(4));
+        row.street = parsedigits(csv.field(5));
+        row.house = parsedigits(csv.field(6));
+    }
+    csv.close();
 
-            // Add family (as family head for now - you can enhance this later)
-            if (st) {
-                housenode* house = st->findHouse(houseNum);
-                if (house && house->family->getroot() == nullptr) {
-                    // House is empty, add as family head
-                    addFamily(sector, streetNum, houseNum,
-                        new citizeninfo(cnic, name, age, gender, occupation));
-                }
-                else {
-                    // House has family, add as member
-                    // For simplicity, we'll skip or you can enhance to detect parent CNIC
-                    cout << "Note: House " << houseNum << " already has a family. Skipping " << name << endl;
-                }
-            }
-        }
+    cout << "Processing " << count << " population records..." << endl;
+    if (skipped > 0) {
+        cout << "Skipped " << skipped << " incomplete rows (expected 8 fields with CNIC and Sector)" << endl;
     }
 
+    // hash tables ko ek hi dafa bara kar do, warna har doubling par rehash hota
+    int expected = citizenHash->getSize() + count;
+    citizenHash->resize(expected * 2 + 1);
+    famnodeHash->resize(expected * 2 + 1);
+    citizenTable->reserve(count);
+
+    sortrows(rows, count);
+    int added = buildFromSortedRows(rows, count, &sectorNames);
+    delete[] rows;
+
+    if (added < count) {
+        cout << "Skipped " << (count - added) << " rows with a CNIC that is already registered" << endl;
+    }
     cout << "Population data loaded successfully!" << endl;
     cout << "Total citizens: " << citizenHash->getSize() << endl;
     return true;
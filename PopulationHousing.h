@@ -5,6 +5,9 @@
 #include <string>
 #include "core_classes/HashTable.h" 
 #include "core_classes/DataLoader.h"
+#include "core_classes/CitizenTable.h"
+#include "core_classes/QueryTable.h"
+#include "core_classes/DensityGrid.h"
 using namespace std;
 
 
@@ -24,14 +27,45 @@ public:
 };
 
 
+// running totals for a sector or the whole city, updated on every insert/delete
+// so reports never have to walk the family trees
+class popstats {
+public:
+    int members;
+    int under18, adults, seniors; // age buckets: <18, 18-59, 60+
+    int male, female, other;
+    string* occupations;          // occupation histogram, first-seen order
+    int* occCounts;
+    int occTotal;
+    int occCapacity;
+
+    popstats();
+    ~popstats();
+
+    void add(citizeninfo* c);
+    void remove(citizeninfo* c);
+
+private:
+    int findOccupation(const string& occ); // -1 if not seen yet
+};
+
+class housenode;
+class Street;
+class Sector;
+struct poprow; // bulk loader ka parsed row (PopulationHousing.cpp)
+
 //this is a family node for the family tree made using n-ary tree
 class famnode {
 public:
     citizeninfo* citizen;
     famnode* child;   
     famnode* sibling; 
+    famnode* parent;  // nullptr for the head of family
+    housenode* house; // house the family lives in
+    int row;          // row in the columnar citizen table (-1 if not counted)
 
-    famnode(citizeninfo* c) : citizen(c), child(nullptr), sibling(nullptr) {}
+    famnode(citizeninfo* c, famnode* p = nullptr, housenode* h = nullptr)
+        : citizen(c), child(nullptr), sibling(nullptr), parent(p), house(h), row(-1) {}
 };
 
 // ============================================
@@ -43,18 +77,27 @@ public:
 class famtree {
 private:
     famnode* root;
+    housenode* home; // house that owns this tree
 
     void deltree(famnode* node);
     void displaytree(famnode* node, int level);
     int countmem(famnode* node);
+    void sethouse(famnode* node);
 
 public:
-    famtree();
+    famtree(housenode* h = nullptr);
     ~famtree();
 
-    void sethead(citizeninfo* headOfFamily);
+    famnode* sethead(citizeninfo* headOfFamily);
 
     void addnode(string parentCNIC, citizeninfo* child);
+
+    // add child directly under a known node (no search), returns the new node
+    // lastchild: parent ka current last child agar pata ho, taake sibling list walk na karni pare
+    famnode* addchild(famnode* parent, citizeninfo* child, famnode* lastchild = nullptr);
+
+    // hand the whole tree to another (empty) famtree, e.g. when a family moves house
+    bool movetree(famtree* target);
     void displayfam();
     int getmembers();
     famnode* getroot() { 
@@ -70,9 +113,12 @@ public:
     int houseNumber;
     famtree* family;
     housenode* next; // Linked list for street
+    Street* street;  // parent street (stats ke liye sector tak pohanchne ko)
+    double lat, lon; // ghar ki location (density grid ke liye), Street::addHouse set karta hai
+    bool located;    // false agar sector gazetteer mein nahi (lat/lon bekaar, grid par nahi jata)
 
-    housenode(int num) : houseNumber(num), family(nullptr), next(nullptr) {
-        family = new famtree();
+    housenode(int num, Street* owner = nullptr) : houseNumber(num), family(nullptr), next(nullptr), street(owner), lat(0.0), lon(0.0), located(false) {
+        family = new famtree(this);
     }
 
     ~housenode() {
@@ -87,9 +133,14 @@ class Street {
 public:
     int streetNumber;
     housenode* houses; // Linked list of houses
+    housenode* lastHouse; // tail, taake append O(1) ho
+    HashTable* houseHash; // house number -> housenode* (list scan ki jagah)
     Street* next;  // N-ary tree ke liye sibling
+    Sector* sector; // parent sector
 
-    Street(int num) : streetNumber(num), houses(nullptr), next(nullptr) {}
+    Street(int num, Sector* owner = nullptr) : streetNumber(num), houses(nullptr), lastHouse(nullptr), next(nullptr), sector(owner) {
+        houseHash = new HashTable(7);
+    }
 
     ~Street() {
         housenode* current = houses;
@@ -98,6 +149,7 @@ public:
             current = current->next;
             delete temp;
         }
+        delete houseHash;
     }
 
     void addHouse(int houseNum);
@@ -111,9 +163,14 @@ class Sector {
 public:
     string sectorName;
     Street* streets; // Linked list of streets
+    Street* lastStreet; // tail
+    HashTable* streetHash; // street number -> Street*
     Sector* next;    // N-ary tree ke liye sibling
+    popstats stats;  // is sector ke totals
 
-    Sector(string name) : sectorName(name), streets(nullptr), next(nullptr) {}
+    Sector(string name) : sectorName(name), streets(nullptr), lastStreet(nullptr), next(nullptr) {
+        streetHash = new HashTable(17);
+    }
 
     ~Sector() {
         Street* current = streets;
@@ -122,6 +179,7 @@ public:
             current = current->next;
             delete temp;
         }
+        delete streetHash;
     }
 
     void addStreet(int streetNum);
@@ -136,6 +194,9 @@ class City {
 public:
     string cityName;
     Sector* sectors; // Linked list of sectors
+    Sector* lastSector; // tail
+    HashTable* sectorHash; // sector name -> Sector*
+    popstats stats;        // city-wide totals
 
     void printHierarchy(Sector* sector, int level);
 
@@ -156,6 +217,31 @@ class PopulationManager {
 private:
     City* city;
     HashTable* citizenHash;  // Tumhari existing HashTable use karenge
+    HashTable* famnodeHash;  // CNIC -> famnode* (house milta hai famnode->house se)
+    CitizenTable* citizenTable; // columnar copy of every citizen, analytics queries ke liye
+    DensityGrid* density;       // people per grid cell (houses ki location se), O(1) update
+    int ungeocoded;             // log jin ke ghar ka sector gazetteer mein nahi (grid se bahar)
+
+    // sector -> street -> house, har level par hash lookup (nullptr if any level is missing)
+    housenode* resolveHouse(string sectorName, int streetNum, int houseNum);
+
+    // add/remove one citizen (or a whole family subtree) from the city and sector totals
+    // and keep the citizen table in step
+    void countCitizen(famnode* node, bool adding);
+    void countFamily(famnode* node, Sector* sector, bool adding);
+
+    // ghar ke log grid par add/remove, ghar ki location na ho to ungeocoded mein
+    void placePeople(housenode* house, int people, bool adding);
+
+    // remove a family's members from both hash tables (before the tree is deleted)
+    void unindexFamily(famnode* node);
+
+    // naya grid gazetteer ke sectors ke bounding box par, phir har ghar ke members dobara add
+    void rebuildDensity(double cellSizeMeters);
+
+    // bulk load ka second half: rows (sector, street, house) ke hisaab se sorted hain,
+    // har sector/street/house sirf ek dafa resolve hota hai aur family wahin ban jati hai
+    int buildFromSortedRows(poprow* rows, int count, StringDictionary* sectorNames);
 
 public:
     PopulationManager();
@@ -168,10 +254,13 @@ public:
 
     // Family & citizen operations
     void addFamily(string sectorName, int streetNum, int houseNum, citizeninfo* headOfFamily);
-    void addFamilyMember(string parentCNIC, citizeninfo* member);
+    bool addFamilyMember(string parentCNIC, citizeninfo* member); // false if parent not found (member not taken)
+    bool moveFamily(string headCNIC, string sectorName, int streetNum, int houseNum);
 
     // Search operations
     citizeninfo* searchCitizen(string cnic);
+    famnode* findFamilyNode(string cnic);     // O(1), gives parent/children/house of a citizen
+    housenode* findCitizenHouse(string cnic); // O(1)
     void displayCitizenInfo(string cnic);
     bool loadPopulationFromCSV(const string& filename);
     // Reports
@@ -179,7 +268,11 @@ public:
     void generateGenderRatio();
     void generateOccupationBreakdown();
     void generatePopulationDensity();
-    int getTotalPopulation();
+    int getTotalPopulation(); // O(1), from the running totals
+    QueryTable* buildCitizenView(); // Sector, Gender, Occupation, Age columns (caller must delete)
+    DensityGrid* getDensityGrid() { return density; }
+    void setDensityCellSize(double meters); // grid dobara banta hai, O(cells + houses)
+    int getUngeocodedCount() const { return ungeocoded; } // log jo grid par nahi (sector unknown)
 
     // Display functions
     void displayCityHierarchy();
@@ -189,12 +282,6 @@ public:
     void displayMenu();
     void run();
 
-    // Helper functions for reports
-    void collectAllCitizens(famnode* node, citizeninfo** citizens, int& count);
-    void traverseHousesForCitizens(housenode* house, citizeninfo** citizens, int& count);
-    void traverseStreetsForCitizens(Street* street, citizeninfo** citizens, int& count);
-    void traverseSectorsForCitizens(Sector* sector, citizeninfo** citizens, int& count);
-
     // Heatmap functions (bonus features)
     void displayColorHeatmap();
     void generatePopulationHeatmap();
@@ -206,6 +293,7 @@ public:
     // Get city pointer for integration with other modules
     City* getCity() { return city; }
     HashTable* getCitizenHash() { return citizenHash; }
+    CitizenTable* getCitizenTable() { return citizenTable; }
 };
 
 #endif
\ No newline at end of file
@@ -3,8 +3,6 @@
 #include <cmath>
 using namespace std;
 
-const double M_PI = 3.14159265358979323846;
-
 // Helper function to parse coordinates from string "lat, lon"
 static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     if (coordStr.empty()) return false;
@@ -83,31 +81,57 @@ static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
     return true;
 }
 
-// Helper function to calculate distance between two coordinates (Haversine formula)
-static double calculateDistance(double lat1, double lon1, double lat2, double lon2) {
-    const double R = 6371.0; // Earth radius in kilometers
+// Helper function to convert string to double (replaces stod from STL)
+static double stringToDouble(const string& str) {
+    if (str.empty()) return 0.0;
     
-    double dLat = (lat2 - lat1) * M_PI / 180.0;
-    double dLon = (lon2 - lon1) * M_PI / 180.0;
+    double result = 0.0;
+    double fraction = 0.1;
+    bool hasDecimal = false;
+    bool isNegative = false;
+    int i = 0;
     
-    double a = sin(dLat / 2.0) * sin(dLat / 2.0) +
-               cos(lat1 * M_PI / 180.0) * cos(lat2 * M_PI / 180.0) *
-               sin(dLon / 2.0) * sin(dLon / 2.0);
+    // Skip whitespace
+    while (i < (int)str.length() && (str[i] == ' ' || str[i] == '\t')) {
+        i++;
+    }
     
-    double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-    double distance = R * c;
+    // Check for negative sign
+    if (i < (int)str.length() && str[i] == '-') {
+        isNegative = true;
+        i++;
+    }
     
-    return distance;
+    // Parse digits
+    while (i < (int)str.length()) {
+        if (str[i] >= '0' && str[i] <= '9') {
+            if (!hasDecimal) {
+                result = result * 10.0 + (str[i] - '0');
+            } else {
+                result += (str[i] - '0') * fraction;
+                fraction *= 0.1;
+            }
+        } else if (str[i] == '.' && !hasDecimal) {
+            hasDecimal = true;
+        } else {
+            break;
+        }
+        i++;
+    }
+    
+    return isNegative ? -result : result;
 }
 
 // Constructor
 RailwayManager::RailwayManager(Graph* graph)
-    : cityGraph(graph), stationCount(0) {
+    : cityGraph(graph), stationCount(0), segmentCount(0) {
     // Initialize hash tables with reasonable sizes (prime numbers)
     stationsByID = new HashTable(101);
     stationsByName = new HashTable(101);
     stationsByCode = new HashTable(31); // Smaller size for codes (fewer codes than stations)
     allStationsList = new SinglyLinkedList();
+    railNetwork = new Graph(MAX_STATIONS, false); // Track runs both ways
+    transfers = new TransferTable();
 }
 
 // Destructor
@@ -131,11 +155,20 @@ RailwayManager::~RailwayManager() {
         delete allStationsList;
         allStationsList = nullptr;
     }
+    if (railNetwork != nullptr) {
+        delete railNetwork;
+        railNetwork = nullptr;
+    }
+    if (transfers != nullptr) {
+        delete transfers;
+        transfers = nullptr;
+    }
 }
 
 // Set the city graph
 void RailwayManager::setCityGraph(Graph* graph) {
     cityGraph = graph;
+    rebuildTransfers();
 }
 
 // Get the city graph
@@ -168,6 +201,15 @@ void RailwayManager::getAllStations(RailwayStation** stations, int& count) const
     delete[] stationIDs;
 }
 
+// Recompute the bus stop transfers of every station
+void RailwayManager::rebuildTransfers() {
+    transfers->clear();
+    for (int i = 0; i < railNetwork->getVertexCount(); i++) {
+        Vertex* vertex = railNetwork->getVertexAt(i);
+        transfers->addNode(vertex->vertexID, vertex->latitude, vertex->longitude, cityGraph);
+    }
+}
+
 // Add a station to the manager
 bool RailwayManager::addStation(RailwayStation* station) {
     if (station == nullptr) return false;
@@ -178,6 +220,13 @@ bool RailwayManager::addStation(RailwayStation* station) {
         return false; // Station already exists
     }
     
+    // Add station to the rail network (no track yet)
+    if (!railNetwork->addVertex(station->getStationID(), station->getName(),
+                                station->getLatitude(), station->getLongitude(), station)) {
+        return false; // Rail network is full
+    }
+    transfers->addNode(station->getStationID(), station->getLatitude(), station->getLongitude(), cityGraph);
+    
     // Add to all hash tables
     stationsByID->insert(station->getStationID(), (void*)station);
     stationsByName->insert(station->getName(), (void*)station);
@@ -191,26 +240,6 @@ bool RailwayManager::addStation(RailwayStation* station) {
         cityGraph->addVertex(station->getStationID(), station->getName(), 
                             station->getLatitude(), station->getLongitude(), station);
         cityGraph->connectToNearestStop(station->getStationID());
-        
-        int listSize = allStationsList->getSize();
-        if (listSize > 1) { // Only if there are other stations 
-            RailwayStation** allStations = new RailwayStation*[listSize];
-            int allCount = 0;
-            getAllStations(allStations, allCount);
-            
-            for (int i = 0; i < allCount; i++) {
-                if (allStations[i]->getStationID() != station->getStationID()) {
-                    // Calculate rail distance (straight line)
-                    double railDist = calculateDistance(station->getLatitude(), station->getLongitude(),
-                                                       allStations[i]->getLatitude(),
-                                                       allStations[i]->getLongitude());
-                    // Add edge with rail distance (bidirectional)
-                    cityGraph->addEdge(station->getStationID(), allStations[i]->getStationID(), railDist);
-                }
-            }
-            
-            delete[] allStations;
-        }
     }
     
     stationCount++;
@@ -308,8 +337,8 @@ RailwayStation* RailwayManager::findNearestStation(double latitude, double longi
     
     // Find nearest station
     for (int i = 0; i < count; i++) {
-        double dist = calculateDistance(latitude, longitude,
-                                       stations[i]->getLatitude(), stations[i]->getLongitude());
+        double dist = Graph::calculateDistance(latitude, longitude,
+                                              stations[i]->getLatitude(), stations[i]->getLongitude());
         if (minDistance < 0.0 || dist < minDistance) {
             minDistance = dist;
             nearestStation = stations[i];
@@ -320,44 +349,127 @@ RailwayStation* RailwayManager::findNearestStation(double latitude, double longi
     return nearestStation;
 }
 
-// Calculate rail distance between two stations (straight line distance)
-bool RailwayManager::calculateRailDistance(const string& fromStationID, const string& toStationID, double& distance) {
-    distance = 0.0;
-    if (fromStationID.empty() || toStationID.empty()) return false;
+// Add a track segment between two stations
+bool RailwayManager::addTrackSegment(const string& fromStationID, const string& toStationID, double distance) {
+    if (fromStationID == toStationID) return false;
     
     RailwayStation* fromStation = findStationByID(fromStationID);
     RailwayStation* toStation = findStationByID(toStationID);
-    
     if (fromStation == nullptr || toStation == nullptr) return false;
     
-    // Calculate rail distance (straight line using Haversine formula)
-    distance = calculateDistance(fromStation->getLatitude(), fromStation->getLongitude(),
-                                 toStation->getLatitude(), toStation->getLongitude());
+    if (distance <= 0.0) {
+        distance = Graph::calculateDistance(fromStation->getLatitude(), fromStation->getLongitude(),
+                                            toStation->getLatitude(), toStation->getLongitude());
+    }
+    
+    if (railNetwork->areAdjacent(fromStationID, toStationID)) {
+        // Existing segment: update the distance in both directions
+        railNetwork->addEdge(fromStationID, toStationID, distance);
+        railNetwork->addEdge(toStationID, fromStationID, distance);
+        return true;
+    }
+    
+    if (!railNetwork->addEdge(fromStationID, toStationID, distance)) return false;
+    segmentCount++;
+    return true;
+}
+
+// Connect every station without track to its nearest stations
+int RailwayManager::buildDefaultTracks(int neighbours) {
+    int count = railNetwork->getVertexCount();
+    if (neighbours <= 0 || count < 2) return 0;
+    if (neighbours > count - 1) neighbours = count - 1;
+    
+    int* nearest = new int[neighbours];
+    double* nearestDistances = new double[neighbours];
+    int added = 0;
+    
+    for (int i = 0; i < count; i++) {
+        Vertex* station = railNetwork->getVertexAt(i);
+        if (station->edgeList != nullptr) continue; // Already on the line
+        
+        // Keep the closest stations in ascending order (small insertion list)
+        int found = 0;
+        for (int j = 0; j < count; j++) {
+            if (j == i) continue;
+            Vertex* other = railNetwork->getVertexAt(j);
+            double dist = Graph::calculateDistance(station->latitude, station->longitude,
+                                                   other->latitude, other->longitude);
+            if (found == neighbours && dist >= nearestDistances[found - 1]) continue;
+            
+            int position = (found < neighbours) ? found++ : found - 1;
+            while (position > 0 && nearestDistances[position - 1] > dist) {
+                nearest[position] = nearest[position - 1];
+                nearestDistances[position] = nearestDistances[position - 1];
+                position--;
+            }
+            nearest[position] = j;
+            nearestDistances[position] = dist;
+        }
+        
+        for (int n = 0; n < found; n++) {
+            Vertex* other = railNetwork->getVertexAt(nearest[n]);
+            if (railNetwork->areAdjacent(station->vertexID, other->vertexID)) continue;
+            if (addTrackSegment(station->vertexID, other->vertexID, nearestDistances[n])) {
+                added++;
+            }
+        }
+    }
+    
+    delete[] nearest;
+    delete[] nearestDistances;
+    return added;
+}
+
+// Get number of track segments
+int RailwayManager::getTrackSegmentCount() const {
+    return segmentCount;
+}
+
+// Get the rail network
+Graph* RailwayManager::getRailNetwork() const {
+    return railNetwork;
+}
+
+// Get the station → bus stop transfers
+const TransferTable* RailwayManager::getTransfers() const {
+    return transfers;
+}
+
+// Calculate rail distance between two stations along the track
+bool RailwayManager::calculateRailDistance(const string& fromStationID, const string& toStationID, double& distance) {
+    distance = 0.0;
+    if (fromStationID.empty() || toStationID.empty()) return false;
+    
+    if (findStationByID(fromStationID) == nullptr || findStationByID(toStationID) == nullptr) return false;
+    
+    int pathLength = 0;
+    string* path = railNetwork->findShortestPath(fromStationID, toStationID, pathLength, distance);
+    if (path == nullptr) return false; // No track between the stations
     
+    delete[] path;
     return true;
 }
 
-// Find path from one station to another (direct train route)
+// Find the shortest rail route from one station to another
 bool RailwayManager::findStationPath(const string& fromStationID, const string& toStationID, 
                                      string* path, int& pathLength, double& distance) {
     pathLength = 0;
     distance = 0.0;
     if (fromStationID.empty() || toStationID.empty() || path == nullptr) return false;
     
-    RailwayStation* fromStation = findStationByID(fromStationID);
-    RailwayStation* toStation = findStationByID(toStationID);
+    if (findStationByID(fromStationID) == nullptr || findStationByID(toStationID) == nullptr) return false;
     
-    if (fromStation == nullptr || toStation == nullptr) return false;
+    int routeLength = 0;
+    string* route = railNetwork->findShortestPath(fromStationID, toStationID, routeLength, distance);
+    if (route == nullptr) return false;
     
-    // Direct train route path: fromStation -> toStation
-    path[0] = fromStationID;
-    path[1] = toStationID;
-    pathLength = 2;
-    
-    // Calculate rail distance
-    distance = calculateDistance(fromStation->getLatitude(), fromStation->getLongitude(),
-                                 toStation->getLatitude(), toStation->getLongitude());
+    for (int i = 0; i < routeLength; i++) {
+        path[i] = route[i];
+    }
+    pathLength = routeLength;
     
+    delete[] route;
     return true;
 }
 
@@ -397,6 +509,27 @@ bool RailwayManager::loadStationsFromCSVData(CSVRow* stationData, int stationCou
     return true;
 }
 
+// Load track segments from CSV data
+int RailwayManager::loadTrackSegmentsFromCSVData(CSVRow* segmentData, int rowCount) {
+    if (segmentData == nullptr || rowCount <= 0) return 0;
+    
+    // fields[0]=FromStationID, [1]=ToStationID, [2]=DistanceKm (optional)
+    int added = 0;
+    for (int i = 0; i < rowCount; i++) {
+        if (segmentData[i].fieldCount < 2) continue; // Skip invalid rows
+        
+        double distance = -1.0;
+        if (segmentData[i].fieldCount >= 3) {
+            distance = stringToDouble(segmentData[i].fields[2]);
+        }
+        if (addTrackSegment(segmentData[i].fields[0], segmentData[i].fields[1], distance)) {
+            added++;
+        }
+    }
+    
+    return added;
+}
+
 // Clear all stations
 void RailwayManager::clear() {
     // Get all stations and delete them
@@ -416,7 +549,10 @@ void RailwayManager::clear() {
     if (stationsByName != nullptr) stationsByName->clear();
     if (stationsByCode != nullptr) stationsByCode->clear();
     if (allStationsList != nullptr) allStationsList->clear();
+    if (railNetwork != nullptr) railNetwork->clear();
+    if (transfers != nullptr) transfers->clear();
     
     stationCount = 0;
+    segmentCount = 0;
 }
 
@@ -6,11 +6,15 @@
 #include "core_classes/HashTable.h"
 #include "core_classes/SinglyLinkedList.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/TransferTable.h"
 #include "RailwayStation.h"
 using namespace std;
 
 // RailwayManager class - Central manager for all railway stations
 // Used for: Airport/Rail integration (bonus module), railway station management, station-to-station travel
+// Stations live in their own rail network (track segments weighted by km), separate from the
+// city graph, so rail trips follow the line topology instead of a straight line. Each station
+// also keeps a precomputed table of the bus stops within walking distance.
 class RailwayManager {
 private:
     HashTable* stationsByID;          // Hash table for station lookup by ID (key = stationID, value = RailwayStation*)
@@ -19,11 +23,21 @@ private:
     SinglyLinkedList* allStationsList; // Linked list to track all stations for iteration (stores stationID)
     Graph* cityGraph;                  // Pointer to shared city graph (for nearest bus stop connection)
     int stationCount;                  // Current number of stations
+    Graph* railNetwork;                // Stations as vertices, track segments as edges (km)
+    int segmentCount;                  // Number of track segments
+    TransferTable* transfers;          // Station → nearby bus stops (walking)
     
     // Helper function to get all stations as array
     void getAllStations(RailwayStation** stations, int& count) const;
     
+    // Recompute the bus stop transfers of every station (after the city graph changes)
+    // Complexity: O(S × V)
+    void rebuildTransfers();
+    
 public:
+    static const int MAX_STATIONS = 500;          // Capacity of the rail network
+    static const int DEFAULT_TRACK_NEIGHBOURS = 2;  // Tracks per unconnected station in buildDefaultTracks
+    
     // Constructor
     // Parameters: graph - pointer to shared city graph
     RailwayManager(Graph* graph = nullptr);
@@ -32,6 +46,7 @@ public:
     ~RailwayManager();
     
     // Set the city graph (if not provided in constructor)
+    // Note: Recomputes the bus stop transfers of every station
     void setCityGraph(Graph* graph);
     
     // Get the city graph
@@ -39,8 +54,9 @@ public:
     
     // Station management
     // Add a station to the manager
-    // Returns: true if successful, false if station already exists
-    // Note: Automatically connects station to nearest bus stop in graph
+    // Returns: true if successful, false if station already exists or the rail network is full
+    // Note: Automatically connects station to nearest bus stop in graph and computes its transfers
+    // Note: The station has no track until addTrackSegment / buildDefaultTracks connects it
     bool addStation(RailwayStation* station);
     
     // Find a station by ID
@@ -70,17 +86,41 @@ public:
     // Returns: Pointer to nearest RailwayStation, nullptr if no stations or graph unavailable
     RailwayStation* findNearestStation(double latitude, double longitude);
     
+    // Rail network
+    // Add a track segment between two stations (both directions)
+    // Parameters: fromStationID, toStationID, distance in km (<= 0 to use the straight-line distance)
+    // Returns: true if both stations exist, false otherwise (an existing segment gets the new distance)
+    // Complexity: O(d) where d is track segments at the station
+    bool addTrackSegment(const string& fromStationID, const string& toStationID, double distance = -1.0);
+    
+    // Connect every station without track to its nearest stations (straight-line segments)
+    // Used when no segment data is available, or after adding a station by hand
+    // Parameters: neighbours - segments per unconnected station
+    // Returns: number of segments added
+    // Complexity: O(S^2)
+    int buildDefaultTracks(int neighbours = DEFAULT_TRACK_NEIGHBOURS);
+    
+    // Get number of track segments
+    int getTrackSegmentCount() const;
+    
+    // Get the rail network (stations as vertices, track segments as edges in km)
+    Graph* getRailNetwork() const;
+    
+    // Get the precomputed station → bus stop transfers
+    const TransferTable* getTransfers() const;
+    
     // Station-to-station travel
-    // Calculate rail distance between two stations (straight line distance)
+    // Calculate rail distance between two stations along the track (shortest route)
     // Parameters: fromStationID, toStationID, distance (output)
-    // Returns: true if both stations found, false otherwise
+    // Returns: true if both stations found and connected by track, false otherwise
+    // Complexity: O((S + T) log S) where T is track segments
     bool calculateRailDistance(const string& fromStationID, const string& toStationID, double& distance);
     
-    // Find path from one station to another (direct train route)
+    // Find the shortest rail route from one station to another (may pass through other stations)
     // Parameters: fromStationID, toStationID, path array (output), pathLength (output), distance (output)
     // Returns: true if path found, false otherwise
-    // Note: For stations, path is always direct (2 stops: source station -> destination station)
-    // Note: Caller must allocate path array with sufficient size (at least 2)
+    // Note: Caller must allocate path array with at least getStationCount() entries
+    // Complexity: O((S + T) log S)
     bool findStationPath(const string& fromStationID, const string& toStationID, 
                         string* path, int& pathLength, double& distance);
     
@@ -91,6 +131,12 @@ public:
     // Returns: true if successful, false otherwise
     bool loadStationsFromCSVData(CSVRow* stationData, int stationCount);
     
+    // Load track segments from CSV data
+    // Parameters: segmentData - array of CSVRow from DataLoader, rowCount - number of rows
+    // Format expected: [0]=fromStationID, [1]=toStationID, [2]=distance in km (optional, empty for straight line)
+    // Returns: number of segments added
+    int loadTrackSegmentsFromCSVData(CSVRow* segmentData, int rowCount);
+    
     // Clear all stations
     void clear();
 };
@@ -156,7 +156,7 @@ static bool parseCoordinates(const string& coordStr, double& lat, double& lon) {
 
 // Constructor
 TransportManager::TransportManager(Graph* graph, int queueCapacity)
-    : cityGraph(graph), busCount(0), companyCount(0), schoolBusCount(0) {
+    : cityGraph(graph), busCount(0), companyCount(0), schoolBusCount(0), routeVersion(0) {
     // Initialize hash tables with reasonable sizes (prime numbers)
     busesByNumber = new HashTable(101);
     companiesByName = new HashTable(101);
@@ -164,7 +164,7 @@ TransportManager::TransportManager(Graph* graph, int queueCapacity)
     schoolBusesByNumber = new HashTable(101);
     allBusesList = new SinglyLinkedList();
     allCompaniesList = new SinglyLinkedList();
-    passengerQueue = new CircularQueue(queueCapacity);
+    passengerQueue = new LockFreeQueue(queueCapacity);
     routeHistory = new Stack(100);
 }
 
@@ -210,6 +210,7 @@ TransportManager::~TransportManager() {
 // Set the city graph
 void TransportManager::setCityGraph(Graph* graph) {
     cityGraph = graph;
+    routeVersion++;
 }
 
 // Get the city graph
@@ -217,6 +218,11 @@ Graph* TransportManager::getCityGraph() const {
     return cityGraph;
 }
 
+// Get the bus route change counter
+int TransportManager::getRouteVersion() const {
+    return routeVersion;
+}
+
 // Helper function to get all buses as array
 void TransportManager::getAllBuses(Bus** buses, int& count) const {
     count = 0;
@@ -268,6 +274,7 @@ bool TransportManager::addBus(Bus* bus) {
     allBusesList->insertAtTail(busNo);
     
     busCount++;
+    routeVersion++;
     return true;
 }
 
@@ -341,7 +348,9 @@ bool TransportManager::addStopToBusRoute(const string& busNo, const string& stop
     Bus* bus = findBusByNumber(busNo);
     if (bus == nullptr) return false;
     
-    return bus->addStopToRoute(stopID);
+    if (!bus->addStopToRoute(stopID)) return false;
+    routeVersion++;
+    return true;
 }
 
 // Remove a stop from a bus route
@@ -351,7 +360,9 @@ bool TransportManager::removeStopFromBusRoute(const string& busNo, const string&
     Bus* bus = findBusByNumber(busNo);
     if (bus == nullptr) return false;
     
-    return bus->removeStopFromRoute(stopID);
+    if (!bus->removeStopFromRoute(stopID)) return false;
+    routeVersion++;
+    return true;
 }
 
 // Get route for a specific bus
@@ -523,14 +534,36 @@ bool TransportManager::enqueuePassenger(const string& passengerID) {
 
 // Remove passenger from queue
 string TransportManager::dequeuePassenger() {
-    if (passengerQueue == nullptr || passengerQueue->isEmpty()) {
+    if (passengerQueue == nullptr) return "";
+    
+    // Single call: checking isEmpty() first would race with other consumers
+    QueueNode node;
+    if (!passengerQueue->dequeue(node)) {
         return "";
     }
-    
-    QueueNode node = passengerQueue->dequeue();
     return node.data;
 }
 
+// Add several passengers to queue
+int TransportManager::enqueuePassengers(const string* passengerIDs, int count) {
+    if (passengerIDs == nullptr || count <= 0 || passengerQueue == nullptr) return 0;
+    
+    return passengerQueue->enqueueBatch(passengerIDs, count);
+}
+
+// Remove several passengers from queue
+int TransportManager::dequeuePassengers(string* passengerIDs, int maxCount) {
+    if (passengerIDs == nullptr || maxCount <= 0 || passengerQueue == nullptr) return 0;
+    
+    QueueNode* nodes = new QueueNode[maxCount];
+    int count = passengerQueue->dequeueBatch(nodes, maxCount);
+    for (int i = 0; i < count; i++) {
+        passengerIDs[i] = nodes[i].data;
+    }
+    delete[] nodes;
+    return count;
+}
+
 // Get passenger queue size
 int TransportManager::getPassengerQueueSize() const {
     if (passengerQueue == nullptr) return 0;
@@ -840,9 +873,7 @@ void TransportManager::clear() {
     }
     
     if (passengerQueue != nullptr) {
-        while (!passengerQueue->isEmpty()) {
-            passengerQueue->dequeue();
-        }
+        passengerQueue->clear();
     }
     if (routeHistory != nullptr) {
         while (!routeHistory->isEmpty()) {
@@ -853,6 +884,7 @@ void TransportManager::clear() {
     busCount = 0;
     companyCount = 0;
     schoolBusCount = 0;
+    routeVersion++;
 }
 
 // Helper function to get SchoolBus pointer from bus number
@@ -892,6 +924,7 @@ bool TransportManager::addSchoolBus(SchoolBus* bus) {
     // Store in schoolBusesByNumber for fast SchoolBus lookup
     schoolBusesByNumber->insert(busNo, bus);
     schoolBusCount++;
+    routeVersion++; // No longer a public route
     
     return true;
 }
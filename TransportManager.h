@@ -5,7 +5,7 @@
 #include "core_classes/Graph.h"
 #include "core_classes/HashTable.h"
 #include "core_classes/SinglyLinkedList.h"
-#include "core_classes/CircularQueue.h"
+#include "core_classes/LockFreeQueue.h"
 #include "core_classes/Stack.h"
 #include "core_classes/DataLoader.h"
 #include "Bus.h"
@@ -23,11 +23,12 @@ private:
     SinglyLinkedList* allBusesList;   // Linked list to track all buses for iteration (stores busNo)
     SinglyLinkedList* allCompaniesList; // Linked list to track all companies for iteration (stores company name)
     Graph* cityGraph;                 // Pointer to shared city graph (for pathfinding and nearest queries)
-    CircularQueue* passengerQueue;   // Circular queue for passenger queue simulation (optional)
+    LockFreeQueue* passengerQueue;   // Lock-free MPMC queue for passenger boarding events (safe across gate-reader threads)
     Stack* routeHistory;              // Stack for route travel history (optional)
     int busCount;                     // Current number of buses
     int companyCount;                 // Current number of registered companies
     int schoolBusCount;               // Current number of school buses
+    int routeVersion;                 // Bumped whenever a bus is added or a bus route changes
     
     // Helper function to get all buses as array
     void getAllBuses(Bus** buses, int& count) const;
@@ -54,6 +55,10 @@ public:
     // Get the city graph
     Graph* getCityGraph() const;
     
+    // Get the bus route change counter (differs from an earlier value once buses or routes changed)
+    // Complexity: O(1)
+    int getRouteVersion() const;
+    
     // Bus management
     // Add a bus to the manager
     // Returns: true if successful, false if bus already exists
@@ -195,6 +200,7 @@ public:
     string getBusLocation(const string& busNo) const;
     
     // Passenger queue management (optional)
+    // The passenger queue functions below may be called concurrently from several threads
     // Add passenger to queue
     // Returns: true if successful, false if queue is full
     bool enqueuePassenger(const string& passengerID);
@@ -203,6 +209,17 @@ public:
     // Returns: passengerID if successful, empty string if queue is empty
     string dequeuePassenger();
     
+    // Add several passengers to the queue in one reservation
+    // Parameters: passengerIDs array, count
+    // Returns: number of passengers enqueued (less than count if the queue fills up)
+    int enqueuePassengers(const string* passengerIDs, int count);
+    
+    // Remove up to maxCount passengers from the queue in one reservation
+    // Parameters: passengerIDs array (output), maxCount
+    // Returns: number of passengers dequeued
+    // Note: Caller must allocate passengerIDs array with at least maxCount entries
+    int dequeuePassengers(string* passengerIDs, int maxCount);
+    
     // Get passenger queue size
     int getPassengerQueueSize() const;
     
@@ -0,0 +1,459 @@
+#include "CitizenTable.h"
+#include <cstdint>
+using namespace std;
+
+// Largest age accepted by a filter with no upper bound
+static const int NO_AGE_LIMIT = 2147483647;
+
+// Helper: trim spaces around one value of a comma separated list
+static string trimValue(const string& value) {
+    size_t start = 0;
+    while (start < value.length() && (value[start] == ' ' || value[start] == '\t')) start++;
+    size_t end = value.length();
+    while (end > start && (value[end - 1] == ' ' || value[end - 1] == '\t')) end--;
+    return value.substr(start, end - start);
+}
+
+// CitizenFilter Implementation
+CitizenFilter::CitizenFilter() : gender(""), occupation(""), sector(""), minAge(0), maxAge(-1) {
+}
+
+// CitizenTable Implementation
+CitizenTable::CitizenTable(int initialCapacity) : rowCount(0), liveCount(0) {
+    capacity = (initialCapacity > 0) ? initialCapacity : 64;
+    cnics = new string[capacity];
+    ages = new int[capacity];
+    genders = new int[capacity];
+    occupations = new int[capacity];
+    sectors = new int[capacity];
+    alive = new unsigned char[capacity];
+    
+    rowTable = new HashTable(101);
+    genderDict = new StringDictionary(4);
+    occupationDict = new StringDictionary(32);
+    sectorDict = new StringDictionary(32);
+    
+    liveRows = new RoaringBitmap();
+    genderIndex = new BitmapIndex();
+    occupationIndex = new BitmapIndex();
+    sectorIndex = new BitmapIndex();
+    ageIndex = new BitmapIndex();
+}
+
+CitizenTable::~CitizenTable() {
+    delete[] cnics;
+    delete[] ages;
+    delete[] genders;
+    delete[] occupations;
+    delete[] sectors;
+    delete[] alive;
+    delete rowTable;
+    delete genderDict;
+    delete occupationDict;
+    delete sectorDict;
+    delete liveRows;
+    delete genderIndex;
+    delete occupationIndex;
+    delete sectorIndex;
+    delete ageIndex;
+}
+
+void CitizenTable::ensureCapacity(int minCapacity) {
+    if (minCapacity <= capacity) return;
+    
+    int newCapacity = capacity * 2;
+    if (newCapacity < minCapacity) newCapacity = minCapacity;
+    string* newCnics = new string[newCapacity];
+    int* newAges = new int[newCapacity];
+    int* newGenders = new int[newCapacity];
+    int* newOccupations = new int[newCapacity];
+    int* newSectors = new int[newCapacity];
+    unsigned char* newAlive = new unsigned char[newCapacity];
+    for (int i = 0; i < rowCount; i++) {
+        newCnics[i].swap(cnics[i]);
+        newAges[i] = ages[i];
+        newGenders[i] = genders[i];
+        newOccupations[i] = occupations[i];
+        newSectors[i] = sectors[i];
+        newAlive[i] = alive[i];
+    }
+    delete[] cnics;
+    delete[] ages;
+    delete[] genders;
+    delete[] occupations;
+    delete[] sectors;
+    delete[] alive;
+    cnics = newCnics;
+    ages = newAges;
+    genders = newGenders;
+    occupations = newOccupations;
+    sectors = newSectors;
+    alive = newAlive;
+    capacity = newCapacity;
+}
+
+void CitizenTable::reserve(int rows) {
+    if (rows <= 0) return;
+    ensureCapacity(rowCount + rows);
+    rowTable->resize((rowTable->getSize() + rows) * 2 + 1);
+}
+
+int CitizenTable::append(const string& cnic, int age, const string& gender,
+                         const string& occupation, const string& sector) {
+    if (cnic.empty()) return -1;
+    
+    ensureCapacity(rowCount + 1);
+    int row = rowCount++;
+    cnics[row] = cnic;
+    ages[row] = age;
+    genders[row] = genderDict->encode(gender);
+    occupations[row] = occupationDict->encode(occupation);
+    sectors[row] = sectorDict->encode(sector);
+    alive[row] = 1;
+    liveCount++;
+    
+    rowTable->insert(cnic, (void*)(intptr_t)(row + 1));
+    liveRows->add(row);
+    genderIndex->add(genders[row], row);
+    occupationIndex->add(occupations[row], row);
+    sectorIndex->add(sectors[row], row);
+    ageIndex->add(ageBucket(age), row);
+    return row;
+}
+
+bool CitizenTable::removeRow(int row) {
+    if (row < 0 || row >= rowCount || !alive[row]) return false;
+    
+    alive[row] = 0;
+    liveCount--;
+    if (findRow(cnics[row]) == row) {
+        rowTable->remove(cnics[row]);
+    }
+    liveRows->remove(row);
+    genderIndex->remove(genders[row], row);
+    occupationIndex->remove(occupations[row], row);
+    sectorIndex->remove(sectors[row], row);
+    ageIndex->remove(ageBucket(ages[row]), row);
+    return true;
+}
+
+bool CitizenTable::setSector(int row, const string& sector) {
+    if (row < 0 || row >= rowCount || !alive[row]) return false;
+    
+    sectorIndex->remove(sectors[row], row);
+    sectors[row] = sectorDict->encode(sector);
+    sectorIndex->add(sectors[row], row);
+    return true;
+}
+
+int CitizenTable::findRow(const string& cnic) const {
+    void* data = rowTable->search(cnic);
+    if (data == nullptr) return -1;
+    return (int)(intptr_t)data - 1;
+}
+
+bool CitizenTable::isLive(int row) const {
+    return row >= 0 && row < rowCount && alive[row];
+}
+
+string CitizenTable::getCNIC(int row) const {
+    if (row < 0 || row >= rowCount) return "";
+    return cnics[row];
+}
+
+int CitizenTable::getAge(int row) const {
+    if (row < 0 || row >= rowCount) return -1;
+    return ages[row];
+}
+
+string CitizenTable::getGender(int row) const {
+    if (row < 0 || row >= rowCount) return "";
+    return genderDict->decode(genders[row]);
+}
+
+string CitizenTable::getOccupation(int row) const {
+    if (row < 0 || row >= rowCount) return "";
+    return occupationDict->decode(occupations[row]);
+}
+
+string CitizenTable::getSector(int row) const {
+    if (row < 0 || row >= rowCount) return "";
+    return sectorDict->decode(sectors[row]);
+}
+
+int CitizenTable::getRowCount() const {
+    return rowCount;
+}
+
+int CitizenTable::getLiveCount() const {
+    return liveCount;
+}
+
+int CitizenTable::ageBucket(int age) {
+    return (age > 0) ? age / AGE_BUCKET_WIDTH : 0;
+}
+
+const RoaringBitmap* CitizenTable::matchValues(const string& values, const StringDictionary* dictionary,
+                                               const BitmapIndex* index, bool& owned) const {
+    owned = false;
+    const RoaringBitmap* result = nullptr;
+    RoaringBitmap* merged = nullptr;
+    
+    size_t start = 0;
+    while (start <= values.length()) {
+        size_t comma = values.find(',', start);
+        if (comma == string::npos) comma = values.length();
+        
+        const RoaringBitmap* rows = index->get(dictionary->find(trimValue(values.substr(start, comma - start))));
+        if (rows != nullptr) {
+            if (result == nullptr) {
+                result = rows;
+            } else {
+                // Second value: copy the first bitmap before OR-ing into it
+                if (merged == nullptr) {
+                    merged = result->clone();
+                    result = merged;
+                }
+                merged->unionWith(*rows);
+            }
+        }
+        start = comma + 1;
+    }
+    
+    owned = (merged != nullptr);
+    return result;
+}
+
+RoaringBitmap* CitizenTable::matchAges(int minAge, int maxAge) const {
+    if (maxAge < 0) maxAge = NO_AGE_LIMIT;
+    RoaringBitmap* result = new RoaringBitmap();
+    if (minAge > maxAge || ageIndex->count == 0) return result;
+    
+    int firstBucket = ageBucket(minAge);
+    int lastBucket = ageBucket(maxAge);
+    if (lastBucket >= ageIndex->count) lastBucket = ageIndex->count - 1;
+    
+    for (int b = firstBucket; b <= lastBucket; b++) {
+        const RoaringBitmap* rows = ageIndex->get(b);
+        if (rows == nullptr) continue;
+        
+        // Bucket 0 also holds negative ages, so it is always checked row by row
+        bool whole = b > 0 && b * AGE_BUCKET_WIDTH >= minAge &&
+                     b * AGE_BUCKET_WIDTH + AGE_BUCKET_WIDTH - 1 <= maxAge;
+        if (whole) {
+            result->unionWith(*rows);
+            continue;
+        }
+        
+        // Edge bucket: check each row's age
+        int rowCount = 0;
+        int* bucketRows = rows->toArray(rowCount);
+        for (int i = 0; i < rowCount; i++) {
+            int age = ages[bucketRows[i]];
+            if (age >= minAge && age <= maxAge) result->add(bucketRows[i]);
+        }
+        delete[] bucketRows;
+    }
+    return result;
+}
+
+int CitizenTable::collectSets(const CitizenFilter& filter, const RoaringBitmap** sets, bool* owned) const {
+    int setCount = 0;
+    bool empty = false;
+    
+    const string* values[3] = { &filter.gender, &filter.occupation, &filter.sector };
+    const StringDictionary* dictionaries[3] = { genderDict, occupationDict, sectorDict };
+    const BitmapIndex* indexes[3] = { genderIndex, occupationIndex, sectorIndex };
+    for (int f = 0; f < 3 && !empty; f++) {
+        if (values[f]->empty()) continue;
+        bool own = false;
+        const RoaringBitmap* rows = matchValues(*values[f], dictionaries[f], indexes[f], own);
+        if (rows == nullptr) {
+            empty = true;
+        } else {
+            sets[setCount] = rows;
+            owned[setCount] = own;
+            setCount++;
+        }
+    }
+    
+    if (!empty && (filter.minAge > 0 || filter.maxAge >= 0)) {
+        RoaringBitmap* rows = matchAges(filter.minAge, filter.maxAge);
+        sets[setCount] = rows;
+        owned[setCount] = true;
+        setCount++;
+        empty = rows->isEmpty();
+    }
+    
+    if (empty) {
+        for (int i = 0; i < setCount; i++) {
+            if (owned[i]) delete sets[i];
+        }
+        return -1;
+    }
+    
+    // Smallest first, so every AND works on the fewest rows
+    int sizes[4];
+    for (int i = 0; i < setCount; i++) {
+        sizes[i] = sets[i]->getCardinality();
+    }
+    for (int i = 1; i < setCount; i++) {
+        const RoaringBitmap* rows = sets[i];
+        bool own = owned[i];
+        int size = sizes[i];
+        int j = i - 1;
+        while (j >= 0 && sizes[j] > size) {
+            sets[j + 1] = sets[j];
+            owned[j + 1] = owned[j];
+            sizes[j + 1] = sizes[j];
+            j--;
+        }
+        sets[j + 1] = rows;
+        owned[j + 1] = own;
+        sizes[j + 1] = size;
+    }
+    return setCount;
+}
+
+RoaringBitmap* CitizenTable::match(const CitizenFilter& filter) const {
+    const RoaringBitmap* sets[4];
+    bool owned[4];
+    int setCount = collectSets(filter, sets, owned);
+    if (setCount < 0) return new RoaringBitmap();
+    if (setCount == 0) return liveRows->clone();
+    
+    // Reuse the smallest set if it is already a private copy
+    RoaringBitmap* result = owned[0] ? (RoaringBitmap*)sets[0] : sets[0]->clone();
+    for (int i = 1; i < setCount; i++) {
+        result->intersectWith(*sets[i]);
+        if (owned[i]) delete sets[i];
+    }
+    return result;
+}
+
+int CitizenTable::count(const CitizenFilter& filter) const {
+    const RoaringBitmap* sets[4];
+    bool owned[4];
+    int setCount = collectSets(filter, sets, owned);
+    if (setCount < 0) return 0;
+    if (setCount == 0) return liveCount;
+    
+    int matches = 0;
+    if (setCount == 1) {
+        matches = sets[0]->getCardinality();
+    } else {
+        // AND all but the last set, then count the last AND without building it
+        const RoaringBitmap* first = sets[0];
+        RoaringBitmap* partial = nullptr;
+        if (setCount > 2) {
+            partial = sets[0]->clone();
+            for (int i = 1; i < setCount - 1; i++) {
+                partial->intersectWith(*sets[i]);
+            }
+            first = partial;
+        }
+        matches = RoaringBitmap::intersectionCount(*first, *sets[setCount - 1]);
+        delete partial;
+    }
+    
+    for (int i = 0; i < setCount; i++) {
+        if (owned[i]) delete sets[i];
+    }
+    return matches;
+}
+
+int* CitizenTable::select(const CitizenFilter& filter, int& count) const {
+    count = 0;
+    if (liveCount == 0) return nullptr;
+    
+    RoaringBitmap* rows = match(filter);
+    int* result = rows->toArray(count);
+    delete rows;
+    return result;
+}
+
+const int* CitizenTable::getColumn(int column) const {
+    if (column == COLUMN_GENDER) return genders;
+    if (column == COLUMN_OCCUPATION) return occupations;
+    if (column == COLUMN_SECTOR) return sectors;
+    return nullptr;
+}
+
+const StringDictionary* CitizenTable::getDictionary(int column) const {
+    if (column == COLUMN_GENDER) return genderDict;
+    if (column == COLUMN_OCCUPATION) return occupationDict;
+    if (column == COLUMN_SECTOR) return sectorDict;
+    return nullptr;
+}
+
+int* CitizenTable::groupCount(int column, const CitizenFilter& filter, int& groups) const {
+    groups = 0;
+    const int* codes = getColumn(column);
+    const StringDictionary* dictionary = getDictionary(column);
+    if (codes == nullptr || dictionary->size() == 0) return nullptr;
+    
+    groups = dictionary->size();
+    int* counts = new int[groups];
+    for (int i = 0; i < groups; i++) {
+        counts[i] = 0;
+    }
+    
+    int matchCount = 0;
+    int* rows = select(filter, matchCount);
+    for (int i = 0; i < matchCount; i++) {
+        int code = codes[rows[i]];
+        if (code >= 0) counts[code]++;
+    }
+    delete[] rows;
+    return counts;
+}
+
+string CitizenTable::getGroupLabel(int column, int code) const {
+    const StringDictionary* dictionary = getDictionary(column);
+    if (dictionary == nullptr) return "";
+    return dictionary->decode(code);
+}
+
+int* CitizenTable::ageHistogram(const CitizenFilter& filter, int bucketWidth, int& buckets) const {
+    buckets = 0;
+    if (bucketWidth <= 0) return nullptr;
+    
+    int matchCount = 0;
+    int* rows = select(filter, matchCount);
+    if (rows == nullptr) return nullptr;
+    
+    int oldest = 0;
+    for (int i = 0; i < matchCount; i++) {
+        if (ages[rows[i]] > oldest) oldest = ages[rows[i]];
+    }
+    
+    buckets = oldest / bucketWidth + 1;
+    int* counts = new int[buckets];
+    for (int i = 0; i < buckets; i++) {
+        counts[i] = 0;
+    }
+    for (int i = 0; i < matchCount; i++) {
+        int age = (ages[rows[i]] > 0) ? ages[rows[i]] : 0;
+        counts[age / bucketWidth]++;
+    }
+    
+    delete[] rows;
+    return counts;
+}
+
+void CitizenTable::clear() {
+    for (int i = 0; i < rowCount; i++) {
+        cnics[i].clear();
+    }
+    rowCount = 0;
+    liveCount = 0;
+    rowTable->clear();
+    genderDict->clear();
+    occupationDict->clear();
+    sectorDict->clear();
+    liveRows->clear();
+    genderIndex->clear();
+    occupationIndex->clear();
+    sectorIndex->clear();
+    ageIndex->clear();
+}
@@ -0,0 +1,171 @@
+#ifndef CITIZENTABLE_H
+#define CITIZENTABLE_H
+
+#include <string>
+#include "HashTable.h"
+#include "StringDictionary.h"
+#include "RoaringBitmap.h"
+using namespace std;
+
+// Structure for a citizen query; empty strings and maxAge = -1 mean "any"
+// A comma separated list matches any of its values (e.g., sector "F-8, G-10")
+struct CitizenFilter {
+    string gender;            // e.g., "Female"
+    string occupation;        // e.g., "Engineer" or "Student, Teacher"
+    string sector;            // e.g., "G-10" or "F-8, G-10"
+    int minAge;               // Inclusive lower bound (default 0)
+    int maxAge;               // Inclusive upper bound (default -1, no limit)
+    
+    CitizenFilter();
+};
+
+// CitizenTable class - Column-per-field (structure of arrays) copy of the citizen records
+// Used for: Population analytics (filters, counts and group-bys over every citizen)
+// Gender, occupation and sector are dictionary encoded, so a query compares small
+// integers in tight loops over contiguous arrays instead of chasing famtree pointers
+// and comparing strings. Rows are never reused: a removed citizen's row is marked dead,
+// which keeps row IDs stable for anything that refers to them.
+// Each gender, occupation, sector and age bucket also keeps a RoaringBitmap of its live
+// rows, so a filter is answered by OR-ing the bitmaps of a field's values and AND-ing
+// the fields, smallest first, instead of scanning every row.
+class CitizenTable {
+private:
+    string* cnics;                // CNIC per row
+    int* ages;                    // Age column
+    int* genders;                 // Gender code column (-1 if unknown)
+    int* occupations;             // Occupation code column (-1 if unknown)
+    int* sectors;                 // Sector code column (-1 if unknown)
+    unsigned char* alive;         // 1 for live rows, 0 for removed rows
+    int rowCount;                 // Rows ever appended (live and removed)
+    int liveCount;                // Live rows
+    int capacity;
+    
+    HashTable* rowTable;          // CNIC → row + 1 (latest row for that CNIC)
+    StringDictionary* genderDict;
+    StringDictionary* occupationDict;
+    StringDictionary* sectorDict;
+    
+    RoaringBitmap* liveRows;      // Every live row
+    BitmapIndex* genderIndex;     // Gender code → live rows
+    BitmapIndex* occupationIndex; // Occupation code → live rows
+    BitmapIndex* sectorIndex;     // Sector code → live rows
+    BitmapIndex* ageIndex;        // Age / AGE_BUCKET_WIDTH → live rows
+    
+    // Grow all columns to hold at least minCapacity rows
+    void ensureCapacity(int minCapacity);
+    
+    // Get the age bucket of an age (negative ages share bucket 0)
+    static int ageBucket(int age);
+    
+    // Get the rows matching one field's comma separated values (OR of their bitmaps)
+    // Returns: nullptr if no value is known; owned is set if the caller must delete the result
+    const RoaringBitmap* matchValues(const string& values, const StringDictionary* dictionary,
+                                     const BitmapIndex* index, bool& owned) const;
+    
+    // Get the rows whose age is in [minAge, maxAge] (OR of whole buckets, edge buckets checked per row)
+    // Returns: New bitmap (caller must delete)
+    RoaringBitmap* matchAges(int minAge, int maxAge) const;
+    
+    // Get one row set per constrained field of a filter, smallest first
+    // Parameters: sets (output, 4 entries), owned (output, 4 entries)
+    // Returns: number of sets (0 if nothing is constrained), -1 if nothing can match
+    int collectSets(const CitizenFilter& filter, const RoaringBitmap** sets, bool* owned) const;
+    
+    // Get the code column and dictionary for a column ID (nullptr if unknown)
+    const int* getColumn(int column) const;
+    const StringDictionary* getDictionary(int column) const;
+
+public:
+    // Column IDs for group-by queries
+    static const int COLUMN_GENDER = 0;
+    static const int COLUMN_OCCUPATION = 1;
+    static const int COLUMN_SECTOR = 2;
+    
+    // Width in years of the age buckets in the age index
+    static const int AGE_BUCKET_WIDTH = 5;
+    
+    // Constructor
+    // Complexity: O(n) for the initial columns
+    CitizenTable(int initialCapacity = 64);
+    
+    // Destructor
+    // Complexity: O(n)
+    ~CitizenTable();
+    
+    // Make room for rows more rows in one step (e.g., before a bulk load)
+    // Complexity: O(n + rows)
+    void reserve(int rows);
+    
+    // Append a citizen
+    // Returns: row ID of the new row, -1 if cnic is empty
+    // Complexity: O(m) average where m is total length of the strings
+    int append(const string& cnic, int age, const string& gender,
+               const string& occupation, const string& sector);
+    
+    // Mark a row as removed (its ID is not reused)
+    // Returns: false if the row is out of range or already removed
+    // Complexity: O(m) average
+    bool removeRow(int row);
+    
+    // Change a live row's sector (e.g., when a family moves)
+    // Returns: false if the row is out of range or removed
+    // Complexity: O(m) average
+    bool setSector(int row, const string& sector);
+    
+    // Find the live row of a CNIC
+    // Returns: row ID, -1 if not found
+    // Complexity: O(m) average
+    int findRow(const string& cnic) const;
+    
+    // Row access (empty string / -1 if out of range)
+    // Complexity: O(1)
+    bool isLive(int row) const;
+    string getCNIC(int row) const;
+    int getAge(int row) const;
+    string getGender(int row) const;
+    string getOccupation(int row) const;
+    string getSector(int row) const;
+    
+    // Get number of rows ever appended (row IDs are 0 .. getRowCount() - 1)
+    // Complexity: O(1)
+    int getRowCount() const;
+    
+    // Get number of live rows
+    // Complexity: O(1)
+    int getLiveCount() const;
+    
+    // Get the live rows matching a filter as a bitmap (to combine with other bitmaps)
+    // Returns: New RoaringBitmap (caller must delete), empty if nothing matches
+    // Complexity: O(s) bitmap work where s is the size of the matching index bitmaps
+    RoaringBitmap* match(const CitizenFilter& filter) const;
+    
+    // Count live rows matching a filter
+    // Complexity: O(s) - bitmap AND / OR, the last AND counted with popcount only
+    int count(const CitizenFilter& filter) const;
+    
+    // Get the live rows matching a filter
+    // Returns: Array of row IDs in row order (caller must delete[]), nullptr if none match
+    // Complexity: O(s + r) where r is number of matches
+    int* select(const CitizenFilter& filter, int& count) const;
+    
+    // Count matching rows per value of a column (COLUMN_GENDER, COLUMN_OCCUPATION or COLUMN_SECTOR)
+    // Returns: Array indexed by code (caller must delete[]); groups = number of codes;
+    //          nullptr if the column is unknown or has no values. Use getGroupLabel for names.
+    // Complexity: O(s + r + g) where g is number of groups
+    int* groupCount(int column, const CitizenFilter& filter, int& groups) const;
+    
+    // Get the value of a group code (empty string if out of range)
+    // Complexity: O(1)
+    string getGroupLabel(int column, int code) const;
+    
+    // Count matching rows per age bucket of bucketWidth years ([0, w), [w, 2w), ...)
+    // Returns: Array of counts (caller must delete[]), nullptr if nothing matches
+    // Complexity: O(s + r + b) where b is number of buckets
+    int* ageHistogram(const CitizenFilter& filter, int bucketWidth, int& buckets) const;
+    
+    // Remove every row
+    // Complexity: O(n)
+    void clear();
+};
+
+#endif // CITIZENTABLE_H
@@ -66,6 +66,99 @@ CSVRow::~CSVRow() {
     fieldCount = 0;
 }
 
+// CSVStream Implementation
+CSVStream::CSVStream(int max) : fieldCount(0), lineNumber(0) {
+    maxFields = (max > 0) ? max : 16;
+    fields = new string[maxFields + 1]; // Last slot stays empty for out-of-range field()
+}
+
+CSVStream::~CSVStream() {
+    close();
+    delete[] fields;
+}
+
+bool CSVStream::open(const string& filename, bool skipHeader) {
+    close();
+    file.open(filename.c_str());
+    if (!file.is_open()) return false;
+    
+    lineNumber = 0;
+    fieldCount = 0;
+    if (skipHeader && getline(file, line)) {
+        lineNumber++;
+    }
+    return true;
+}
+
+bool CSVStream::next() {
+    while (getline(file, line)) {
+        lineNumber++;
+        
+        // Strip a Windows line ending, skip blank lines
+        if (!line.empty() && line[line.length() - 1] == '\r') {
+            line.erase(line.length() - 1);
+        }
+        if (line.empty()) continue;
+        
+        for (int i = 0; i < maxFields; i++) {
+            fields[i].clear();
+        }
+        fieldCount = 1;
+        bool inQuotes = false;
+        string* current = &fields[0];
+        for (size_t i = 0; i < line.length(); i++) {
+            char c = line[i];
+            if (c == '"') {
+                if (inQuotes && i + 1 < line.length() && line[i + 1] == '"') {
+                    // Escaped quote (double quotes)
+                    if (current != nullptr) *current += '"';
+                    i++;
+                } else {
+                    inQuotes = !inQuotes;
+                }
+            } else if (c == ',' && !inQuotes) {
+                fieldCount++;
+                current = (fieldCount <= maxFields) ? &fields[fieldCount - 1] : nullptr;
+            } else if (current != nullptr) {
+                // Skip leading whitespace; trailing whitespace is trimmed below
+                if (!current->empty() || !isWhitespace(c)) *current += c;
+            }
+        }
+        
+        int kept = (fieldCount < maxFields) ? fieldCount : maxFields;
+        for (int i = 0; i < kept; i++) {
+            size_t end = fields[i].length();
+            while (end > 0 && isWhitespace(fields[i][end - 1])) end--;
+            fields[i].erase(end);
+        }
+        return true;
+    }
+    return false;
+}
+
+int CSVStream::getFieldCount() const {
+    return fieldCount;
+}
+
+int CSVStream::getLineNumber() const {
+    return lineNumber;
+}
+
+string& CSVStream::field(int index) {
+    if (index < 0 || index >= maxFields || index >= fieldCount) {
+        fields[maxFields].clear();
+        return fields[maxFields];
+    }
+    return fields[index];
+}
+
+void CSVStream::close() {
+    if (file.is_open()) {
+        file.close();
+    }
+    file.clear();
+}
+
 // DataLoader Implementation
 DataLoader::DataLoader() {
 }
@@ -602,6 +695,40 @@ bool DataLoader::loadRailways(const string& filename, CSVRow* stationData, int m
     return true;
 }
 
+bool DataLoader::loadRailSegments(const string& filename, CSVRow* segmentData, int maxRows, int& actualRows) {
+    ifstream file(filename.c_str());
+    if (!file.is_open()) {
+        cout << "[ERROR] Could not open file '" << filename << "'!" << endl;
+        cout << "Possible reasons:" << endl;
+        cout << "  - File does not exist at the specified path" << endl;
+        cout << "  - Incorrect file path or filename" << endl;
+        cout << "  - Insufficient file permissions" << endl;
+        return false;
+    }
+    
+    string line;
+    actualRows = 0;
+    
+    // Skip header row
+    if (getline(file, line)) {
+        // Header line
+    }
+    
+    // Read data rows
+    while (getline(file, line) && actualRows < maxRows) {
+        if (line.empty()) continue;
+        
+        CSVRow row = parseCSVLine(line);
+        if (row.fieldCount >= 2) { // At least FromStationID, ToStationID
+            segmentData[actualRows] = row;
+            actualRows++;
+        }
+    }
+    
+    file.close();
+    return true;
+}
+
 void DataLoader::displayCSVData(const CSVRow* data, int rowCount, const string& title) {
     cout << "\n=== " << title << " (Loaded " << rowCount << " rows) ===" << endl;
     
@@ -2,6 +2,7 @@
 #define DATALOADER_H
 
 #include <string>
+#include <fstream>
 using namespace std;
 
 // Structure to store a CSV row (array of strings)
@@ -16,6 +17,45 @@ struct CSVRow {
     ~CSVRow();
 };
 
+// CSVStream class - Reads a CSV file one row at a time into a reused field array
+// Used for: Bulk loads (e.g., a full census) where a fixed CSVRow buffer is too small
+// The field strings keep their capacity between rows, so steady-state parsing does not
+// allocate; callers may swap() a field out to keep its contents.
+class CSVStream {
+private:
+    ifstream file;
+    string line;              // Current raw line (reused)
+    string* fields;           // Parsed fields of the current row (reused)
+    int fieldCount;           // Fields in the current row (may exceed maxFields; extras are dropped)
+    int maxFields;
+    int lineNumber;           // 1-based line number of the current row
+    
+public:
+    // Constructor
+    // Parameters: maxFields - number of fields kept per row
+    CSVStream(int maxFields = 16);
+    
+    // Destructor
+    ~CSVStream();
+    
+    // Open a file (optionally skipping its header row)
+    // Returns: false if the file cannot be opened
+    bool open(const string& filename, bool skipHeader = true);
+    
+    // Read the next non-empty row (handles quoted fields with commas)
+    // Returns: false at end of file
+    // Complexity: O(L) where L is the line length
+    bool next();
+    
+    // Current row
+    int getFieldCount() const;
+    int getLineNumber() const;
+    string& field(int index);     // Empty string past the last kept field
+    
+    // Close the file
+    void close();
+};
+
 // DataLoader class for parsing CSV files
 // Used for: Loading all data from SmartCity_dataset folder
 class DataLoader {
@@ -115,6 +155,12 @@ public:
     // Format: StationID,Name,Code,City,Coordinates
     bool loadRailways(const string& filename, CSVRow* stationData, int maxRows, int& actualRows);
     
+    // Load railway track segments from CSV file
+    // Parameters: filename, array to store segment data, maxRows, actualRows (output)
+    // Returns: true if successful, false otherwise
+    // Format: FromStationID,ToStationID,DistanceKm (DistanceKm may be empty)
+    bool loadRailSegments(const string& filename, CSVRow* segmentData, int maxRows, int& actualRows);
+    
     // Display loaded data (for debugging)
     void displayCSVData(const CSVRow* data, int rowCount, const string& title);
 };
@@ -0,0 +1,223 @@
+#include "DensityGrid.h"
+#include <fstream>
+#include <cmath>
+using namespace std;
+
+const double DensityGrid::METERS_PER_DEGREE = 111320.0;
+const double DensityGrid::DEFAULT_CELL_SIZE = 250.0;
+
+// DensityGrid Implementation
+DensityGrid::DensityGrid(double minLat, double minLon, double maxLat, double maxLon, double cellSizeMeters)
+    : total(0), outside(0), populatedCells(0) {
+    if (maxLat < minLat) {
+        double swap = minLat;
+        minLat = maxLat;
+        maxLat = swap;
+    }
+    if (maxLon < minLon) {
+        double swap = minLon;
+        minLon = maxLon;
+        maxLon = swap;
+    }
+    minLatitude = minLat;
+    minLongitude = minLon;
+    cellSize = (cellSizeMeters > 0.0) ? cellSizeMeters : DEFAULT_CELL_SIZE;
+    
+    // Meters per degree of longitude shrink with latitude
+    double midLatitude = (minLat + maxLat) / 2.0 * 3.14159265358979323846 / 180.0;
+    double metersPerLonDegree = METERS_PER_DEGREE * cos(midLatitude);
+    if (metersPerLonDegree < 1.0) metersPerLonDegree = 1.0;
+    
+    while (true) {
+        cellLatitude = cellSize / METERS_PER_DEGREE;
+        cellLongitude = cellSize / metersPerLonDegree;
+        rows = (int)((maxLat - minLat) / cellLatitude) + 1;
+        columns = (int)((maxLon - minLon) / cellLongitude) + 1;
+        if ((double)rows * columns <= MAX_CELLS) break;
+        cellSize *= 2.0;
+    }
+    
+    counts = new int[rows * columns];
+    for (int i = 0; i < rows * columns; i++) {
+        counts[i] = 0;
+    }
+}
+
+DensityGrid::~DensityGrid() {
+    delete[] counts;
+}
+
+bool DensityGrid::locate(double latitude, double longitude, int& row, int& column) const {
+    double r = (latitude - minLatitude) / cellLatitude;
+    double c = (longitude - minLongitude) / cellLongitude;
+    if (r < 0.0 || c < 0.0 || r >= rows || c >= columns) return false;
+    row = (int)r;
+    column = (int)c;
+    return true;
+}
+
+bool DensityGrid::add(double latitude, double longitude, int people) {
+    if (people <= 0) return true;
+    
+    int row, column;
+    if (!locate(latitude, longitude, row, column)) {
+        outside += people;
+        return false;
+    }
+    int& cell = counts[row * columns + column];
+    if (cell == 0) populatedCells++;
+    cell += people;
+    total += people;
+    return true;
+}
+
+bool DensityGrid::remove(double latitude, double longitude, int people) {
+    if (people <= 0) return true;
+    
+    int row, column;
+    if (!locate(latitude, longitude, row, column)) {
+        outside -= (people < outside) ? people : outside;
+        return false;
+    }
+    int& cell = counts[row * columns + column];
+    if (people > cell) people = cell;
+    cell -= people;
+    total -= people;
+    if (cell == 0 && people > 0) populatedCells--;
+    return true;
+}
+
+int DensityGrid::getCount(int row, int column) const {
+    if (row < 0 || row >= rows || column < 0 || column >= columns) return 0;
+    return counts[row * columns + column];
+}
+
+int DensityGrid::getCountAt(double latitude, double longitude) const {
+    int row, column;
+    if (!locate(latitude, longitude, row, column)) return 0;
+    return counts[row * columns + column];
+}
+
+void DensityGrid::getCellCenter(int row, int column, double& latitude, double& longitude) const {
+    latitude = minLatitude + (row + 0.5) * cellLatitude;
+    longitude = minLongitude + (column + 0.5) * cellLongitude;
+}
+
+int DensityGrid::getRows() const {
+    return rows;
+}
+
+int DensityGrid::getColumns() const {
+    return columns;
+}
+
+double DensityGrid::getCellSize() const {
+    return cellSize;
+}
+
+int DensityGrid::getTotal() const {
+    return total;
+}
+
+int DensityGrid::getOutsideCount() const {
+    return outside;
+}
+
+int DensityGrid::getPopulatedCellCount() const {
+    return populatedCells;
+}
+
+int DensityGrid::getMaxCount() const {
+    int maxCount = 0;
+    for (int i = 0; i < rows * columns; i++) {
+        if (counts[i] > maxCount) maxCount = counts[i];
+    }
+    return maxCount;
+}
+
+bool DensityGrid::exportPGM(const string& filename) const {
+    ofstream file(filename.c_str(), ios::out | ios::binary);
+    if (!file.is_open()) return false;
+    
+    int maxCount = getMaxCount();
+    int maxValue = (maxCount < 1) ? 1 : ((maxCount > 65535) ? 65535 : maxCount);
+    int bytesPerPixel = (maxValue < 256) ? 1 : 2;
+    file << "P5\n" << columns << " " << rows << "\n" << maxValue << "\n";
+    
+    // PGM rows run top to bottom, so write the northern row first
+    unsigned char* buffer = new unsigned char[columns * bytesPerPixel];
+    for (int row = rows - 1; row >= 0; row--) {
+        const int* cells = counts + row * columns;
+        for (int column = 0; column < columns; column++) {
+            int value = cells[column];
+            if (maxCount > 65535) {
+                value = (int)((double)value / maxCount * 65535.0 + 0.5);
+            }
+            if (bytesPerPixel == 1) {
+                buffer[column] = (unsigned char)value;
+            } else {
+                // 16-bit PGM samples are big-endian
+                buffer[2 * column] = (unsigned char)(value >> 8);
+                buffer[2 * column + 1] = (unsigned char)(value & 0xFF);
+            }
+        }
+        file.write((const char*)buffer, columns * bytesPerPixel);
+    }
+    delete[] buffer;
+    
+    bool written = file.good();
+    file.close();
+    return written;
+}
+
+bool DensityGrid::exportCSV(const string& filename) const {
+    ofstream file(filename.c_str());
+    if (!file.is_open()) return false;
+    
+    file << "Row,Column,Latitude,Longitude,Population\n";
+    file.precision(7);
+    for (int row = 0; row < rows; row++) {
+        const int* cells = counts + row * columns;
+        for (int column = 0; column < columns; column++) {
+            if (cells[column] == 0) continue;
+            double latitude, longitude;
+            getCellCenter(row, column, latitude, longitude);
+            file << row << "," << column << "," << latitude << "," << longitude << "," << cells[column] << "\n";
+        }
+    }
+    
+    bool written = file.good();
+    file.close();
+    return written;
+}
+
+bool DensityGrid::exportBinary(const string& filename) const {
+    ofstream file(filename.c_str(), ios::out | ios::binary);
+    if (!file.is_open()) return false;
+    
+    int version = 1;
+    file.write("SCDG", 4);
+    file.write((const char*)&version, sizeof(int));
+    file.write((const char*)&rows, sizeof(int));
+    file.write((const char*)&columns, sizeof(int));
+    file.write((const char*)&minLatitude, sizeof(double));
+    file.write((const char*)&minLongitude, sizeof(double));
+    file.write((const char*)&cellLatitude, sizeof(double));
+    file.write((const char*)&cellLongitude, sizeof(double));
+    for (int row = 0; row < rows; row++) {
+        file.write((const char*)(counts + row * columns), columns * sizeof(int));
+    }
+    
+    bool written = file.good();
+    file.close();
+    return written;
+}
+
+void DensityGrid::clear() {
+    for (int i = 0; i < rows * columns; i++) {
+        counts[i] = 0;
+    }
+    total = 0;
+    outside = 0;
+    populatedCells = 0;
+}
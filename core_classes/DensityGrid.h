@@ -0,0 +1,96 @@
+#ifndef DENSITYGRID_H
+#define DENSITYGRID_H
+
+#include <string>
+using namespace std;
+
+// DensityGrid class - Raster of population counts over a latitude/longitude box
+// Used for: Population heatmaps at street-block resolution (instead of one value per sector)
+// Cells are square in meters (converted to degrees at the box's mid latitude) and stored
+// row-major with row 0 at the southern edge. Counts are updated in O(1) as citizens are
+// added or removed, so exports only stream the current cells to disk.
+class DensityGrid {
+private:
+    double minLatitude;
+    double minLongitude;
+    double cellLatitude;          // Cell height in degrees
+    double cellLongitude;         // Cell width in degrees
+    double cellSize;              // Cell edge in meters
+    int rows;
+    int columns;
+    int* counts;                  // rows × columns people per cell
+    int total;                    // People inside the grid
+    int outside;                  // People added at points outside the grid
+    int populatedCells;           // Cells with at least one person
+    
+    // Get the cell of a point
+    // Returns: false if the point is outside the grid
+    bool locate(double latitude, double longitude, int& row, int& column) const;
+
+public:
+    static const double METERS_PER_DEGREE;    // Meters per degree of latitude
+    static const double DEFAULT_CELL_SIZE;    // 250 m
+    static const int MAX_CELLS = 16777216;    // Cells are enlarged to stay under this (64 MB of counts)
+    
+    // Constructor
+    // Parameters: bounding box in degrees, cellSizeMeters (<= 0 for DEFAULT_CELL_SIZE)
+    // Complexity: O(rows × columns)
+    DensityGrid(double minLatitude, double minLongitude, double maxLatitude, double maxLongitude,
+                double cellSizeMeters = DEFAULT_CELL_SIZE);
+    
+    // Destructor
+    ~DensityGrid();
+    
+    // Add / remove people at a point
+    // Returns: false if the point is outside the grid (tracked in getOutsideCount)
+    // Complexity: O(1)
+    bool add(double latitude, double longitude, int people = 1);
+    bool remove(double latitude, double longitude, int people = 1);
+    
+    // Get the count of a cell (0 if out of range)
+    // Complexity: O(1)
+    int getCount(int row, int column) const;
+    int getCountAt(double latitude, double longitude) const;
+    
+    // Get the center of a cell
+    // Complexity: O(1)
+    void getCellCenter(int row, int column, double& latitude, double& longitude) const;
+    
+    // Grid shape and totals
+    // Complexity: O(1)
+    int getRows() const;
+    int getColumns() const;
+    double getCellSize() const;
+    int getTotal() const;
+    int getOutsideCount() const;
+    int getPopulatedCellCount() const;
+    
+    // Get the largest cell count
+    // Complexity: O(rows × columns)
+    int getMaxCount() const;
+    
+    // Export as a binary PGM image (P5), north at the top
+    // Counts are written as-is when the largest fits in 16 bits, otherwise scaled to 0-65535
+    // Returns: false if the file cannot be written
+    // Complexity: O(rows × columns), one row buffer
+    bool exportPGM(const string& filename) const;
+    
+    // Export populated cells as CSV: Row,Column,Latitude,Longitude,Population
+    // Returns: false if the file cannot be written
+    // Complexity: O(rows × columns)
+    bool exportCSV(const string& filename) const;
+    
+    // Export as a compact binary grid
+    // Format: "SCDG", int32 version (1), int32 rows, int32 columns, float64 minLatitude,
+    //         float64 minLongitude, float64 cellLatitude, float64 cellLongitude,
+    //         then rows × columns int32 counts (row 0 = south), all in native byte order
+    // Returns: false if the file cannot be written
+    // Complexity: O(rows × columns)
+    bool exportBinary(const string& filename) const;
+    
+    // Set every cell to zero
+    // Complexity: O(rows × columns)
+    void clear();
+};
+
+#endif // DENSITYGRID_H
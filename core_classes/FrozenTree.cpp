@@ -0,0 +1,221 @@
+#include "FrozenTree.h"
+using namespace std;
+
+// FrozenTree Implementation
+FrozenTree::FrozenTree(TreeNode* root) : nodes(nullptr), parents(nullptr), depths(nullptr),
+                                         subtreeEnds(nullptr), idOrder(nullptr), nodeCount(0),
+                                         height(-1), leafCount(0) {
+    if (root == nullptr) {
+        return;
+    }
+    
+    // First pass: count nodes with an explicit stack (no recursion on deep trees)
+    int stackCapacity = 16;
+    TreeNode** stack = new TreeNode*[stackCapacity];
+    int stackSize = 0;
+    stack[stackSize++] = root;
+    while (stackSize > 0) {
+        TreeNode* node = stack[--stackSize];
+        nodeCount++;
+        for (TreeNode* child = node->firstChild; child != nullptr; child = child->nextSibling) {
+            if (stackSize >= stackCapacity) {
+                int newCapacity = stackCapacity * 2;
+                TreeNode** newStack = new TreeNode*[newCapacity];
+                for (int i = 0; i < stackSize; i++) {
+                    newStack[i] = stack[i];
+                }
+                delete[] stack;
+                stack = newStack;
+                stackCapacity = newCapacity;
+            }
+            stack[stackSize++] = child;
+        }
+    }
+    delete[] stack;
+    
+    nodes = new TreeNode*[nodeCount];
+    parents = new int[nodeCount];
+    depths = new int[nodeCount];
+    subtreeEnds = new int[nodeCount];
+    idOrder = new int[nodeCount];
+    
+    // Second pass: preorder walk. The stack holds (node, parent index) pairs and
+    // children are pushed last-to-first so the first child is visited first.
+    TreeNode** nodeStack = new TreeNode*[nodeCount];
+    int* parentStack = new int[nodeCount];
+    int top = 0;
+    nodeStack[top] = root;
+    parentStack[top] = -1;
+    top++;
+    
+    int index = 0;
+    while (top > 0) {
+        top--;
+        TreeNode* node = nodeStack[top];
+        int parent = parentStack[top];
+        
+        nodes[index] = node;
+        parents[index] = parent;
+        depths[index] = (parent == -1) ? 0 : depths[parent] + 1;
+        subtreeEnds[index] = index + 1;
+        idOrder[index] = index;
+        if (depths[index] > height) height = depths[index];
+        
+        int childCount = 0;
+        for (TreeNode* child = node->firstChild; child != nullptr; child = child->nextSibling) {
+            nodeStack[top + childCount] = child;
+            parentStack[top + childCount] = index;
+            childCount++;
+        }
+        for (int i = 0; i < childCount / 2; i++) {
+            TreeNode* temp = nodeStack[top + i];
+            nodeStack[top + i] = nodeStack[top + childCount - 1 - i];
+            nodeStack[top + childCount - 1 - i] = temp;
+        }
+        top += childCount;
+        if (childCount == 0) leafCount++;
+        index++;
+    }
+    delete[] nodeStack;
+    delete[] parentStack;
+    
+    // Children follow their parent in preorder, so one backward pass closes every range
+    for (int i = nodeCount - 1; i > 0; i--) {
+        if (subtreeEnds[i] > subtreeEnds[parents[i]]) {
+            subtreeEnds[parents[i]] = subtreeEnds[i];
+        }
+    }
+    
+    sortIDs();
+}
+
+FrozenTree::~FrozenTree() {
+    delete[] nodes;
+    delete[] parents;
+    delete[] depths;
+    delete[] subtreeEnds;
+    delete[] idOrder;
+}
+
+void FrozenTree::sortIDs() {
+    if (nodeCount < 2) return;
+    
+    int* buffer = new int[nodeCount];
+    int* source = idOrder;
+    int* target = buffer;
+    for (int width = 1; width < nodeCount; width *= 2) {
+        for (int low = 0; low < nodeCount; low += 2 * width) {
+            int mid = (low + width < nodeCount) ? low + width : nodeCount;
+            int high = (low + 2 * width < nodeCount) ? low + 2 * width : nodeCount;
+            int i = low, j = mid, k = low;
+            while (i < mid && j < high) {
+                if (nodes[source[j]]->nodeID < nodes[source[i]]->nodeID) {
+                    target[k++] = source[j++];
+                } else {
+                    target[k++] = source[i++];
+                }
+            }
+            while (i < mid) target[k++] = source[i++];
+            while (j < high) target[k++] = source[j++];
+        }
+        int* temp = source;
+        source = target;
+        target = temp;
+    }
+    
+    // Keep the sorted run in idOrder
+    if (source != idOrder) {
+        for (int i = 0; i < nodeCount; i++) {
+            idOrder[i] = source[i];
+        }
+        delete[] source;
+    } else {
+        delete[] target;
+    }
+}
+
+int FrozenTree::indexOf(const string& nodeID) const {
+    int low = 0;
+    int high = nodeCount - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        int cmp = nodes[idOrder[mid]]->nodeID.compare(nodeID);
+        if (cmp == 0) return idOrder[mid];
+        if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+TreeNode* FrozenTree::getNode(int index) const {
+    if (index < 0 || index >= nodeCount) return nullptr;
+    return nodes[index];
+}
+
+int FrozenTree::getParent(int index) const {
+    if (index < 0 || index >= nodeCount) return -1;
+    return parents[index];
+}
+
+int FrozenTree::getDepth(int index) const {
+    if (index < 0 || index >= nodeCount) return -1;
+    return depths[index];
+}
+
+int FrozenTree::getSubtreeSize(int index) const {
+    if (index < 0 || index >= nodeCount) return 0;
+    return subtreeEnds[index] - index;
+}
+
+bool FrozenTree::isAncestor(int ancestor, int descendant) const {
+    if (ancestor < 0 || ancestor >= nodeCount || descendant < 0 || descendant >= nodeCount) {
+        return false;
+    }
+    return ancestor < descendant && descendant < subtreeEnds[ancestor];
+}
+
+string* FrozenTree::getPathToNode(int index, int& pathLength) const {
+    if (index < 0 || index >= nodeCount) {
+        pathLength = 0;
+        return nullptr;
+    }
+    
+    pathLength = depths[index] + 1;
+    string* path = new string[pathLength];
+    int current = index;
+    for (int i = pathLength - 1; i >= 0; i--) {
+        path[i] = nodes[current]->nodeID;
+        current = parents[current];
+    }
+    return path;
+}
+
+int* FrozenTree::getLevelCounts(int& levels) const {
+    levels = 0;
+    if (nodeCount == 0) return nullptr;
+    
+    levels = height + 1;
+    int* counts = new int[levels];
+    for (int i = 0; i < levels; i++) {
+        counts[i] = 0;
+    }
+    for (int i = 0; i < nodeCount; i++) {
+        counts[depths[i]]++;
+    }
+    return counts;
+}
+
+int FrozenTree::getNodeCount() const {
+    return nodeCount;
+}
+
+int FrozenTree::getHeight() const {
+    return height;
+}
+
+int FrozenTree::getLeafCount() const {
+    return leafCount;
+}
@@ -0,0 +1,73 @@
+#ifndef FROZENTREE_H
+#define FROZENTREE_H
+
+#include <string>
+#include "TreeNode.h"
+using namespace std;
+
+// FrozenTree class - Read-only preorder (Euler tour) snapshot of an N-ary tree
+// Used for: Organogram queries on School → Department → Class trees
+// Node i's subtree is the preorder range [i, subtreeEnd[i]), so ancestor checks and
+// subtree sizes are O(1); depth and parent are stored per node.
+// The snapshot points at the tree's nodes and must be rebuilt after the tree changes.
+class FrozenTree {
+private:
+    TreeNode** nodes;         // Nodes in preorder (not owned)
+    int* parents;             // Preorder index of the parent (-1 for the root)
+    int* depths;              // Distance from the root
+    int* subtreeEnds;         // One past the last preorder index in each subtree
+    int* idOrder;             // Preorder indices sorted by nodeID (for lookup)
+    int nodeCount;
+    int height;               // Largest depth (-1 if empty)
+    int leafCount;
+    
+    // Sort idOrder by nodeID
+    // Complexity: O(n log n) - bottom-up merge sort
+    void sortIDs();
+
+public:
+    // Constructor: Snapshot the tree rooted at root (may be nullptr)
+    // Complexity: O(n log n) where n is number of nodes (O(n) walk + ID sort)
+    FrozenTree(TreeNode* root);
+    
+    // Destructor (nodes are not deleted)
+    // Complexity: O(1)
+    ~FrozenTree();
+    
+    // Find a node's preorder index by ID
+    // Returns: -1 if not found
+    // Complexity: O(log n)
+    int indexOf(const string& nodeID) const;
+    
+    // Get the node at a preorder index (nullptr if out of range)
+    // Complexity: O(1)
+    TreeNode* getNode(int index) const;
+    
+    // Get parent index / depth / subtree size of a node (-1 / -1 / 0 if out of range)
+    // Complexity: O(1)
+    int getParent(int index) const;
+    int getDepth(int index) const;
+    int getSubtreeSize(int index) const;
+    
+    // Check if ancestor is a proper ancestor of descendant (by preorder index)
+    // Complexity: O(1)
+    bool isAncestor(int ancestor, int descendant) const;
+    
+    // Get the IDs from the root down to a node
+    // Returns: Array of node IDs (caller must delete[]), nullptr if out of range
+    // Complexity: O(h) where h is the node's depth
+    string* getPathToNode(int index, int& pathLength) const;
+    
+    // Count nodes on every level
+    // Returns: Array indexed by depth (caller must delete[]), levels = height + 1; nullptr if empty
+    // Complexity: O(n)
+    int* getLevelCounts(int& levels) const;
+    
+    // Get totals
+    // Complexity: O(1)
+    int getNodeCount() const;
+    int getHeight() const;
+    int getLeafCount() const;
+};
+
+#endif // FROZENTREE_H
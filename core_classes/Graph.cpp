@@ -3,12 +3,90 @@
 #include <cmath>
 using namespace std;
 
-
-const double M_PI = 3.14159265358979323846;
+// Degrees to radians (M_PI is not defined by every <cmath>)
+const double DEGREES_TO_RADIANS = 3.14159265358979323846 / 180.0;
 
 // Maximum distance value for Dijkstra's algorithm (represents "infinity")
 const double MAX_DISTANCE = 1000000.0;
 
+// Binary min-heap of (distance, vertex index) pairs used by the bounded searches
+// Outdated entries are skipped when popped (lazy deletion), so no decrease-key is needed
+struct GraphSearchHeap {
+    double* distances;        // Tentative distance of each entry
+    int* vertices;            // Vertex index of each entry
+    int size;                 // Current number of entries
+    int capacity;             // Allocated size of the arrays
+    
+    GraphSearchHeap(int cap) : size(0), capacity(cap < 1 ? 1 : cap) {
+        distances = new double[capacity];
+        vertices = new int[capacity];
+    }
+    
+    ~GraphSearchHeap() {
+        delete[] distances;
+        delete[] vertices;
+    }
+    
+    bool isEmpty() const {
+        return size == 0;
+    }
+    
+    void push(double distance, int vertex) {
+        if (size >= capacity) {
+            int newCapacity = capacity * 2;
+            double* newDistances = new double[newCapacity];
+            int* newVertices = new int[newCapacity];
+            for (int i = 0; i < size; i++) {
+                newDistances[i] = distances[i];
+                newVertices[i] = vertices[i];
+            }
+            delete[] distances;
+            delete[] vertices;
+            distances = newDistances;
+            vertices = newVertices;
+            capacity = newCapacity;
+        }
+        
+        // Bubble up
+        int index = size++;
+        while (index > 0) {
+            int parentIndex = (index - 1) / 2;
+            if (distances[parentIndex] <= distance) break;
+            distances[index] = distances[parentIndex];
+            vertices[index] = vertices[parentIndex];
+            index = parentIndex;
+        }
+        distances[index] = distance;
+        vertices[index] = vertex;
+    }
+    
+    bool pop(double& distance, int& vertex) {
+        if (size == 0) return false;
+        
+        distance = distances[0];
+        vertex = vertices[0];
+        size--;
+        if (size == 0) return true;
+        
+        // Bubble down the last element from the root
+        double lastDistance = distances[size];
+        int lastVertex = vertices[size];
+        int index = 0;
+        while (true) {
+            int child = 2 * index + 1;
+            if (child >= size) break;
+            if (child + 1 < size && distances[child + 1] < distances[child]) child++;
+            if (distances[child] >= lastDistance) break;
+            distances[index] = distances[child];
+            vertices[index] = vertices[child];
+            index = child;
+        }
+        distances[index] = lastDistance;
+        vertices[index] = lastVertex;
+        return true;
+    }
+};
+
 // Edge Implementation
 Edge::Edge(int dest, double w) : destination(dest), weight(w), next(nullptr) {
 }
@@ -33,7 +111,13 @@ Vertex::~Vertex() {
 }
 
 // Graph Implementation
-Graph::Graph(int maxV, bool isDirected) : maxVertices(maxV), vertexCount(0), directed(isDirected) {
+Graph::Graph(int maxV, bool isDirected)
+    : maxVertices(maxV), vertexCount(0), directed(isDirected), version(0),
+      searchDistances(nullptr), reachedMarks(nullptr), settledMarks(nullptr),
+      targetHeads(nullptr), targetMarks(nullptr), searchStamp(0),
+      reverseHead(nullptr), reverseNext(nullptr), reverseSource(nullptr), reverseWeight(nullptr),
+      reverseCapacity(0), reverseVersion(-1) {
+    vertexIndex = new HashTable(101);
     vertices = new Vertex[maxVertices];
     for (int i = 0; i < maxVertices; i++) {
         vertices[i] = Vertex();
@@ -44,26 +128,95 @@ Graph::~Graph() {
     clear();
     delete[] vertices;
     vertices = nullptr;
+    delete vertexIndex;
+    vertexIndex = nullptr;
+    delete[] searchDistances;
+    delete[] reachedMarks;
+    delete[] settledMarks;
+    delete[] targetHeads;
+    delete[] targetMarks;
+    delete[] reverseHead;
+    delete[] reverseNext;
+    delete[] reverseSource;
+    delete[] reverseWeight;
 }
 
-int Graph::findVertexIndex(const string& vertexID) {
+void Graph::beginSearch() {
+    if (searchDistances == nullptr) {
+        searchDistances = new double[maxVertices];
+        reachedMarks = new int[maxVertices];
+        settledMarks = new int[maxVertices];
+        targetHeads = new int[maxVertices];
+        targetMarks = new int[maxVertices];
+        for (int i = 0; i < maxVertices; i++) {
+            reachedMarks[i] = 0;
+            settledMarks[i] = 0;
+            targetMarks[i] = 0;
+        }
+    }
+    
+    // Clear the marks only when the stamp is about to wrap around
+    if (searchStamp == 2147483647) {
+        for (int i = 0; i < maxVertices; i++) {
+            reachedMarks[i] = 0;
+            settledMarks[i] = 0;
+            targetMarks[i] = 0;
+        }
+        searchStamp = 0;
+    }
+    searchStamp++;
+}
+
+void Graph::buildReverseEdges() {
+    if (reverseVersion == version) return;
+    
+    int edgeTotal = getEdgeCount();
+    if (reverseHead == nullptr) {
+        reverseHead = new int[maxVertices];
+    }
+    if (edgeTotal > reverseCapacity) {
+        delete[] reverseNext;
+        delete[] reverseSource;
+        delete[] reverseWeight;
+        reverseCapacity = edgeTotal;
+        reverseNext = new int[reverseCapacity];
+        reverseSource = new int[reverseCapacity];
+        reverseWeight = new double[reverseCapacity];
+    }
+    
     for (int i = 0; i < vertexCount; i++) {
-        if (vertices[i].vertexID == vertexID) {
-            return i;
+        reverseHead[i] = -1;
+    }
+    int e = 0;
+    for (int u = 0; u < vertexCount; u++) {
+        for (Edge* edge = vertices[u].edgeList; edge != nullptr; edge = edge->next) {
+            reverseSource[e] = u;
+            reverseWeight[e] = edge->weight;
+            reverseNext[e] = reverseHead[edge->destination];
+            reverseHead[edge->destination] = e;
+            e++;
         }
     }
-    return -1;
+    reverseVersion = version;
+}
+
+int Graph::findVertexIndex(const string& vertexID) {
+    void* data = vertexIndex->search(vertexID);
+    if (data == nullptr) return -1;
+    
+    // The table stores the vertex's address inside the vertices array
+    return (int)((Vertex*)data - vertices);
 }
 
 double Graph::calculateDistance(double lat1, double lon1, double lat2, double lon2) {
     // Haversine formula to calculate distance between two coordinates
     const double R = 6371.0; // Earth radius in kilometers
     
-    double dLat = (lat2 - lat1) * M_PI / 180.0;
-    double dLon = (lon2 - lon1) * M_PI / 180.0;
+    double dLat = (lat2 - lat1) * DEGREES_TO_RADIANS;
+    double dLon = (lon2 - lon1) * DEGREES_TO_RADIANS;
     
     double a = sin(dLat / 2.0) * sin(dLat / 2.0) +
-               cos(lat1 * M_PI / 180.0) * cos(lat2 * M_PI / 180.0) *
+               cos(lat1 * DEGREES_TO_RADIANS) * cos(lat2 * DEGREES_TO_RADIANS) *
                sin(dLon / 2.0) * sin(dLon / 2.0);
     
     double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
@@ -83,8 +236,10 @@ bool Graph::addVertex(const string& vertexID, const string& name,
     vertices[vertexCount].longitude = longitude;
     vertices[vertexCount].data = data;
     vertices[vertexCount].edgeList = nullptr;
+    vertexIndex->insert(vertexID, (void*)&vertices[vertexCount]);
     
     vertexCount++;
+    version++;
     return true;
 }
 
@@ -101,12 +256,22 @@ bool Graph::addEdge(int fromIndex, int toIndex, double weight) {
     if (fromIndex < 0 || fromIndex >= vertexCount) return false;
     if (toIndex < 0 || toIndex >= vertexCount) return false;
     
+    version++;
+    
     // Check if edge already exists
     Edge* current = vertices[fromIndex].edgeList;
     while (current != nullptr) {
         if (current->destination == toIndex) {
-            // Update weight of existing edge
+            // Update weight of existing edge (both directions if undirected)
             current->weight = weight;
+            if (!directed) {
+                for (Edge* reverse = vertices[toIndex].edgeList; reverse != nullptr; reverse = reverse->next) {
+                    if (reverse->destination == fromIndex) {
+                        reverse->weight = weight;
+                        break;
+                    }
+                }
+            }
             return true;
         }
         current = current->next;
@@ -177,6 +342,7 @@ bool Graph::removeEdge(const string& fromID, const string& toID) {
                 previous->next = current->next;
             }
             delete current;
+            version++;
             
             // If undirected, remove reverse edge
             if (!directed) {
@@ -237,11 +403,19 @@ bool Graph::removeVertex(const string& vertexID) {
     }
     
     // Shift vertices array
+    vertexIndex->remove(vertexID);
     for (int i = index; i < vertexCount - 1; i++) {
         vertices[i] = vertices[i + 1];
+        vertexIndex->insert(vertices[i].vertexID, (void*)&vertices[i]); // Point at new slot
     }
     
+    // The vacated last slot still shares its edge list with the shifted copy
+    vertices[vertexCount - 1].edgeList = nullptr;
+    vertices[vertexCount - 1].vertexID = "";
+    vertices[vertexCount - 1].data = nullptr;
+    
     vertexCount--;
+    version++;
     return true;
 }
 
@@ -261,7 +435,7 @@ std::string* Graph::findShortestPath(const std::string& startID, const std::stri
         return path;
     }
     
-    // Dijkstra's Algorithm
+    // Dijkstra's Algorithm with a binary heap (outdated entries are skipped when popped)
     double* distances = new double[vertexCount];
     int* previous = new int[vertexCount];
     bool* visited = new bool[vertexCount];
@@ -273,34 +447,29 @@ std::string* Graph::findShortestPath(const std::string& startID, const std::stri
         visited[i] = false;
     }
     
+    GraphSearchHeap heap(vertexCount + 1);
     distances[startIndex] = 0.0;
+    heap.push(0.0, startIndex);
     
     // Dijkstra's main loop
-    for (int count = 0; count < vertexCount; count++) {
-        // Find unvisited vertex with minimum distance
-        int minIndex = -1;
-        double minDist = MAX_DISTANCE;
+    double distance = 0.0;
+    int u = -1;
+    while (heap.pop(distance, u)) {
+        if (visited[u] || distance > distances[u]) continue;
+        if (u == endIndex) break;
         
-        for (int i = 0; i < vertexCount; i++) {
-            if (!visited[i] && distances[i] < minDist) {
-                minDist = distances[i];
-                minIndex = i;
-            }
-        }
-        
-        if (minIndex == -1 || minIndex == endIndex) break;
-        
-        visited[minIndex] = true;
+        visited[u] = true;
         
         // Update distances to neighbors
-        Edge* current = vertices[minIndex].edgeList;
+        Edge* current = vertices[u].edgeList;
         while (current != nullptr) {
             int neighbor = current->destination;
             if (!visited[neighbor]) {
-                double alt = distances[minIndex] + current->weight;
+                double alt = distance + current->weight;
                 if (alt < distances[neighbor]) {
                     distances[neighbor] = alt;
-                    previous[neighbor] = minIndex;
+                    previous[neighbor] = u;
+                    heap.push(alt, neighbor);
                 }
             }
             current = current->next;
@@ -342,6 +511,92 @@ std::string* Graph::findShortestPath(const std::string& startID, const std::stri
     return path;
 }
 
+int Graph::findNearestTargets(const string& startID, const string* targetIDs, int targetCount, int k,
+                              int* foundTargets, double* foundDistances) {
+    if (targetIDs == nullptr || foundTargets == nullptr || foundDistances == nullptr) return 0;
+    if (targetCount <= 0 || k <= 0) return 0;
+    
+    int startIndex = findVertexIndex(startID);
+    if (startIndex == -1) return 0;
+    
+    beginSearch();
+    const int stamp = searchStamp;
+    
+    // Bucket targets by vertex (several targets may share one vertex)
+    // Filled back to front so each bucket lists targets in their original order
+    int* targetNext = new int[targetCount];
+    int knownTargets = 0;
+    for (int t = targetCount - 1; t >= 0; t--) {
+        targetNext[t] = -1;
+        int v = findVertexIndex(targetIDs[t]);
+        if (v == -1) continue;
+        if (targetMarks[v] == stamp) targetNext[t] = targetHeads[v];
+        targetHeads[v] = t;
+        targetMarks[v] = stamp;
+        knownTargets++;
+    }
+    
+    if (knownTargets == 0) {
+        delete[] targetNext;
+        return 0;
+    }
+    if (k > knownTargets) k = knownTargets;
+    
+    // Directed graphs are searched over incoming edges
+    if (directed) buildReverseEdges();
+    
+    // The heap grows on demand, so a search that stops early never sizes it by V
+    GraphSearchHeap heap(16);
+    searchDistances[startIndex] = 0.0;
+    reachedMarks[startIndex] = stamp;
+    heap.push(0.0, startIndex);
+    
+    int found = 0;
+    double distance = 0.0;
+    int u = -1;
+    while (found < k && heap.pop(distance, u)) {
+        if (settledMarks[u] == stamp || distance > searchDistances[u]) continue; // Outdated heap entry
+        settledMarks[u] = stamp;
+        
+        // Every target at this vertex is now final
+        int firstTarget = (targetMarks[u] == stamp) ? targetHeads[u] : -1;
+        for (int t = firstTarget; t != -1 && found < k; t = targetNext[t]) {
+            foundTargets[found] = t;
+            foundDistances[found] = distance;
+            found++;
+        }
+        if (found >= k) break;
+        
+        // Relax neighbours
+        if (!directed) {
+            for (Edge* edge = vertices[u].edgeList; edge != nullptr; edge = edge->next) {
+                int neighbor = edge->destination;
+                double alt = distance + edge->weight;
+                if (settledMarks[neighbor] == stamp) continue;
+                if (reachedMarks[neighbor] != stamp || alt < searchDistances[neighbor]) {
+                    searchDistances[neighbor] = alt;
+                    reachedMarks[neighbor] = stamp;
+                    heap.push(alt, neighbor);
+                }
+            }
+        } else {
+            for (int e = reverseHead[u]; e != -1; e = reverseNext[e]) {
+                int neighbor = reverseSource[e];
+                double alt = distance + reverseWeight[e];
+                if (settledMarks[neighbor] == stamp) continue;
+                if (reachedMarks[neighbor] != stamp || alt < searchDistances[neighbor]) {
+                    searchDistances[neighbor] = alt;
+                    reachedMarks[neighbor] = stamp;
+                    heap.push(alt, neighbor);
+                }
+            }
+        }
+    }
+    
+    delete[] targetNext;
+    return found;
+}
+
 std::string Graph::findNearestLocation(double latitude, double longitude) {
     if (vertexCount == 0) return "";
     
@@ -541,7 +796,9 @@ void Graph::clear() {
         vertices[i].name = "";
         vertices[i].data = nullptr;
     }
+    vertexIndex->clear();
     vertexCount = 0;
+    version++;
 }
 
 Vertex* Graph::getVertexAt(int index) {
@@ -549,6 +806,14 @@ Vertex* Graph::getVertexAt(int index) {
     return &vertices[index];
 }
 
+Vertex* Graph::findVertex(const string& vertexID) {
+    return (Vertex*)vertexIndex->search(vertexID);
+}
+
+int Graph::getVersion() const {
+    return version;
+}
+
 bool Graph::getEdgesForVertex(int vertexIndex, int* destinations, double* weights, int maxEdges, int& actualCount) {
     if (vertexIndex < 0 || vertexIndex >= vertexCount) return false;
     if (destinations == nullptr || weights == nullptr) return false;
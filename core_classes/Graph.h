@@ -2,6 +2,7 @@
 #define GRAPH_H
 
 #include <string>
+#include "HashTable.h"
 using namespace std;
 
 // Structure for an edge in the graph (weighted edge)
@@ -35,15 +36,37 @@ private:
     int maxVertices;          // Maximum number of vertices
     int vertexCount;          // Current number of vertices
     bool directed;            // true for directed graph, false for undirected
+    HashTable* vertexIndex;   // Hash table for vertex lookup by ID (key = vertexID, value = Vertex* into vertices)
+    int version;              // Bumped on every change to vertices or edges
+    
+    // Scratch state of findNearestTargets, kept across calls (maxVertices entries, allocated on first use)
+    // An entry is only valid while its mark equals searchStamp, so a call resets nothing up front
+    double* searchDistances;  // Tentative distance of each vertex
+    int* reachedMarks;        // searchStamp when searchDistances was set
+    int* settledMarks;        // searchStamp when the vertex was settled
+    int* targetHeads;         // First target at each vertex
+    int* targetMarks;         // searchStamp when targetHeads was set
+    int searchStamp;
+    
+    // Incoming edges for searches on a directed graph, rebuilt only when version changes
+    int* reverseHead;
+    int* reverseNext;
+    int* reverseSource;
+    double* reverseWeight;
+    int reverseCapacity;      // Allocated size of the per-edge arrays
+    int reverseVersion;       // version the incoming edges were built from (-1 if never)
+    
+    // Helper: Start a new findNearestTargets search (allocates the scratch arrays on first use)
+    void beginSearch();
+    
+    // Helper: Rebuild the incoming edge lists if the graph changed since the last build
+    // Complexity: O(V + E) when rebuilt, O(1) otherwise
+    void buildReverseEdges();
     
     // Helper function to find vertex index by ID
-    // Complexity: O(V) where V is number of vertices
+    // Complexity: O(1) average (hash lookup)
     int findVertexIndex(const string& vertexID);
     
-    // Helper function to calculate distance between two coordinates (Haversine or Euclidean)
-    // Complexity: O(1)
-    double calculateDistance(double lat1, double lon1, double lat2, double lon2);
-    
 public:
     // Constructor: Initializes graph with maximum number of vertices
     // Complexity: O(V)
@@ -75,13 +98,27 @@ public:
     // Complexity: O(V + E)
     bool removeVertex(const string& vertexID);
     
-    // Find shortest path using Dijkstra's Algorithm
-    // Complexity: O(V^2) for basic implementation, can be optimized to O(V log V + E)
+    // Find shortest path using Dijkstra's Algorithm (binary heap, stops once endID is settled)
+    // Complexity: O((V + E) log V)
     // Returns: Array of vertex IDs representing the shortest path
     // Parameters: startID, endID, pathLength (output), totalDistance (output)
     string* findShortestPath(const string& startID, const string& endID, 
                                    int& pathLength, double& totalDistance);
     
+    // Find the k targets closest (by path distance) to a start vertex with one bounded Dijkstra search
+    // Distances are measured from each target to startID (incoming edges), so the result
+    // ranks targets by how quickly they can reach the start; the search stops as soon as
+    // k targets have been settled instead of exploring the whole graph
+    // Scratch arrays are reused between calls, so a search only pays for the vertices it touches
+    // Complexity: O(n + (V' + E') log V') where n is targetCount and V', E' are the vertices/edges
+    //             explored before the k-th target (plus O(V + E) once after a directed graph changes)
+    // Parameters: startID, targetIDs array (duplicates allowed), targetCount, k,
+    //             foundTargets (output, positions in targetIDs, nearest first), foundDistances (output)
+    // Returns: number of targets found (at most k; unreachable or unknown targets are skipped)
+    // Note: Caller must allocate foundTargets and foundDistances with at least k entries
+    int findNearestTargets(const string& startID, const string* targetIDs, int targetCount, int k,
+                           int* foundTargets, double* foundDistances);
+    
     // Find nearest location to given coordinates
     // Complexity: O(V)
     string findNearestLocation(double latitude, double longitude);
@@ -104,6 +141,11 @@ public:
     // Returns: true if vertex found and coordinates set, false otherwise
     bool getVertexCoordinates(const string& vertexID, double& latitude, double& longitude);
     
+    // Great-circle (Haversine) distance between two coordinates in kilometers
+    // Shared by every module that measures straight-line distances
+    // Complexity: O(1)
+    static double calculateDistance(double lat1, double lon1, double lat2, double lon2);
+    
     // Get connected stops (neighbors that are bus stops) for a vertex
     // Complexity: O(E) where E is edges of the vertex
     // Parameters: vertexID, connectedStops array (output), maxStops, actualCount (output)
@@ -139,6 +181,16 @@ public:
     // Returns: Pointer to Vertex, or nullptr if index invalid
     Vertex* getVertexAt(int index);
     
+    // Find a vertex by ID
+    // Complexity: O(1) average (hash lookup)
+    // Returns: Pointer to Vertex (valid until the next addVertex/removeVertex), nullptr if not found
+    Vertex* findVertex(const string& vertexID);
+    
+    // Get the change counter (differs from an earlier value once vertices or edges changed)
+    // Used by callers that cache data derived from the graph
+    // Complexity: O(1)
+    int getVersion() const;
+    
     // Get all edges for a vertex at index
     // Complexity: O(E) where E is edges of vertex
     // Parameters: vertexIndex, destinations array (output), weights array (output), maxEdges, actualCount (output)
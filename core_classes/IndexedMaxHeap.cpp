@@ -0,0 +1,220 @@
+#include "IndexedMaxHeap.h"
+using namespace std;
+
+// IndexedHeapNode Implementation
+IndexedHeapNode::IndexedHeapNode() : handle(-1), priority(0.0), data(nullptr) {
+}
+
+// IndexedMaxHeap Implementation
+IndexedMaxHeap::IndexedMaxHeap(int cap) : heapSize(0) {
+    capacity = (cap > 0) ? cap : 1;
+    handleCapacity = capacity;
+    heapArray = new IndexedHeapNode[capacity];
+    positions = new int[handleCapacity];
+    for (int i = 0; i < handleCapacity; i++) {
+        positions[i] = -1;
+    }
+}
+
+IndexedMaxHeap::~IndexedMaxHeap() {
+    delete[] heapArray;
+    delete[] positions;
+    heapArray = nullptr;
+    positions = nullptr;
+}
+
+void IndexedMaxHeap::swapNodes(int index1, int index2) {
+    IndexedHeapNode temp = heapArray[index1];
+    heapArray[index1] = heapArray[index2];
+    heapArray[index2] = temp;
+    positions[heapArray[index1].handle] = index1;
+    positions[heapArray[index2].handle] = index2;
+}
+
+void IndexedMaxHeap::siftUp(int index) {
+    while (index > 0) {
+        int parentIndex = (index - 1) / 2;
+        if (heapArray[index].priority <= heapArray[parentIndex].priority) break;
+        swapNodes(index, parentIndex);
+        index = parentIndex;
+    }
+}
+
+void IndexedMaxHeap::siftDown(int index) {
+    while (true) {
+        int largest = index;
+        int left = 2 * index + 1;
+        int right = 2 * index + 2;
+        if (left < heapSize && heapArray[left].priority > heapArray[largest].priority) largest = left;
+        if (right < heapSize && heapArray[right].priority > heapArray[largest].priority) largest = right;
+        if (largest == index) break;
+        swapNodes(index, largest);
+        index = largest;
+    }
+}
+
+void IndexedMaxHeap::ensureHandleCapacity(int handle) {
+    if (handle < handleCapacity) return;
+    
+    int newCapacity = handleCapacity * 2;
+    while (newCapacity <= handle) newCapacity *= 2;
+    int* newPositions = new int[newCapacity];
+    for (int i = 0; i < newCapacity; i++) {
+        newPositions[i] = (i < handleCapacity) ? positions[i] : -1;
+    }
+    delete[] positions;
+    positions = newPositions;
+    handleCapacity = newCapacity;
+}
+
+bool IndexedMaxHeap::insert(int handle, double priority, void* data) {
+    if (handle < 0 || contains(handle)) return false;
+    ensureHandleCapacity(handle);
+    
+    if (heapSize >= capacity) {
+        int newCapacity = capacity * 2;
+        IndexedHeapNode* newArray = new IndexedHeapNode[newCapacity];
+        for (int i = 0; i < heapSize; i++) {
+            newArray[i] = heapArray[i];
+        }
+        delete[] heapArray;
+        heapArray = newArray;
+        capacity = newCapacity;
+    }
+    
+    heapArray[heapSize].handle = handle;
+    heapArray[heapSize].priority = priority;
+    heapArray[heapSize].data = data;
+    positions[handle] = heapSize;
+    heapSize++;
+    siftUp(heapSize - 1);
+    return true;
+}
+
+bool IndexedMaxHeap::updatePriority(int handle, double newPriority) {
+    if (!contains(handle)) return false;
+    
+    int index = positions[handle];
+    double oldPriority = heapArray[index].priority;
+    heapArray[index].priority = newPriority;
+    if (newPriority > oldPriority) {
+        siftUp(index);
+    } else if (newPriority < oldPriority) {
+        siftDown(index);
+    }
+    return true;
+}
+
+bool IndexedMaxHeap::adjustPriority(int handle, double delta) {
+    if (!contains(handle)) return false;
+    return updatePriority(handle, heapArray[positions[handle]].priority + delta);
+}
+
+bool IndexedMaxHeap::remove(int handle) {
+    if (!contains(handle)) return false;
+    
+    int index = positions[handle];
+    int last = heapSize - 1;
+    if (index != last) {
+        swapNodes(index, last);
+    }
+    positions[handle] = -1;
+    heapSize--;
+    
+    if (index < heapSize) {
+        // The moved element may need to go either way
+        siftUp(index);
+        siftDown(index);
+    }
+    return true;
+}
+
+IndexedHeapNode IndexedMaxHeap::peekMax() const {
+    if (heapSize == 0) {
+        return IndexedHeapNode(); // Return empty node
+    }
+    return heapArray[0];
+}
+
+IndexedHeapNode IndexedMaxHeap::extractMax() {
+    if (heapSize == 0) {
+        return IndexedHeapNode(); // Return empty node
+    }
+    
+    IndexedHeapNode maxNode = heapArray[0];
+    remove(maxNode.handle);
+    return maxNode;
+}
+
+int IndexedMaxHeap::topK(int k, IndexedHeapNode* result) const {
+    if (k <= 0 || result == nullptr || heapSize == 0) return 0;
+    if (k > heapSize) k = heapSize;
+    
+    // Frontier of heap indices, itself kept as a small max-heap on priority.
+    // Each extracted index contributes its two children, so it never exceeds k + 1 entries.
+    int* frontier = new int[k + 1];
+    int frontierSize = 0;
+    int count = 0;
+    
+    frontier[frontierSize++] = 0;
+    while (count < k && frontierSize > 0) {
+        int best = frontier[0];
+        result[count++] = heapArray[best];
+        
+        // Pop the frontier root
+        frontier[0] = frontier[--frontierSize];
+        int i = 0;
+        while (true) {
+            int largest = i;
+            int left = 2 * i + 1;
+            int right = 2 * i + 2;
+            if (left < frontierSize && heapArray[frontier[left]].priority > heapArray[frontier[largest]].priority) largest = left;
+            if (right < frontierSize && heapArray[frontier[right]].priority > heapArray[frontier[largest]].priority) largest = right;
+            if (largest == i) break;
+            int temp = frontier[i];
+            frontier[i] = frontier[largest];
+            frontier[largest] = temp;
+            i = largest;
+        }
+        
+        // Push the children of the extracted index
+        for (int child = 2 * best + 1; child <= 2 * best + 2; child++) {
+            if (child >= heapSize || frontierSize >= k + 1) continue;
+            int j = frontierSize++;
+            frontier[j] = child;
+            while (j > 0 && heapArray[frontier[j]].priority > heapArray[frontier[(j - 1) / 2]].priority) {
+                int temp = frontier[j];
+                frontier[j] = frontier[(j - 1) / 2];
+                frontier[(j - 1) / 2] = temp;
+                j = (j - 1) / 2;
+            }
+        }
+    }
+    
+    delete[] frontier;
+    return count;
+}
+
+bool IndexedMaxHeap::contains(int handle) const {
+    return handle >= 0 && handle < handleCapacity && positions[handle] != -1;
+}
+
+double IndexedMaxHeap::getPriority(int handle) const {
+    if (!contains(handle)) return 0.0;
+    return heapArray[positions[handle]].priority;
+}
+
+bool IndexedMaxHeap::isEmpty() const {
+    return heapSize == 0;
+}
+
+int IndexedMaxHeap::getSize() const {
+    return heapSize;
+}
+
+void IndexedMaxHeap::clear() {
+    for (int i = 0; i < heapSize; i++) {
+        positions[heapArray[i].handle] = -1;
+    }
+    heapSize = 0;
+}
@@ -0,0 +1,110 @@
+#ifndef INDEXEDMAXHEAP_H
+#define INDEXEDMAXHEAP_H
+
+#include <string>
+using namespace std;
+
+// Structure for an element in the indexed max-heap
+struct IndexedHeapNode {
+    int handle;               // Caller-chosen handle (e.g., hospital slot), 0 <= handle < handle capacity
+    double priority;          // Priority value (larger = closer to the top)
+    void* data;               // Pointer to additional data
+    
+    IndexedHeapNode();
+};
+
+// IndexedMaxHeap class implementing an addressable binary max-heap
+// Every element is keyed by an integer handle and the heap keeps a
+// handle → position table, so priorities can be raised or lowered in place
+// Used for: Live hospital emergency bed availability
+class IndexedMaxHeap {
+private:
+    IndexedHeapNode* heapArray;   // Array to store heap elements
+    int* positions;               // handle → index in heapArray (-1 if not in heap)
+    int capacity;                 // Allocated size of heapArray
+    int handleCapacity;           // Allocated size of positions (handles must be below this)
+    int heapSize;                 // Current number of elements in the heap
+    
+    // Helper function to swap two elements and their positions
+    // Complexity: O(1)
+    void swapNodes(int index1, int index2);
+    
+    // Move an element up while it is larger than its parent
+    // Complexity: O(log n)
+    void siftUp(int index);
+    
+    // Move an element down while a child is larger
+    // Complexity: O(log n)
+    void siftDown(int index);
+    
+    // Grow the handle table to hold handle
+    // Complexity: O(h) where h is handle capacity
+    void ensureHandleCapacity(int handle);
+
+public:
+    // Constructor
+    // Complexity: O(h) where h is the initial handle capacity
+    IndexedMaxHeap(int cap = 100);
+    
+    // Destructor
+    // Complexity: O(1)
+    ~IndexedMaxHeap();
+    
+    // Insert an element
+    // Returns: false if handle is negative or already in the heap
+    // Complexity: O(log n)
+    bool insert(int handle, double priority, void* data = nullptr);
+    
+    // Set an element's priority (increase or decrease)
+    // Returns: false if handle is not in the heap
+    // Complexity: O(log n)
+    bool updatePriority(int handle, double newPriority);
+    
+    // Add delta to an element's priority
+    // Returns: false if handle is not in the heap
+    // Complexity: O(log n)
+    bool adjustPriority(int handle, double delta);
+    
+    // Remove an element
+    // Returns: false if handle is not in the heap
+    // Complexity: O(log n)
+    bool remove(int handle);
+    
+    // Peek at the maximum element without removing it
+    // Returns: empty node (handle -1) if the heap is empty
+    // Complexity: O(1)
+    IndexedHeapNode peekMax() const;
+    
+    // Extract the maximum element
+    // Returns: empty node (handle -1) if the heap is empty
+    // Complexity: O(log n)
+    IndexedHeapNode extractMax();
+    
+    // Get the k largest elements in descending order without modifying the heap
+    // Parameters: k, result array (output, at least k elements)
+    // Returns: number of elements written
+    // Complexity: O(k log k) - best-first walk of the heap tree
+    int topK(int k, IndexedHeapNode* result) const;
+    
+    // Check if a handle is in the heap
+    // Complexity: O(1)
+    bool contains(int handle) const;
+    
+    // Get an element's priority (0.0 if not in the heap)
+    // Complexity: O(1)
+    double getPriority(int handle) const;
+    
+    // Check if the heap is empty
+    // Complexity: O(1)
+    bool isEmpty() const;
+    
+    // Get the current size of the heap
+    // Complexity: O(1)
+    int getSize() const;
+    
+    // Clear all elements from the heap
+    // Complexity: O(n)
+    void clear();
+};
+
+#endif // INDEXEDMAXHEAP_H
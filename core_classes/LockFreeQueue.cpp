@@ -0,0 +1,200 @@
+#include "LockFreeQueue.h"
+#include <thread>
+using namespace std;
+
+// LockFreeCell Implementation
+LockFreeCell::LockFreeCell() : sequence(0), node() {
+}
+
+// LockFreeQueue Implementation
+LockFreeQueue::LockFreeQueue(int cap) {
+    capacity = roundUpToPowerOfTwo(cap < 2 ? 2 : cap);
+    bufferMask = (size_t)capacity - 1;
+    buffer = new LockFreeCell[capacity];
+
+    // Slot i is free for position i on the first lap
+    for (int i = 0; i < capacity; i++) {
+        buffer[i].sequence.store((size_t)i, memory_order_relaxed);
+    }
+    enqueuePos.store(0, memory_order_relaxed);
+    dequeuePos.store(0, memory_order_relaxed);
+}
+
+LockFreeQueue::~LockFreeQueue() {
+    delete[] buffer;
+    buffer = nullptr;
+}
+
+int LockFreeQueue::roundUpToPowerOfTwo(int value) {
+    int result = 1;
+    while (result < value) {
+        result *= 2;
+    }
+    return result;
+}
+
+int LockFreeQueue::claimEnqueueSlots(int maxCount, size_t& firstPos) {
+    if (maxCount <= 0) return 0;
+    if (maxCount > capacity) maxCount = capacity;
+
+    size_t pos = enqueuePos.load(memory_order_relaxed);
+    while (true) {
+        // Find the longest run starting at pos whose last slot is already free.
+        // Slots are released in position order, so the earlier ones in the run
+        // are either free or about to be freed by a consumer that claimed them.
+        int want = maxCount;
+        bool stale = false;
+        while (want > 0) {
+            size_t lastPos = pos + want - 1;
+            size_t seq = buffer[lastPos & bufferMask].sequence.load(memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)lastPos;
+            if (diff == 0) break;                 // Slot free for this lap
+            if (diff > 0) { stale = true; break; } // Another producer got there first
+            want /= 2;                            // Slot still occupied, try a shorter run
+        }
+
+        if (stale) {
+            pos = enqueuePos.load(memory_order_relaxed);
+            continue;
+        }
+        if (want == 0) return 0; // Queue is full
+
+        if (enqueuePos.compare_exchange_weak(pos, pos + want, memory_order_relaxed)) {
+            firstPos = pos;
+            return want;
+        }
+        // CAS failed: pos now holds the current enqueue position, retry
+    }
+}
+
+int LockFreeQueue::claimDequeueSlots(int maxCount, size_t& firstPos) {
+    if (maxCount <= 0) return 0;
+    if (maxCount > capacity) maxCount = capacity;
+
+    size_t pos = dequeuePos.load(memory_order_relaxed);
+    while (true) {
+        // Find the longest run starting at pos whose last slot is already published
+        int want = maxCount;
+        bool stale = false;
+        while (want > 0) {
+            size_t lastPos = pos + want - 1;
+            size_t seq = buffer[lastPos & bufferMask].sequence.load(memory_order_acquire);
+            ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)(lastPos + 1);
+            if (diff == 0) break;                 // Slot holds data for this lap
+            if (diff > 0) { stale = true; break; } // Another consumer got there first
+            want /= 2;                            // Slot not written yet, try a shorter run
+        }
+
+        if (stale) {
+            pos = dequeuePos.load(memory_order_relaxed);
+            continue;
+        }
+        if (want == 0) return 0; // Queue is empty
+
+        if (dequeuePos.compare_exchange_weak(pos, pos + want, memory_order_relaxed)) {
+            firstPos = pos;
+            return want;
+        }
+        // CAS failed: pos now holds the current dequeue position, retry
+    }
+}
+
+bool LockFreeQueue::enqueue(const string& data, void* addData) {
+    return enqueueBatch(&data, 1, addData != nullptr ? &addData : nullptr) == 1;
+}
+
+bool LockFreeQueue::dequeue(QueueNode& item) {
+    return dequeueBatch(&item, 1) == 1;
+}
+
+QueueNode LockFreeQueue::dequeue() {
+    QueueNode item;
+    if (!dequeue(item)) {
+        return QueueNode(); // Return empty node
+    }
+    return item;
+}
+
+int LockFreeQueue::enqueueBatch(const string* items, int count, void** addData) {
+    if (items == nullptr || count <= 0) return 0;
+
+    int done = 0;
+    while (done < count) {
+        size_t pos = 0;
+        int claimed = claimEnqueueSlots(count - done, pos);
+        if (claimed == 0) break; // Queue is full
+
+        for (int i = 0; i < claimed; i++) {
+            size_t slotPos = pos + i;
+            LockFreeCell& cell = buffer[slotPos & bufferMask];
+
+            // Wait for a consumer that claimed the previous lap of this slot to finish reading
+            while (cell.sequence.load(memory_order_acquire) != slotPos) {
+                this_thread::yield();
+            }
+
+            cell.node.data = items[done + i];
+            cell.node.additionalData = (addData != nullptr) ? addData[done + i] : nullptr;
+            cell.sequence.store(slotPos + 1, memory_order_release);
+        }
+        done += claimed;
+    }
+
+    return done;
+}
+
+int LockFreeQueue::dequeueBatch(QueueNode* items, int maxCount) {
+    if (items == nullptr || maxCount <= 0) return 0;
+
+    size_t pos = 0;
+    int claimed = claimDequeueSlots(maxCount, pos);
+
+    for (int i = 0; i < claimed; i++) {
+        size_t slotPos = pos + i;
+        LockFreeCell& cell = buffer[slotPos & bufferMask];
+
+        // Wait for the producer that claimed this slot to finish writing
+        while (cell.sequence.load(memory_order_acquire) != slotPos + 1) {
+            this_thread::yield();
+        }
+
+        items[i].data = move(cell.node.data);
+        items[i].additionalData = cell.node.additionalData;
+        cell.node.data.clear();
+        cell.node.additionalData = nullptr;
+
+        // Mark the slot free for the next lap
+        cell.sequence.store(slotPos + bufferMask + 1, memory_order_release);
+    }
+
+    return claimed;
+}
+
+bool LockFreeQueue::isEmpty() const {
+    return getSize() == 0;
+}
+
+bool LockFreeQueue::isFull() const {
+    return getSize() >= capacity;
+}
+
+int LockFreeQueue::getSize() const {
+    size_t head = dequeuePos.load(memory_order_acquire);
+    size_t tail = enqueuePos.load(memory_order_acquire);
+    if (tail <= head) return 0;
+
+    size_t size = tail - head;
+    if (size > (size_t)capacity) return capacity;
+    return (int)size;
+}
+
+int LockFreeQueue::getCapacity() const {
+    return capacity;
+}
+
+void LockFreeQueue::clear() {
+    QueueNode drained[32];
+    while (dequeueBatch(drained, 32) > 0) {
+        // Keep draining until the queue reports empty
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef LOCKFREEQUEUE_H
+#define LOCKFREEQUEUE_H
+
+#include <string>
+#include <atomic>
+#include <cstddef>
+#include "CircularQueue.h"
+using namespace std;
+
+// Assumed size of a CPU cache line (used to keep head and tail counters apart)
+const int CACHE_LINE_SIZE = 64;
+
+// Structure for a slot in the lock-free queue
+// The sequence number tells producers and consumers whether the slot is
+// free for the current lap (seq == pos) or holds data for it (seq == pos + 1)
+struct LockFreeCell {
+    atomic<size_t> sequence;  // Sequence number guarding this slot
+    QueueNode node;           // Element stored in the slot
+
+    LockFreeCell();
+};
+
+// LockFreeQueue class implementing a bounded multi-producer/multi-consumer
+// ring buffer (Vyukov sequence-number algorithm)
+// Used for: Passenger boarding events fed by several gate-reader threads
+// All public operations may be called concurrently from any number of threads.
+class LockFreeQueue {
+private:
+    LockFreeCell* buffer;     // Array of slots (size is a power of two)
+    size_t bufferMask;        // capacity - 1, used instead of modulo
+    int capacity;             // Maximum capacity of the queue
+
+    // Producer and consumer counters live on separate cache lines so that
+    // enqueuing threads do not invalidate the line dequeuing threads spin on
+    alignas(CACHE_LINE_SIZE) atomic<size_t> enqueuePos;   // Next position to write
+    alignas(CACHE_LINE_SIZE) atomic<size_t> dequeuePos;   // Next position to read
+
+    // Round a requested capacity up to the next power of two
+    // Complexity: O(log n)
+    static int roundUpToPowerOfTwo(int value);
+
+    // Claim up to maxCount consecutive slots for writing
+    // Returns: number of slots claimed (0 if the queue is full), firstPos (output)
+    // Complexity: O(log k) attempts per CAS round
+    int claimEnqueueSlots(int maxCount, size_t& firstPos);
+
+    // Claim up to maxCount consecutive slots for reading
+    // Returns: number of slots claimed (0 if the queue is empty), firstPos (output)
+    // Complexity: O(log k) attempts per CAS round
+    int claimDequeueSlots(int maxCount, size_t& firstPos);
+
+public:
+    // Constructor: Initializes queue with given capacity (rounded up to a power of two)
+    // Complexity: O(n) where n is capacity
+    LockFreeQueue(int cap = 128);
+
+    // Destructor: Deallocates memory
+    // Complexity: O(n) where n is capacity
+    ~LockFreeQueue();
+
+    // Enqueue (add) an element at the rear
+    // Returns: false if the queue is full
+    // Complexity: O(1) (lock-free, retries only under contention)
+    bool enqueue(const string& data, void* addData = nullptr);
+
+    // Dequeue (remove) an element from the front
+    // Returns: false if the queue is empty, item (output) otherwise holds the element
+    // Complexity: O(1) (lock-free, retries only under contention)
+    bool dequeue(QueueNode& item);
+
+    // Dequeue (remove) an element from the front
+    // Returns: empty QueueNode if the queue is empty (same contract as CircularQueue)
+    // Complexity: O(1)
+    QueueNode dequeue();
+
+    // Enqueue several elements with a single reservation of consecutive slots
+    // Parameters: items array, count, addData array (optional, may be nullptr)
+    // Returns: number of elements actually enqueued (less than count if the queue fills up)
+    // Complexity: O(k) where k is count
+    int enqueueBatch(const string* items, int count, void** addData = nullptr);
+
+    // Dequeue up to maxCount elements with a single reservation of consecutive slots
+    // Parameters: items array (output), maxCount
+    // Returns: number of elements actually dequeued
+    // Complexity: O(k) where k is number dequeued
+    int dequeueBatch(QueueNode* items, int maxCount);
+
+    // Check if the queue is empty (a snapshot, may be stale under concurrency)
+    // Complexity: O(1)
+    bool isEmpty() const;
+
+    // Check if the queue is full (a snapshot, may be stale under concurrency)
+    // Complexity: O(1)
+    bool isFull() const;
+
+    // Get the current size of the queue (a snapshot, may be stale under concurrency)
+    // Complexity: O(1)
+    int getSize() const;
+
+    // Get the capacity of the queue
+    // Complexity: O(1)
+    int getCapacity() const;
+
+    // Remove all elements currently in the queue
+    // Complexity: O(n) where n is queue size
+    void clear();
+};
+
+#endif // LOCKFREEQUEUE_H
@@ -0,0 +1,285 @@
+#include "PrefixTrie.h"
+using namespace std;
+
+// TrieNode Implementation
+TrieNode::TrieNode() : ch('\0'), firstChild(-1), nextSibling(-1), postingHead(-1) {
+}
+
+// PrefixTrie Implementation
+PrefixTrie::PrefixTrie(int initialNodes) : nodeCount(1), postingCount(0), itemCount(0), currentStamp(0) {
+    nodeCapacity = (initialNodes > 1) ? initialNodes : 2;
+    nodes = new TrieNode[nodeCapacity]; // nodes[0] is the root
+    
+    postingCapacity = 16;
+    postingItems = new int[postingCapacity];
+    postingNext = new int[postingCapacity];
+    
+    itemCapacity = 16;
+    items = new void*[itemCapacity];
+    itemStamps = new int[itemCapacity];
+}
+
+PrefixTrie::~PrefixTrie() {
+    delete[] nodes;
+    delete[] postingItems;
+    delete[] postingNext;
+    delete[] items;
+    delete[] itemStamps;
+    nodes = nullptr;
+    postingItems = nullptr;
+    postingNext = nullptr;
+    items = nullptr;
+    itemStamps = nullptr;
+}
+
+string PrefixTrie::normalizeText(const string& text) {
+    string result = "";
+    bool pendingSpace = false;
+    for (int i = 0; i < (int)text.length(); i++) {
+        char c = text[i];
+        if (c >= 'A' && c <= 'Z') {
+            c = (char)(c - 'A' + 'a');
+        }
+        if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) {
+            if (pendingSpace && !result.empty()) {
+                result += ' ';
+            }
+            pendingSpace = false;
+            result += c;
+        } else {
+            // Spaces and punctuation separate words
+            pendingSpace = true;
+        }
+    }
+    return result;
+}
+
+int PrefixTrie::findChild(int node, char ch, bool create) {
+    for (int child = nodes[node].firstChild; child != -1; child = nodes[child].nextSibling) {
+        if (nodes[child].ch == ch) {
+            return child;
+        }
+    }
+    if (!create) {
+        return -1;
+    }
+    
+    if (nodeCount >= nodeCapacity) {
+        int newCapacity = nodeCapacity * 2;
+        TrieNode* newNodes = new TrieNode[newCapacity];
+        for (int i = 0; i < nodeCount; i++) {
+            newNodes[i] = nodes[i];
+        }
+        delete[] nodes;
+        nodes = newNodes;
+        nodeCapacity = newCapacity;
+    }
+    
+    int child = nodeCount++;
+    nodes[child] = TrieNode();
+    nodes[child].ch = ch;
+    nodes[child].nextSibling = nodes[node].firstChild;
+    nodes[node].firstChild = child;
+    return child;
+}
+
+void PrefixTrie::insertSuffix(const string& text, int start, int item) {
+    int node = 0;
+    for (int i = start; i < (int)text.length(); i++) {
+        node = findChild(node, text[i], true);
+    }
+    
+    if (postingCount >= postingCapacity) {
+        int newCapacity = postingCapacity * 2;
+        int* newItems = new int[newCapacity];
+        int* newNext = new int[newCapacity];
+        for (int i = 0; i < postingCount; i++) {
+            newItems[i] = postingItems[i];
+            newNext[i] = postingNext[i];
+        }
+        delete[] postingItems;
+        delete[] postingNext;
+        postingItems = newItems;
+        postingNext = newNext;
+        postingCapacity = newCapacity;
+    }
+    
+    int posting = postingCount++;
+    postingItems[posting] = item;
+    postingNext[posting] = nodes[node].postingHead;
+    nodes[node].postingHead = posting;
+}
+
+bool PrefixTrie::insert(const string& text, void* data) {
+    string normalized = normalizeText(text);
+    if (normalized.empty()) {
+        return false;
+    }
+    
+    if (itemCount >= itemCapacity) {
+        int newCapacity = itemCapacity * 2;
+        void** newItems = new void*[newCapacity];
+        int* newStamps = new int[newCapacity];
+        for (int i = 0; i < itemCount; i++) {
+            newItems[i] = items[i];
+            newStamps[i] = itemStamps[i];
+        }
+        delete[] items;
+        delete[] itemStamps;
+        items = newItems;
+        itemStamps = newStamps;
+        itemCapacity = newCapacity;
+    }
+    
+    int item = itemCount++;
+    items[item] = data;
+    itemStamps[item] = 0;
+    
+    // Index from every word start
+    for (int i = 0; i < (int)normalized.length(); i++) {
+        if (i == 0 || normalized[i - 1] == ' ') {
+            insertSuffix(normalized, i, item);
+        }
+    }
+    return true;
+}
+
+void PrefixTrie::beginQuery() {
+    currentStamp++;
+    if (currentStamp <= 0) {
+        // Stamp wrapped around: reset every item
+        for (int i = 0; i < itemCount; i++) {
+            itemStamps[i] = 0;
+        }
+        currentStamp = 1;
+    }
+}
+
+void PrefixTrie::collectSubtree(int node, void** results, int& count) {
+    int stackCapacity = 16;
+    int* stack = new int[stackCapacity];
+    int stackSize = 0;
+    stack[stackSize++] = node;
+    
+    while (stackSize > 0) {
+        int current = stack[--stackSize];
+        for (int posting = nodes[current].postingHead; posting != -1; posting = postingNext[posting]) {
+            int item = postingItems[posting];
+            if (itemStamps[item] != currentStamp) {
+                itemStamps[item] = currentStamp;
+                results[count++] = items[item];
+            }
+        }
+        
+        for (int child = nodes[current].firstChild; child != -1; child = nodes[child].nextSibling) {
+            if (stackSize >= stackCapacity) {
+                int newCapacity = stackCapacity * 2;
+                int* newStack = new int[newCapacity];
+                for (int i = 0; i < stackSize; i++) {
+                    newStack[i] = stack[i];
+                }
+                delete[] stack;
+                stack = newStack;
+                stackCapacity = newCapacity;
+            }
+            stack[stackSize++] = child;
+        }
+    }
+    
+    delete[] stack;
+}
+
+void** PrefixTrie::findPrefix(const string& prefix, int& count) {
+    count = 0;
+    string normalized = normalizeText(prefix);
+    if (normalized.empty() || itemCount == 0) {
+        return nullptr;
+    }
+    
+    int node = 0;
+    for (int i = 0; i < (int)normalized.length() && node != -1; i++) {
+        node = findChild(node, normalized[i], false);
+    }
+    if (node == -1) {
+        return nullptr;
+    }
+    
+    beginQuery();
+    void** results = new void*[itemCount];
+    collectSubtree(node, results, count);
+    if (count == 0) {
+        delete[] results;
+        return nullptr;
+    }
+    return results;
+}
+
+void PrefixTrie::fuzzyVisit(int node, const string& query, const int* row, int maxEdits,
+                            void** results, int& count) {
+    int columns = (int)query.length() + 1;
+    int* nextRow = new int[columns];
+    
+    for (int child = nodes[node].firstChild; child != -1; child = nodes[child].nextSibling) {
+        char c = nodes[child].ch;
+        
+        // Levenshtein row for the path extended by c
+        nextRow[0] = row[0] + 1;
+        int rowMin = nextRow[0];
+        for (int j = 1; j < columns; j++) {
+            int best = row[j] + 1;                                   // Extra character in the text
+            if (nextRow[j - 1] + 1 < best) best = nextRow[j - 1] + 1; // Missing character in the text
+            int substitute = row[j - 1] + ((query[j - 1] == c) ? 0 : 1);
+            if (substitute < best) best = substitute;
+            nextRow[j] = best;
+            if (best < rowMin) rowMin = best;
+        }
+        
+        if (nextRow[columns - 1] <= maxEdits) {
+            // Whole query matched: everything below is a hit
+            collectSubtree(child, results, count);
+        } else if (rowMin <= maxEdits) {
+            fuzzyVisit(child, query, nextRow, maxEdits, results, count);
+        }
+    }
+    
+    delete[] nextRow;
+}
+
+void** PrefixTrie::findFuzzy(const string& query, int maxEdits, int& count) {
+    count = 0;
+    string normalized = normalizeText(query);
+    if (normalized.empty() || itemCount == 0 || maxEdits < 0) {
+        return nullptr;
+    }
+    if (maxEdits >= (int)normalized.length()) {
+        maxEdits = (int)normalized.length() - 1;
+    }
+    
+    int columns = (int)normalized.length() + 1;
+    int* row = new int[columns];
+    for (int j = 0; j < columns; j++) {
+        row[j] = j;
+    }
+    
+    beginQuery();
+    void** results = new void*[itemCount];
+    fuzzyVisit(0, normalized, row, maxEdits, results, count);
+    delete[] row;
+    
+    if (count == 0) {
+        delete[] results;
+        return nullptr;
+    }
+    return results;
+}
+
+int PrefixTrie::getItemCount() const {
+    return itemCount;
+}
+
+void PrefixTrie::clear() {
+    nodes[0] = TrieNode();
+    nodeCount = 1;
+    postingCount = 0;
+    itemCount = 0;
+}
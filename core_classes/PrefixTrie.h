@@ -0,0 +1,97 @@
+#ifndef PREFIXTRIE_H
+#define PREFIXTRIE_H
+
+#include <string>
+using namespace std;
+
+// Structure for one trie node, stored in a flat pool and linked by index
+struct TrieNode {
+    char ch;                  // Character on the edge from the parent
+    int firstChild;           // Pool index of the first child (-1 if none)
+    int nextSibling;          // Pool index of the next sibling (-1 if none)
+    int postingHead;          // First posting of items whose word ends here (-1 if none)
+    
+    TrieNode();
+};
+
+// PrefixTrie class - Word-prefix and typo-tolerant text search over items
+// Used for: Product name search across all malls
+// Text is normalized (lower case, letters and digits, single spaces) and indexed from
+// every word start, so "led" finds "Samsung LED TV". Several items may share a text.
+// Nodes and postings live in index-linked arrays rather than separate allocations.
+class PrefixTrie {
+private:
+    TrieNode* nodes;          // Node pool (node 0 is the root)
+    int nodeCount;
+    int nodeCapacity;
+    
+    int* postingItems;        // Posting pool: item index
+    int* postingNext;         // Posting pool: next posting at the same node (-1 ends the list)
+    int postingCount;
+    int postingCapacity;
+    
+    void** items;             // Item payloads by item index (not owned)
+    int* itemStamps;          // Per-item stamp to de-duplicate results during a query
+    int itemCount;
+    int itemCapacity;
+    int currentStamp;
+    
+    // Normalize text for indexing and queries
+    static string normalizeText(const string& text);
+    
+    // Get the child of a node along ch, optionally creating it
+    // Returns: pool index, -1 if missing and create is false
+    // Complexity: O(a) where a is the number of children (alphabet size at most 37)
+    int findChild(int node, char ch, bool create);
+    
+    // Index one normalized suffix for an item
+    void insertSuffix(const string& text, int start, int item);
+    
+    // Add every item in the subtree of node to results (skipping items already stamped)
+    // Complexity: O(s) where s is number of nodes and postings in the subtree
+    void collectSubtree(int node, void** results, int& count);
+    
+    // Start a new query (advance the de-duplication stamp)
+    void beginQuery();
+    
+    // Visit the children of node with the edit-distance row of its path (recursive)
+    // Collects a child's subtree once the whole query matches within maxEdits
+    void fuzzyVisit(int node, const string& query, const int* row, int maxEdits,
+                    void** results, int& count);
+
+public:
+    // Constructor
+    // Complexity: O(n) for the initial node pool
+    PrefixTrie(int initialNodes = 64);
+    
+    // Destructor
+    // Complexity: O(1)
+    ~PrefixTrie();
+    
+    // Index an item under a text (e.g., a product name)
+    // Returns: false if the text has no letters or digits
+    // Complexity: O(w × L) where w is number of words and L is text length
+    bool insert(const string& text, void* data);
+    
+    // Find items with a word (or run of words) starting with prefix
+    // Returns: Array of item payloads, each at most once (caller must delete[]), nullptr if none
+    // Complexity: O(L + s) where L is prefix length and s is size of the matching subtree
+    void** findPrefix(const string& prefix, int& count);
+    
+    // Find items with a word prefix within maxEdits edits (insert/delete/substitute) of query
+    // Returns: Array of item payloads, each at most once (caller must delete[]), nullptr if none
+    // Note: maxEdits is capped below the query length so a query never matches everything
+    // Complexity: O(V × L) worst case for V visited nodes; branches are pruned once every
+    //             cell of the edit-distance row exceeds maxEdits
+    void** findFuzzy(const string& query, int maxEdits, int& count);
+    
+    // Get number of indexed items
+    // Complexity: O(1)
+    int getItemCount() const;
+    
+    // Remove every item
+    // Complexity: O(1)
+    void clear();
+};
+
+#endif // PREFIXTRIE_H
@@ -0,0 +1,469 @@
+#include "QueryTable.h"
+using namespace std;
+
+// Helper: case-insensitive string comparison for column names
+static bool sameName(const string& a, const string& b) {
+    if (a.length() != b.length()) return false;
+    for (int i = 0; i < (int)a.length(); i++) {
+        char x = a[i];
+        char y = b[i];
+        if (x >= 'A' && x <= 'Z') x = x - 'A' + 'a';
+        if (y >= 'A' && y <= 'Z') y = y - 'A' + 'a';
+        if (x != y) return false;
+    }
+    return true;
+}
+
+// QueryTable Implementation
+QueryTable::QueryTable(const string& name, int initialRows) : tableName(name), columnCount(0),
+                                                              columnCapacity(8), rowCount(0) {
+    rowCapacity = (initialRows > 0) ? initialRows : 64;
+    columnNames = new string[columnCapacity];
+    numberColumns = new bool[columnCapacity];
+    codes = new int*[columnCapacity];
+    numbers = new double*[columnCapacity];
+    dictionaries = new StringDictionary*[columnCapacity];
+}
+
+QueryTable::~QueryTable() {
+    for (int c = 0; c < columnCount; c++) {
+        delete[] codes[c];
+        delete[] numbers[c];
+        delete dictionaries[c];
+    }
+    delete[] columnNames;
+    delete[] numberColumns;
+    delete[] codes;
+    delete[] numbers;
+    delete[] dictionaries;
+}
+
+int QueryTable::addColumn(const string& name, bool isNumber) {
+    if (name.empty() || rowCount > 0 || findColumn(name) != -1) return -1;
+    
+    if (columnCount >= columnCapacity) {
+        int newCapacity = columnCapacity * 2;
+        string* newNames = new string[newCapacity];
+        bool* newNumberColumns = new bool[newCapacity];
+        int** newCodes = new int*[newCapacity];
+        double** newNumbers = new double*[newCapacity];
+        StringDictionary** newDictionaries = new StringDictionary*[newCapacity];
+        for (int c = 0; c < columnCount; c++) {
+            newNames[c].swap(columnNames[c]);
+            newNumberColumns[c] = numberColumns[c];
+            newCodes[c] = codes[c];
+            newNumbers[c] = numbers[c];
+            newDictionaries[c] = dictionaries[c];
+        }
+        delete[] columnNames;
+        delete[] numberColumns;
+        delete[] codes;
+        delete[] numbers;
+        delete[] dictionaries;
+        columnNames = newNames;
+        numberColumns = newNumberColumns;
+        codes = newCodes;
+        numbers = newNumbers;
+        dictionaries = newDictionaries;
+        columnCapacity = newCapacity;
+    }
+    
+    int column = columnCount++;
+    columnNames[column] = name;
+    numberColumns[column] = isNumber;
+    if (isNumber) {
+        codes[column] = nullptr;
+        numbers[column] = new double[rowCapacity];
+        dictionaries[column] = nullptr;
+    } else {
+        codes[column] = new int[rowCapacity];
+        numbers[column] = nullptr;
+        dictionaries[column] = new StringDictionary();
+    }
+    return column;
+}
+
+int QueryTable::addCategoryColumn(const string& name) {
+    return addColumn(name, false);
+}
+
+int QueryTable::addNumberColumn(const string& name) {
+    return addColumn(name, true);
+}
+
+int QueryTable::addRow() {
+    if (rowCount >= rowCapacity) {
+        int newCapacity = rowCapacity * 2;
+        for (int c = 0; c < columnCount; c++) {
+            if (numberColumns[c]) {
+                double* column = new double[newCapacity];
+                for (int r = 0; r < rowCount; r++) {
+                    column[r] = numbers[c][r];
+                }
+                delete[] numbers[c];
+                numbers[c] = column;
+            } else {
+                int* column = new int[newCapacity];
+                for (int r = 0; r < rowCount; r++) {
+                    column[r] = codes[c][r];
+                }
+                delete[] codes[c];
+                codes[c] = column;
+            }
+        }
+        rowCapacity = newCapacity;
+    }
+    
+    int row = rowCount++;
+    for (int c = 0; c < columnCount; c++) {
+        if (numberColumns[c]) {
+            numbers[c][row] = 0.0;
+        } else {
+            codes[c][row] = -1;
+        }
+    }
+    return row;
+}
+
+bool QueryTable::setCategory(int row, int column, const string& value) {
+    if (row < 0 || row >= rowCount || column < 0 || column >= columnCount || numberColumns[column]) {
+        return false;
+    }
+    codes[column][row] = dictionaries[column]->encode(value);
+    return true;
+}
+
+bool QueryTable::setNumber(int row, int column, double value) {
+    if (row < 0 || row >= rowCount || column < 0 || column >= columnCount || !numberColumns[column]) {
+        return false;
+    }
+    numbers[column][row] = value;
+    return true;
+}
+
+int QueryTable::findColumn(const string& name) const {
+    for (int c = 0; c < columnCount; c++) {
+        if (sameName(columnNames[c], name)) return c;
+    }
+    return -1;
+}
+
+string QueryTable::getName() const {
+    return tableName;
+}
+
+int QueryTable::getColumnCount() const {
+    return columnCount;
+}
+
+int QueryTable::getRowCount() const {
+    return rowCount;
+}
+
+string QueryTable::getColumnName(int column) const {
+    if (column < 0 || column >= columnCount) return "";
+    return columnNames[column];
+}
+
+bool QueryTable::isNumberColumn(int column) const {
+    if (column < 0 || column >= columnCount) return false;
+    return numberColumns[column];
+}
+
+string QueryTable::getCategory(int row, int column) const {
+    if (row < 0 || row >= rowCount || column < 0 || column >= columnCount || numberColumns[column]) {
+        return "";
+    }
+    return dictionaries[column]->decode(codes[column][row]);
+}
+
+double QueryTable::getNumber(int row, int column) const {
+    if (row < 0 || row >= rowCount || column < 0 || column >= columnCount || !numberColumns[column]) {
+        return 0.0;
+    }
+    return numbers[column][row];
+}
+
+// QueryGroups Implementation
+QueryGroups::QueryGroups(int capacity) : groupCount(0) {
+    if (capacity < 1) capacity = 1;
+    labels = new string[capacity];
+    counts = new int[capacity];
+    sums = new double[capacity];
+    minimums = new double[capacity];
+    maximums = new double[capacity];
+}
+
+QueryGroups::~QueryGroups() {
+    delete[] labels;
+    delete[] counts;
+    delete[] sums;
+    delete[] minimums;
+    delete[] maximums;
+}
+
+double QueryGroups::getAverage(int group) const {
+    if (group < 0 || group >= groupCount || counts[group] == 0) return 0.0;
+    return sums[group] / counts[group];
+}
+
+// TableQuery Implementation
+TableQuery::TableQuery(const QueryTable* t) : table(t), conditionCount(0), conditionCapacity(4),
+                                              matchesNothing(false) {
+    conditionColumns = new int[conditionCapacity];
+    conditionCodes = new int[conditionCapacity];
+    conditionLows = new double[conditionCapacity];
+    conditionHighs = new double[conditionCapacity];
+}
+
+TableQuery::~TableQuery() {
+    delete[] conditionColumns;
+    delete[] conditionCodes;
+    delete[] conditionLows;
+    delete[] conditionHighs;
+}
+
+void TableQuery::addCondition(int column, int code, double low, double high) {
+    if (conditionCount >= conditionCapacity) {
+        int newCapacity = conditionCapacity * 2;
+        int* newColumns = new int[newCapacity];
+        int* newCodes = new int[newCapacity];
+        double* newLows = new double[newCapacity];
+        double* newHighs = new double[newCapacity];
+        for (int i = 0; i < conditionCount; i++) {
+            newColumns[i] = conditionColumns[i];
+            newCodes[i] = conditionCodes[i];
+            newLows[i] = conditionLows[i];
+            newHighs[i] = conditionHighs[i];
+        }
+        delete[] conditionColumns;
+        delete[] conditionCodes;
+        delete[] conditionLows;
+        delete[] conditionHighs;
+        conditionColumns = newColumns;
+        conditionCodes = newCodes;
+        conditionLows = newLows;
+        conditionHighs = newHighs;
+        conditionCapacity = newCapacity;
+    }
+    conditionColumns[conditionCount] = column;
+    conditionCodes[conditionCount] = code;
+    conditionLows[conditionCount] = low;
+    conditionHighs[conditionCount] = high;
+    conditionCount++;
+}
+
+bool TableQuery::whereEquals(const string& column, const string& value) {
+    int c = table->findColumn(column);
+    if (c == -1 || table->numberColumns[c]) return false;
+    
+    int code = table->dictionaries[c]->find(value);
+    if (code == -1) {
+        matchesNothing = true;
+    }
+    addCondition(c, code, 0.0, 0.0);
+    return true;
+}
+
+bool TableQuery::whereBetween(const string& column, double low, double high) {
+    int c = table->findColumn(column);
+    if (c == -1 || !table->numberColumns[c]) return false;
+    
+    if (low > high) {
+        matchesNothing = true;
+    }
+    addCondition(c, -1, low, high);
+    return true;
+}
+
+// Each pass writes every row index and advances only on a match, so the loops are
+// free of data-dependent branches
+int TableQuery::selectBatch(int start, int end, int* selection) const {
+    int selected = 0;
+    if (conditionCount == 0) {
+        for (int r = start; r < end; r++) {
+            selection[selected++] = r;
+        }
+        return selected;
+    }
+    
+    for (int i = 0; i < conditionCount; i++) {
+        int c = conditionColumns[i];
+        if (!table->numberColumns[c]) {
+            const int* column = table->codes[c];
+            int code = conditionCodes[i];
+            if (i == 0) {
+                for (int r = start; r < end; r++) {
+                    selection[selected] = r;
+                    selected += (column[r] == code);
+                }
+            } else {
+                int kept = 0;
+                for (int j = 0; j < selected; j++) {
+                    int r = selection[j];
+                    selection[kept] = r;
+                    kept += (column[r] == code);
+                }
+                selected = kept;
+            }
+        } else {
+            const double* column = table->numbers[c];
+            double low = conditionLows[i];
+            double high = conditionHighs[i];
+            if (i == 0) {
+                for (int r = start; r < end; r++) {
+                    selection[selected] = r;
+                    selected += (column[r] >= low) & (column[r] <= high);
+                }
+            } else {
+                int kept = 0;
+                for (int j = 0; j < selected; j++) {
+                    int r = selection[j];
+                    selection[kept] = r;
+                    kept += (column[r] >= low) & (column[r] <= high);
+                }
+                selected = kept;
+            }
+        }
+        if (selected == 0) break;
+    }
+    return selected;
+}
+
+int TableQuery::count() const {
+    if (matchesNothing) return 0;
+    
+    int total = 0;
+    int selection[BATCH_SIZE];
+    for (int start = 0; start < table->rowCount; start += BATCH_SIZE) {
+        int end = (start + BATCH_SIZE < table->rowCount) ? start + BATCH_SIZE : table->rowCount;
+        total += selectBatch(start, end, selection);
+    }
+    return total;
+}
+
+bool TableQuery::aggregate(const string& numberColumn, int& count, double& sum,
+                           double& minimum, double& maximum) const {
+    count = 0;
+    sum = 0.0;
+    minimum = 0.0;
+    maximum = 0.0;
+    int c = table->findColumn(numberColumn);
+    if (c == -1 || !table->numberColumns[c]) return false;
+    if (matchesNothing) return true;
+    
+    const double* column = table->numbers[c];
+    int selection[BATCH_SIZE];
+    for (int start = 0; start < table->rowCount; start += BATCH_SIZE) {
+        int end = (start + BATCH_SIZE < table->rowCount) ? start + BATCH_SIZE : table->rowCount;
+        int selected = selectBatch(start, end, selection);
+        for (int j = 0; j < selected; j++) {
+            double value = column[selection[j]];
+            if (count == 0 || value < minimum) minimum = value;
+            if (count == 0 || value > maximum) maximum = value;
+            sum += value;
+            count++;
+        }
+    }
+    return true;
+}
+
+QueryGroups* TableQuery::groupBy(const string& groupColumn, const string& numberColumn) const {
+    int g = table->findColumn(groupColumn);
+    if (g == -1 || table->numberColumns[g]) return nullptr;
+    
+    const double* values = nullptr;
+    if (!numberColumn.empty()) {
+        int c = table->findColumn(numberColumn);
+        if (c == -1 || !table->numberColumns[c]) return nullptr;
+        values = table->numbers[c];
+    }
+    
+    // Accumulate per code, then keep only non-empty groups
+    const StringDictionary* dictionary = table->dictionaries[g];
+    int codeCount = dictionary->size();
+    QueryGroups* byCode = new QueryGroups(codeCount);
+    for (int i = 0; i < codeCount; i++) {
+        byCode->counts[i] = 0;
+        byCode->sums[i] = 0.0;
+        byCode->minimums[i] = 0.0;
+        byCode->maximums[i] = 0.0;
+    }
+    
+    if (!matchesNothing) {
+        const int* column = table->codes[g];
+        int selection[BATCH_SIZE];
+        for (int start = 0; start < table->rowCount; start += BATCH_SIZE) {
+            int end = (start + BATCH_SIZE < table->rowCount) ? start + BATCH_SIZE : table->rowCount;
+            int selected = selectBatch(start, end, selection);
+            for (int j = 0; j < selected; j++) {
+                int r = selection[j];
+                int code = column[r];
+                if (code < 0) continue;
+                if (values != nullptr) {
+                    double value = values[r];
+                    if (byCode->counts[code] == 0 || value < byCode->minimums[code]) byCode->minimums[code] = value;
+                    if (byCode->counts[code] == 0 || value > byCode->maximums[code]) byCode->maximums[code] = value;
+                    byCode->sums[code] += value;
+                }
+                byCode->counts[code]++;
+            }
+        }
+    }
+    
+    int nonEmpty = 0;
+    for (int i = 0; i < codeCount; i++) {
+        if (byCode->counts[i] > 0) nonEmpty++;
+    }
+    QueryGroups* groups = new QueryGroups(nonEmpty);
+    for (int i = 0; i < codeCount; i++) {
+        if (byCode->counts[i] == 0) continue;
+        int k = groups->groupCount++;
+        groups->labels[k] = dictionary->decode(i);
+        groups->counts[k] = byCode->counts[i];
+        groups->sums[k] = byCode->sums[i];
+        groups->minimums[k] = byCode->minimums[i];
+        groups->maximums[k] = byCode->maximums[i];
+    }
+    delete byCode;
+    return groups;
+}
+
+int* TableQuery::topK(const string& numberColumn, int k, bool largest, int& count) const {
+    count = 0;
+    int c = table->findColumn(numberColumn);
+    if (c == -1 || !table->numberColumns[c] || k <= 0 || matchesNothing) return nullptr;
+    if (k > table->rowCount) k = table->rowCount;
+    if (k == 0) return nullptr;
+    
+    // Best rows so far, best first; larger values rank first unless largest is false
+    const double* column = table->numbers[c];
+    int* best = new int[k];
+    double* bestValues = new double[k];
+    int selection[BATCH_SIZE];
+    for (int start = 0; start < table->rowCount; start += BATCH_SIZE) {
+        int end = (start + BATCH_SIZE < table->rowCount) ? start + BATCH_SIZE : table->rowCount;
+        int selected = selectBatch(start, end, selection);
+        for (int j = 0; j < selected; j++) {
+            double value = largest ? column[selection[j]] : -column[selection[j]];
+            if (count == k && value <= bestValues[k - 1]) continue;
+            
+            // Insert after every row with the same or a better value (earlier rows win ties)
+            int slot = (count < k) ? count++ : k - 1;
+            while (slot > 0 && bestValues[slot - 1] < value) {
+                best[slot] = best[slot - 1];
+                bestValues[slot] = bestValues[slot - 1];
+                slot--;
+            }
+            best[slot] = selection[j];
+            bestValues[slot] = value;
+        }
+    }
+    
+    delete[] bestValues;
+    if (count == 0) {
+        delete[] best;
+        return nullptr;
+    }
+    return best;
+}
@@ -0,0 +1,159 @@
+#ifndef QUERYTABLE_H
+#define QUERYTABLE_H
+
+#include <string>
+#include "StringDictionary.h"
+using namespace std;
+
+// QueryTable class - Columnar snapshot of one kind of city entity for ad hoc queries
+// Used for: Statistics menu queries over citizens, hospitals, pharmacy stock, products and facilities
+// Each column is either a category (dictionary-encoded int codes, e.g., Sector) or a
+// number (doubles, e.g., Price). Managers build a table from their own data; TableQuery
+// then filters and aggregates it without entity-specific loops.
+class QueryTable {
+private:
+    string tableName;
+    string* columnNames;
+    bool* numberColumns;          // true for number columns, false for category columns
+    int** codes;                  // Code array per category column (nullptr for number columns)
+    double** numbers;             // Value array per number column (nullptr for category columns)
+    StringDictionary** dictionaries; // Dictionary per category column (nullptr for number columns)
+    int columnCount;
+    int columnCapacity;
+    int rowCount;
+    int rowCapacity;
+    
+    // Add a column of either kind
+    // Returns: column index, -1 if the name is empty, taken, or rows were already added
+    int addColumn(const string& name, bool isNumber);
+    
+    friend class TableQuery;
+
+public:
+    // Constructor
+    // Parameters: name - shown in menus (e.g., "Citizens"), initialRows - starting row capacity
+    // Complexity: O(1)
+    QueryTable(const string& name, int initialRows = 64);
+    
+    // Destructor
+    // Complexity: O(c) where c is number of columns
+    ~QueryTable();
+    
+    // Define the columns (before the first addRow)
+    // Returns: column index, -1 if the name is empty or already used, or rows exist
+    // Complexity: O(c)
+    int addCategoryColumn(const string& name);
+    int addNumberColumn(const string& name);
+    
+    // Append an empty row (categories unset, numbers 0)
+    // Returns: row index
+    // Complexity: O(c) amortized
+    int addRow();
+    
+    // Set a cell
+    // Returns: false if the row or column is out of range or of the other kind
+    // Complexity: O(m) average for categories (m = value length), O(1) for numbers
+    bool setCategory(int row, int column, const string& value);
+    bool setNumber(int row, int column, double value);
+    
+    // Find a column by name (case-insensitive)
+    // Returns: column index, -1 if not found
+    // Complexity: O(c × m)
+    int findColumn(const string& name) const;
+    
+    // Table shape
+    // Complexity: O(1)
+    string getName() const;
+    int getColumnCount() const;
+    int getRowCount() const;
+    string getColumnName(int column) const;
+    bool isNumberColumn(int column) const;
+    
+    // Read a cell (empty string / 0 if out of range or of the other kind)
+    // Complexity: O(1)
+    string getCategory(int row, int column) const;
+    double getNumber(int row, int column) const;
+};
+
+// Structure for the result of a group-by (one entry per group with at least one row)
+struct QueryGroups {
+    string* labels;           // Category value of each group
+    int* counts;              // Matching rows per group
+    double* sums;             // Sum of the aggregated number column per group (0 if none)
+    double* minimums;         // Smallest value per group
+    double* maximums;         // Largest value per group
+    int groupCount;
+    
+    QueryGroups(int capacity);
+    ~QueryGroups();
+    
+    // Average of the aggregated column for a group (0 if the group is empty)
+    double getAverage(int group) const;
+};
+
+// TableQuery class - Filter / aggregate / group-by / top-k over a QueryTable
+// Rows are processed in batches of BATCH_SIZE: the first condition scans the batch into a
+// selection vector and every further condition compacts it in place, so each pass is a
+// simple loop over one contiguous column. Aggregates then read only the selected rows.
+class TableQuery {
+private:
+    const QueryTable* table;
+    int* conditionColumns;
+    int* conditionCodes;          // Category conditions: code to match
+    double* conditionLows;        // Number conditions: inclusive range
+    double* conditionHighs;
+    int conditionCount;
+    int conditionCapacity;
+    bool matchesNothing;          // A condition named a value that does not occur
+    
+    // Add a condition slot
+    void addCondition(int column, int code, double low, double high);
+    
+    // Fill selection with rows in [start, end) that pass every condition
+    // Returns: number of selected rows
+    // Complexity: O((end - start) × conditions)
+    int selectBatch(int start, int end, int* selection) const;
+
+public:
+    static const int BATCH_SIZE = 1024;
+    
+    // Constructor
+    // Parameters: table - table to query (not owned, must outlive the query)
+    TableQuery(const QueryTable* table);
+    
+    // Destructor
+    ~TableQuery();
+    
+    // Keep rows whose category column equals value
+    // Returns: false if the column is unknown or a number column
+    // Complexity: O(c × m)
+    bool whereEquals(const string& column, const string& value);
+    
+    // Keep rows whose number column is in [low, high]
+    // Returns: false if the column is unknown or a category column
+    // Complexity: O(c × m)
+    bool whereBetween(const string& column, double low, double high);
+    
+    // Count matching rows
+    // Complexity: O(n × conditions)
+    int count() const;
+    
+    // Count, sum, min and max of a number column over matching rows
+    // Returns: false if the column is unknown or a category column (outputs are zero)
+    // Complexity: O(n × conditions)
+    bool aggregate(const string& numberColumn, int& count, double& sum,
+                   double& minimum, double& maximum) const;
+    
+    // Group matching rows by a category column, aggregating an optional number column
+    // Returns: QueryGroups in first-seen category order (caller must delete), nullptr if the
+    //          group column is unknown or a number column, or numberColumn is given but invalid
+    // Complexity: O(n × conditions + g) where g is number of distinct categories
+    QueryGroups* groupBy(const string& groupColumn, const string& numberColumn = "") const;
+    
+    // Get the k matching rows with the largest (or smallest) value of a number column
+    // Returns: Array of row indices, best first (caller must delete[]), nullptr if none
+    // Complexity: O(n × conditions + n × k) worst case; most rows are rejected in O(1)
+    int* topK(const string& numberColumn, int k, bool largest, int& count) const;
+};
+
+#endif // QUERYTABLE_H
@@ -0,0 +1,581 @@
+#include "RoaringBitmap.h"
+using namespace std;
+
+// Helper: number of set bits in a word (portable SWAR popcount)
+static int popcount64(unsigned long long x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+}
+
+// Helper: check a bit of a bitmap container
+static bool testBit(const unsigned long long* words, unsigned short low) {
+    return (words[low >> 6] >> (low & 63)) & 1ULL;
+}
+
+// RoaringContainer Implementation
+RoaringContainer::RoaringContainer() : words(nullptr), cardinality(0), capacity(4) {
+    values = new unsigned short[capacity];
+}
+
+RoaringContainer::~RoaringContainer() {
+    delete[] values;
+    delete[] words;
+}
+
+bool RoaringContainer::contains(unsigned short low) const {
+    if (words != nullptr) {
+        return testBit(words, low);
+    }
+    int left = 0;
+    int right = cardinality;
+    while (left < right) {
+        int mid = (left + right) / 2;
+        if (values[mid] < low) left = mid + 1;
+        else right = mid;
+    }
+    return left < cardinality && values[left] == low;
+}
+
+bool RoaringContainer::add(unsigned short low) {
+    if (words != nullptr) {
+        unsigned long long bit = 1ULL << (low & 63);
+        if (words[low >> 6] & bit) return false;
+        words[low >> 6] |= bit;
+        cardinality++;
+        return true;
+    }
+    
+    int left = 0;
+    int right = cardinality;
+    while (left < right) {
+        int mid = (left + right) / 2;
+        if (values[mid] < low) left = mid + 1;
+        else right = mid;
+    }
+    if (left < cardinality && values[left] == low) return false;
+    
+    if (cardinality >= ARRAY_LIMIT) {
+        convertToBitmap();
+        return add(low);
+    }
+    if (cardinality >= capacity) {
+        int newCapacity = capacity * 2;
+        unsigned short* newValues = new unsigned short[newCapacity];
+        for (int i = 0; i < cardinality; i++) {
+            newValues[i] = values[i];
+        }
+        delete[] values;
+        values = newValues;
+        capacity = newCapacity;
+    }
+    for (int i = cardinality; i > left; i--) {
+        values[i] = values[i - 1];
+    }
+    values[left] = low;
+    cardinality++;
+    return true;
+}
+
+bool RoaringContainer::remove(unsigned short low) {
+    if (words != nullptr) {
+        unsigned long long bit = 1ULL << (low & 63);
+        if (!(words[low >> 6] & bit)) return false;
+        words[low >> 6] &= ~bit;
+        cardinality--;
+        // Go back to an array only well below the limit, so a container hovering
+        // around ARRAY_LIMIT does not convert on every add/remove
+        if (cardinality <= ARRAY_LIMIT / 2) {
+            convertToArray();
+        }
+        return true;
+    }
+    
+    int left = 0;
+    int right = cardinality;
+    while (left < right) {
+        int mid = (left + right) / 2;
+        if (values[mid] < low) left = mid + 1;
+        else right = mid;
+    }
+    if (left >= cardinality || values[left] != low) return false;
+    
+    for (int i = left; i < cardinality - 1; i++) {
+        values[i] = values[i + 1];
+    }
+    cardinality--;
+    return true;
+}
+
+void RoaringContainer::convertToBitmap() {
+    if (words != nullptr) return;
+    
+    words = new unsigned long long[WORD_COUNT];
+    for (int i = 0; i < WORD_COUNT; i++) {
+        words[i] = 0;
+    }
+    for (int i = 0; i < cardinality; i++) {
+        words[values[i] >> 6] |= 1ULL << (values[i] & 63);
+    }
+    delete[] values;
+    values = nullptr;
+    capacity = 0;
+}
+
+void RoaringContainer::convertToArray() {
+    if (words == nullptr) return;
+    
+    capacity = (cardinality > 4) ? cardinality : 4;
+    values = new unsigned short[capacity];
+    int count = 0;
+    for (int w = 0; w < WORD_COUNT; w++) {
+        unsigned long long word = words[w];
+        while (word != 0) {
+            unsigned long long lowest = word & (0 - word);
+            values[count++] = (unsigned short)(w * 64 + popcount64(lowest - 1));
+            word ^= lowest;
+        }
+    }
+    delete[] words;
+    words = nullptr;
+}
+
+RoaringContainer* RoaringContainer::clone() const {
+    RoaringContainer* copy = new RoaringContainer();
+    copy->cardinality = cardinality;
+    if (words != nullptr) {
+        delete[] copy->values;
+        copy->values = nullptr;
+        copy->capacity = 0;
+        copy->words = new unsigned long long[WORD_COUNT];
+        for (int i = 0; i < WORD_COUNT; i++) {
+            copy->words[i] = words[i];
+        }
+    } else {
+        delete[] copy->values;
+        copy->capacity = (cardinality > 4) ? cardinality : 4;
+        copy->values = new unsigned short[copy->capacity];
+        for (int i = 0; i < cardinality; i++) {
+            copy->values[i] = values[i];
+        }
+    }
+    return copy;
+}
+
+// Helper: AND of two containers
+// Returns: New container, nullptr if the intersection is empty
+static RoaringContainer* intersectContainers(const RoaringContainer* a, const RoaringContainer* b) {
+    RoaringContainer* result = new RoaringContainer();
+    if (a->words != nullptr && b->words != nullptr) {
+        result->convertToBitmap();
+        int count = 0;
+        for (int i = 0; i < RoaringContainer::WORD_COUNT; i++) {
+            result->words[i] = a->words[i] & b->words[i];
+            count += popcount64(result->words[i]);
+        }
+        result->cardinality = count;
+        if (count <= RoaringContainer::ARRAY_LIMIT) {
+            result->convertToArray();
+        }
+    } else {
+        // At least one side is an array, so the result fits in an array of its size
+        if (a->words != nullptr || (b->words == nullptr && b->cardinality < a->cardinality)) {
+            const RoaringContainer* swap = a;
+            a = b;
+            b = swap;
+        }
+        delete[] result->values;
+        result->capacity = (a->cardinality > 4) ? a->cardinality : 4;
+        result->values = new unsigned short[result->capacity];
+        int count = 0;
+        if (b->words != nullptr) {
+            for (int i = 0; i < a->cardinality; i++) {
+                result->values[count] = a->values[i];
+                count += testBit(b->words, a->values[i]) ? 1 : 0;
+            }
+        } else {
+            int i = 0;
+            int j = 0;
+            while (i < a->cardinality && j < b->cardinality) {
+                if (a->values[i] < b->values[j]) i++;
+                else if (a->values[i] > b->values[j]) j++;
+                else {
+                    result->values[count++] = a->values[i];
+                    i++;
+                    j++;
+                }
+            }
+        }
+        result->cardinality = count;
+    }
+    
+    if (result->cardinality == 0) {
+        delete result;
+        return nullptr;
+    }
+    return result;
+}
+
+// Helper: OR of two containers
+// Returns: New container
+static RoaringContainer* uniteContainers(const RoaringContainer* a, const RoaringContainer* b) {
+    if (a->words == nullptr && b->words == nullptr &&
+        a->cardinality + b->cardinality <= RoaringContainer::ARRAY_LIMIT) {
+        RoaringContainer* result = new RoaringContainer();
+        delete[] result->values;
+        result->capacity = a->cardinality + b->cardinality;
+        if (result->capacity < 4) result->capacity = 4;
+        result->values = new unsigned short[result->capacity];
+        int count = 0;
+        int i = 0;
+        int j = 0;
+        while (i < a->cardinality && j < b->cardinality) {
+            if (a->values[i] < b->values[j]) result->values[count++] = a->values[i++];
+            else if (a->values[i] > b->values[j]) result->values[count++] = b->values[j++];
+            else {
+                result->values[count++] = a->values[i];
+                i++;
+                j++;
+            }
+        }
+        while (i < a->cardinality) result->values[count++] = a->values[i++];
+        while (j < b->cardinality) result->values[count++] = b->values[j++];
+        result->cardinality = count;
+        return result;
+    }
+    
+    // Bitmap result: start from a bitmap side (or convert a copy), then OR in the other
+    if (a->words == nullptr && b->words != nullptr) {
+        const RoaringContainer* swap = a;
+        a = b;
+        b = swap;
+    }
+    RoaringContainer* result = a->clone();
+    result->convertToBitmap();
+    if (b->words != nullptr) {
+        for (int i = 0; i < RoaringContainer::WORD_COUNT; i++) {
+            result->words[i] |= b->words[i];
+        }
+    } else {
+        for (int i = 0; i < b->cardinality; i++) {
+            result->words[b->values[i] >> 6] |= 1ULL << (b->values[i] & 63);
+        }
+    }
+    int count = 0;
+    for (int i = 0; i < RoaringContainer::WORD_COUNT; i++) {
+        count += popcount64(result->words[i]);
+    }
+    result->cardinality = count;
+    return result;
+}
+
+// Helper: size of the AND of two containers
+static int intersectionCountContainers(const RoaringContainer* a, const RoaringContainer* b) {
+    int count = 0;
+    if (a->words != nullptr && b->words != nullptr) {
+        for (int i = 0; i < RoaringContainer::WORD_COUNT; i++) {
+            count += popcount64(a->words[i] & b->words[i]);
+        }
+    } else if (a->words != nullptr || b->words != nullptr) {
+        if (a->words != nullptr) {
+            const RoaringContainer* swap = a;
+            a = b;
+            b = swap;
+        }
+        for (int i = 0; i < a->cardinality; i++) {
+            count += testBit(b->words, a->values[i]) ? 1 : 0;
+        }
+    } else {
+        int i = 0;
+        int j = 0;
+        while (i < a->cardinality && j < b->cardinality) {
+            if (a->values[i] < b->values[j]) i++;
+            else if (a->values[i] > b->values[j]) j++;
+            else {
+                count++;
+                i++;
+                j++;
+            }
+        }
+    }
+    return count;
+}
+
+// RoaringBitmap Implementation
+RoaringBitmap::RoaringBitmap() : containerCount(0), containerCapacity(4) {
+    keys = new unsigned short[containerCapacity];
+    containers = new RoaringContainer*[containerCapacity];
+}
+
+RoaringBitmap::~RoaringBitmap() {
+    for (int i = 0; i < containerCount; i++) {
+        delete containers[i];
+    }
+    delete[] keys;
+    delete[] containers;
+}
+
+int RoaringBitmap::findKey(unsigned short key) const {
+    int left = 0;
+    int right = containerCount;
+    while (left < right) {
+        int mid = (left + right) / 2;
+        if (keys[mid] < key) left = mid + 1;
+        else right = mid;
+    }
+    return left;
+}
+
+void RoaringBitmap::insertContainer(int position, unsigned short key, RoaringContainer* container) {
+    if (containerCount >= containerCapacity) {
+        int newCapacity = containerCapacity * 2;
+        unsigned short* newKeys = new unsigned short[newCapacity];
+        RoaringContainer** newContainers = new RoaringContainer*[newCapacity];
+        for (int i = 0; i < containerCount; i++) {
+            newKeys[i] = keys[i];
+            newContainers[i] = containers[i];
+        }
+        delete[] keys;
+        delete[] containers;
+        keys = newKeys;
+        containers = newContainers;
+        containerCapacity = newCapacity;
+    }
+    for (int i = containerCount; i > position; i--) {
+        keys[i] = keys[i - 1];
+        containers[i] = containers[i - 1];
+    }
+    keys[position] = key;
+    containers[position] = container;
+    containerCount++;
+}
+
+void RoaringBitmap::replaceContainers(unsigned short* newKeys, RoaringContainer** newContainers,
+                                      int count, int capacity) {
+    delete[] keys;
+    delete[] containers;
+    keys = newKeys;
+    containers = newContainers;
+    containerCount = count;
+    containerCapacity = (capacity > 0) ? capacity : 1;
+}
+
+bool RoaringBitmap::add(int value) {
+    if (value < 0) return false;
+    
+    unsigned short key = (unsigned short)(value >> 16);
+    int position = findKey(key);
+    if (position == containerCount || keys[position] != key) {
+        insertContainer(position, key, new RoaringContainer());
+    }
+    return containers[position]->add((unsigned short)(value & 0xFFFF));
+}
+
+bool RoaringBitmap::remove(int value) {
+    if (value < 0) return false;
+    
+    unsigned short key = (unsigned short)(value >> 16);
+    int position = findKey(key);
+    if (position == containerCount || keys[position] != key) return false;
+    if (!containers[position]->remove((unsigned short)(value & 0xFFFF))) return false;
+    
+    if (containers[position]->cardinality == 0) {
+        delete containers[position];
+        for (int i = position; i < containerCount - 1; i++) {
+            keys[i] = keys[i + 1];
+            containers[i] = containers[i + 1];
+        }
+        containerCount--;
+    }
+    return true;
+}
+
+bool RoaringBitmap::contains(int value) const {
+    if (value < 0) return false;
+    
+    unsigned short key = (unsigned short)(value >> 16);
+    int position = findKey(key);
+    if (position == containerCount || keys[position] != key) return false;
+    return containers[position]->contains((unsigned short)(value & 0xFFFF));
+}
+
+int RoaringBitmap::getCardinality() const {
+    int total = 0;
+    for (int i = 0; i < containerCount; i++) {
+        total += containers[i]->cardinality;
+    }
+    return total;
+}
+
+bool RoaringBitmap::isEmpty() const {
+    return containerCount == 0;
+}
+
+void RoaringBitmap::intersectWith(const RoaringBitmap& other) {
+    int capacity = (containerCount < other.containerCount) ? containerCount : other.containerCount;
+    unsigned short* newKeys = new unsigned short[capacity > 0 ? capacity : 1];
+    RoaringContainer** newContainers = new RoaringContainer*[capacity > 0 ? capacity : 1];
+    int count = 0;
+    
+    int i = 0;
+    int j = 0;
+    while (i < containerCount) {
+        while (j < other.containerCount && other.keys[j] < keys[i]) j++;
+        if (j < other.containerCount && other.keys[j] == keys[i]) {
+            RoaringContainer* result = intersectContainers(containers[i], other.containers[j]);
+            if (result != nullptr) {
+                newKeys[count] = keys[i];
+                newContainers[count] = result;
+                count++;
+            }
+        }
+        delete containers[i];
+        i++;
+    }
+    replaceContainers(newKeys, newContainers, count, capacity);
+}
+
+void RoaringBitmap::unionWith(const RoaringBitmap& other) {
+    int capacity = containerCount + other.containerCount;
+    unsigned short* newKeys = new unsigned short[capacity > 0 ? capacity : 1];
+    RoaringContainer** newContainers = new RoaringContainer*[capacity > 0 ? capacity : 1];
+    int count = 0;
+    
+    int i = 0;
+    int j = 0;
+    while (i < containerCount || j < other.containerCount) {
+        if (j == other.containerCount || (i < containerCount && keys[i] < other.keys[j])) {
+            newKeys[count] = keys[i];
+            newContainers[count] = containers[i];
+            i++;
+        } else if (i == containerCount || other.keys[j] < keys[i]) {
+            newKeys[count] = other.keys[j];
+            newContainers[count] = other.containers[j]->clone();
+            j++;
+        } else {
+            newKeys[count] = keys[i];
+            newContainers[count] = uniteContainers(containers[i], other.containers[j]);
+            delete containers[i];
+            i++;
+            j++;
+        }
+        count++;
+    }
+    replaceContainers(newKeys, newContainers, count, capacity);
+}
+
+int RoaringBitmap::intersectionCount(const RoaringBitmap& a, const RoaringBitmap& b) {
+    int count = 0;
+    int i = 0;
+    int j = 0;
+    while (i < a.containerCount && j < b.containerCount) {
+        if (a.keys[i] < b.keys[j]) i++;
+        else if (a.keys[i] > b.keys[j]) j++;
+        else {
+            count += intersectionCountContainers(a.containers[i], b.containers[j]);
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+RoaringBitmap* RoaringBitmap::clone() const {
+    RoaringBitmap* copy = new RoaringBitmap();
+    int capacity = (containerCount > 0) ? containerCount : 1;
+    unsigned short* newKeys = new unsigned short[capacity];
+    RoaringContainer** newContainers = new RoaringContainer*[capacity];
+    for (int i = 0; i < containerCount; i++) {
+        newKeys[i] = keys[i];
+        newContainers[i] = containers[i]->clone();
+    }
+    copy->replaceContainers(newKeys, newContainers, containerCount, capacity);
+    return copy;
+}
+
+int* RoaringBitmap::toArray(int& count) const {
+    count = 0;
+    int total = getCardinality();
+    if (total == 0) return nullptr;
+    
+    int* result = new int[total];
+    for (int i = 0; i < containerCount; i++) {
+        int high = (int)keys[i] << 16;
+        const RoaringContainer* container = containers[i];
+        if (container->words != nullptr) {
+            for (int w = 0; w < RoaringContainer::WORD_COUNT; w++) {
+                unsigned long long word = container->words[w];
+                while (word != 0) {
+                    unsigned long long lowest = word & (0 - word);
+                    result[count++] = high | (w * 64 + popcount64(lowest - 1));
+                    word ^= lowest;
+                }
+            }
+        } else {
+            for (int v = 0; v < container->cardinality; v++) {
+                result[count++] = high | container->values[v];
+            }
+        }
+    }
+    return result;
+}
+
+void RoaringBitmap::clear() {
+    for (int i = 0; i < containerCount; i++) {
+        delete containers[i];
+    }
+    containerCount = 0;
+}
+
+// BitmapIndex Implementation
+BitmapIndex::BitmapIndex() : count(0), capacity(8) {
+    bitmaps = new RoaringBitmap*[capacity];
+}
+
+BitmapIndex::~BitmapIndex() {
+    for (int i = 0; i < count; i++) {
+        delete bitmaps[i];
+    }
+    delete[] bitmaps;
+}
+
+void BitmapIndex::add(int key, int row) {
+    if (key < 0) return;
+    
+    if (key >= capacity) {
+        int newCapacity = capacity * 2;
+        while (newCapacity <= key) newCapacity *= 2;
+        RoaringBitmap** newBitmaps = new RoaringBitmap*[newCapacity];
+        for (int i = 0; i < count; i++) {
+            newBitmaps[i] = bitmaps[i];
+        }
+        delete[] bitmaps;
+        bitmaps = newBitmaps;
+        capacity = newCapacity;
+    }
+    while (count <= key) {
+        bitmaps[count++] = nullptr;
+    }
+    if (bitmaps[key] == nullptr) {
+        bitmaps[key] = new RoaringBitmap();
+    }
+    bitmaps[key]->add(row);
+}
+
+void BitmapIndex::remove(int key, int row) {
+    if (key < 0 || key >= count || bitmaps[key] == nullptr) return;
+    bitmaps[key]->remove(row);
+}
+
+const RoaringBitmap* BitmapIndex::get(int key) const {
+    if (key < 0 || key >= count || bitmaps[key] == nullptr || bitmaps[key]->isEmpty()) return nullptr;
+    return bitmaps[key];
+}
+
+void BitmapIndex::clear() {
+    for (int i = 0; i < count; i++) {
+        delete bitmaps[i];
+    }
+    count = 0;
+}
@@ -0,0 +1,141 @@
+#ifndef ROARINGBITMAP_H
+#define ROARINGBITMAP_H
+
+#include <string>
+using namespace std;
+
+// Structure for the values of a RoaringBitmap that share their high 16 bits
+// Sparse chunks keep a sorted array of the low 16 bits; once a chunk holds more than
+// ARRAY_LIMIT values it switches to a 65536-bit bitmap (8 KB), which is smaller from there on.
+struct RoaringContainer {
+    unsigned short* values;       // Sorted low 16 bits (array form), nullptr in bitmap form
+    unsigned long long* words;    // WORD_COUNT 64-bit words (bitmap form), nullptr in array form
+    int cardinality;              // Number of values in the container
+    int capacity;                 // Allocated size of values
+    
+    static const int ARRAY_LIMIT = 4096;
+    static const int WORD_COUNT = 1024;
+    
+    RoaringContainer();
+    ~RoaringContainer();
+    
+    // Check / add / remove one value
+    // Complexity: O(log c) lookup; O(c) to insert into or remove from the array form
+    bool contains(unsigned short low) const;
+    bool add(unsigned short low);         // false if already present
+    bool remove(unsigned short low);      // false if not present
+    
+    // Switch representation (cardinality is unchanged)
+    // Complexity: O(WORD_COUNT + c)
+    void convertToBitmap();
+    void convertToArray();
+    
+    // Deep copy
+    RoaringContainer* clone() const;
+};
+
+// RoaringBitmap class - Compressed set of non-negative integers (e.g., citizen row IDs)
+// Used for: Secondary indexes of the citizen table (one bitmap per gender, age bucket,
+//           occupation and sector), so compound filters become bitmap AND / OR
+// Values are split by their high 16 bits into containers kept sorted by that key.
+// Set operations walk both key lists together and combine matching containers
+// array-with-array (merge), array-with-bitmap (bit tests) or bitmap-with-bitmap
+// (word-wise AND / OR counted with popcount).
+class RoaringBitmap {
+private:
+    unsigned short* keys;         // High 16 bits of each container, ascending
+    RoaringContainer** containers;
+    int containerCount;
+    int containerCapacity;
+    
+    // Position of key, or of the first larger key if absent
+    // Complexity: O(log k) where k is number of containers
+    int findKey(unsigned short key) const;
+    
+    // Make room for a container at position (shifting later ones)
+    void insertContainer(int position, unsigned short key, RoaringContainer* container);
+    
+    // Replace the container list (used by the set operations)
+    void replaceContainers(unsigned short* newKeys, RoaringContainer** newContainers, int count, int capacity);
+
+public:
+    // Constructor
+    // Complexity: O(1)
+    RoaringBitmap();
+    
+    // Destructor
+    // Complexity: O(k)
+    ~RoaringBitmap();
+    
+    // Add a value
+    // Returns: true if added, false if already present or negative
+    // Complexity: O(log k + c) worst case (array insert), O(log k) in bitmap form
+    bool add(int value);
+    
+    // Remove a value
+    // Returns: true if removed, false if not present
+    // Complexity: O(log k + c)
+    bool remove(int value);
+    
+    // Check if a value is present
+    // Complexity: O(log k + log c)
+    bool contains(int value) const;
+    
+    // Get number of values
+    // Complexity: O(k)
+    int getCardinality() const;
+    
+    // Check if the bitmap is empty
+    // Complexity: O(1)
+    bool isEmpty() const;
+    
+    // Keep only values also in other (AND)
+    // Complexity: O(k1 + k2) containers, each combined in O(c1 + c2) or O(WORD_COUNT)
+    void intersectWith(const RoaringBitmap& other);
+    
+    // Add every value of other (OR)
+    // Complexity: O(k1 + k2) containers, each combined in O(c1 + c2) or O(WORD_COUNT)
+    void unionWith(const RoaringBitmap& other);
+    
+    // Count values present in both bitmaps without building the intersection
+    // Complexity: same as intersectWith, without allocation
+    static int intersectionCount(const RoaringBitmap& a, const RoaringBitmap& b);
+    
+    // Deep copy
+    // Returns: New RoaringBitmap (caller must delete)
+    // Complexity: O(size)
+    RoaringBitmap* clone() const;
+    
+    // Get every value in ascending order
+    // Returns: Array of values (caller must delete[]), nullptr if empty
+    // Complexity: O(n + k × WORD_COUNT)
+    int* toArray(int& count) const;
+    
+    // Remove every value
+    // Complexity: O(k)
+    void clear();
+};
+
+// Structure for a secondary index: one RoaringBitmap of row IDs per key (e.g., per sector code)
+struct BitmapIndex {
+    RoaringBitmap** bitmaps;      // Bitmap per key (nullptr until the key is first used)
+    int count;                    // Keys 0 .. count - 1 may have bitmaps
+    int capacity;
+    
+    BitmapIndex();
+    ~BitmapIndex();
+    
+    // Add / remove a row under a key (negative keys are ignored)
+    // Complexity: O(1) amortized growth + RoaringBitmap::add / remove
+    void add(int key, int row);
+    void remove(int key, int row);
+    
+    // Get the rows of a key
+    // Returns: Bitmap (owned by the index), nullptr if the key has no rows
+    const RoaringBitmap* get(int key) const;
+    
+    // Remove every key
+    void clear();
+};
+
+#endif // ROARINGBITMAP_H
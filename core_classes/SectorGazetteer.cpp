@@ -0,0 +1,353 @@
+#include "SectorGazetteer.h"
+#include "DataLoader.h"
+#include <iostream>
+using namespace std;
+
+// Built-in sector table (Islamabad layout, approximate)
+struct DefaultSector {
+    const char* sectorID;
+    double latitude;
+    double longitude;
+};
+
+static const DefaultSector DEFAULT_SECTORS[] = {
+    {"G-10", 33.684, 73.025},
+    {"F-8", 33.700, 73.037},
+    {"F-6", 33.715, 73.045},
+    {"G-9", 33.690, 73.030},
+    {"F-7", 33.707, 73.040},
+    {"G-8", 33.694, 73.032},
+    {"H-8", 33.710, 73.042},
+    {"I-8", 33.720, 73.048},
+    {"G-6", 33.709, 73.044},
+    {"F-10", 33.705, 73.038},
+    {"Blue Area", 33.697, 73.039},
+    {"F-9", 33.701, 73.035},
+    {"E-7", 33.722, 73.046},
+    {"E-8", 33.729, 73.038},
+    {"Bhara Kahu", 33.771, 73.101},
+    {"DHA Phase II", 33.556, 73.084}
+};
+static const int DEFAULT_SECTOR_COUNT = sizeof(DEFAULT_SECTORS) / sizeof(DEFAULT_SECTORS[0]);
+
+// Half size of a default bounding box (degrees)
+static const double DEFAULT_HALF_LATITUDE = 0.005;
+static const double DEFAULT_HALF_LONGITUDE = 0.006;
+
+const double SectorGazetteer::CITY_CENTER_LATITUDE = 33.684;
+const double SectorGazetteer::CITY_CENTER_LONGITUDE = 73.047;
+
+SectorGazetteer* SectorGazetteer::sharedInstance = nullptr;
+
+// SectorInfo Implementation
+SectorInfo::SectorInfo() : sectorID(""), latitude(0.0), longitude(0.0), minLatitude(0.0),
+                           minLongitude(0.0), maxLatitude(0.0), maxLongitude(0.0) {
+}
+
+// SectorGazetteer Implementation
+SectorGazetteer::SectorGazetteer(bool withDefaults) : sectorCount(0), keyCount(0) {
+    sectorCapacity = 16;
+    sectors = new SectorInfo[sectorCapacity];
+    keyCapacity = 32;
+    keys = new string[keyCapacity];
+    keySectors = new int[keyCapacity];
+    
+    if (withDefaults) {
+        loadDefaults();
+    }
+}
+
+SectorGazetteer::~SectorGazetteer() {
+    delete[] sectors;
+    delete[] keys;
+    delete[] keySectors;
+    sectors = nullptr;
+    keys = nullptr;
+    keySectors = nullptr;
+}
+
+string SectorGazetteer::normalizeName(const string& name) {
+    string result = "";
+    for (int i = 0; i < (int)name.length(); i++) {
+        char c = name[i];
+        if (c >= 'a' && c <= 'z') {
+            result += (char)(c - 'a' + 'A');
+        } else if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+            result += c;
+        }
+        // Spaces, dashes, slashes and quotes are dropped
+    }
+    return result;
+}
+
+int SectorGazetteer::findKey(const string& key) const {
+    int low = 0;
+    int high = keyCount - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        int cmp = keys[mid].compare(key);
+        if (cmp == 0) return mid;
+        if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -(low + 1);
+}
+
+void SectorGazetteer::setKey(const string& key, int sectorIndex) {
+    int index = findKey(key);
+    if (index >= 0) {
+        keySectors[index] = sectorIndex;
+        return;
+    }
+    
+    if (keyCount >= keyCapacity) {
+        int newCapacity = keyCapacity * 2;
+        string* newKeys = new string[newCapacity];
+        int* newKeySectors = new int[newCapacity];
+        for (int i = 0; i < keyCount; i++) {
+            newKeys[i].swap(keys[i]);
+            newKeySectors[i] = keySectors[i];
+        }
+        delete[] keys;
+        delete[] keySectors;
+        keys = newKeys;
+        keySectors = newKeySectors;
+        keyCapacity = newCapacity;
+    }
+    
+    // Shift larger keys right to open the insertion point
+    int position = -index - 1;
+    for (int i = keyCount; i > position; i--) {
+        keys[i].swap(keys[i - 1]);
+        keySectors[i] = keySectors[i - 1];
+    }
+    keys[position] = key;
+    keySectors[position] = sectorIndex;
+    keyCount++;
+}
+
+void SectorGazetteer::loadDefaults() {
+    for (int i = 0; i < DEFAULT_SECTOR_COUNT; i++) {
+        double lat = DEFAULT_SECTORS[i].latitude;
+        double lon = DEFAULT_SECTORS[i].longitude;
+        addSector(DEFAULT_SECTORS[i].sectorID, lat, lon,
+                  lat - DEFAULT_HALF_LATITUDE, lon - DEFAULT_HALF_LONGITUDE,
+                  lat + DEFAULT_HALF_LATITUDE, lon + DEFAULT_HALF_LONGITUDE);
+    }
+}
+
+double SectorGazetteer::stringToDouble(const string& str) {
+    if (str.empty()) return 0.0;
+    
+    double result = 0.0;
+    double fraction = 0.1;
+    bool hasDecimal = false;
+    bool isNegative = false;
+    int i = 0;
+    
+    // Skip whitespace
+    while (i < (int)str.length() && (str[i] == ' ' || str[i] == '\t')) {
+        i++;
+    }
+    
+    // Check for negative sign
+    if (i < (int)str.length() && str[i] == '-') {
+        isNegative = true;
+        i++;
+    }
+    
+    // Parse digits
+    while (i < (int)str.length()) {
+        if (str[i] >= '0' && str[i] <= '9') {
+            if (!hasDecimal) {
+                result = result * 10.0 + (str[i] - '0');
+            } else {
+                result += (str[i] - '0') * fraction;
+                fraction *= 0.1;
+            }
+        } else if (str[i] == '.' && !hasDecimal) {
+            hasDecimal = true;
+        } else {
+            break;
+        }
+        i++;
+    }
+    
+    return isNegative ? -result : result;
+}
+
+int SectorGazetteer::addSector(const string& sectorID, double latitude, double longitude,
+                               double minLatitude, double minLongitude, double maxLatitude, double maxLongitude) {
+    string key = normalizeName(sectorID);
+    if (key.empty()) {
+        return -1;
+    }
+    
+    int index;
+    int keyIndex = findKey(key);
+    if (keyIndex >= 0) {
+        index = keySectors[keyIndex];
+    } else {
+        if (sectorCount >= sectorCapacity) {
+            int newCapacity = sectorCapacity * 2;
+            SectorInfo* newSectors = new SectorInfo[newCapacity];
+            for (int i = 0; i < sectorCount; i++) {
+                newSectors[i] = sectors[i];
+            }
+            delete[] sectors;
+            sectors = newSectors;
+            sectorCapacity = newCapacity;
+        }
+        index = sectorCount++;
+        setKey(key, index);
+    }
+    
+    SectorInfo& sector = sectors[index];
+    sector.sectorID = sectorID;
+    sector.latitude = latitude;
+    sector.longitude = longitude;
+    sector.minLatitude = minLatitude;
+    sector.minLongitude = minLongitude;
+    sector.maxLatitude = maxLatitude;
+    sector.maxLongitude = maxLongitude;
+    return index;
+}
+
+bool SectorGazetteer::addAlias(const string& alias, const string& sectorID) {
+    string aliasKey = normalizeName(alias);
+    int keyIndex = findKey(normalizeName(sectorID));
+    if (aliasKey.empty() || keyIndex < 0) {
+        return false;
+    }
+    setKey(aliasKey, keySectors[keyIndex]);
+    return true;
+}
+
+int SectorGazetteer::loadFromCSV(const string& filename) {
+    // Stream the rows so a sector file of any length is loaded in full
+    CSVStream csv(8);
+    if (!csv.open(filename)) {
+        cout << "[ERROR] Could not open file '" << filename << "'!" << endl;
+        return 0;
+    }
+    
+    int loadedCount = 0;
+    while (csv.next()) {
+        if (csv.getFieldCount() < 4) continue;
+        
+        string sectorID = csv.field(0);
+        double lat = stringToDouble(csv.field(2));
+        double lon = stringToDouble(csv.field(3));
+        
+        // Bounding box is optional
+        double minLat = lat - DEFAULT_HALF_LATITUDE;
+        double minLon = lon - DEFAULT_HALF_LONGITUDE;
+        double maxLat = lat + DEFAULT_HALF_LATITUDE;
+        double maxLon = lon + DEFAULT_HALF_LONGITUDE;
+        if (csv.getFieldCount() >= 8) {
+            minLat = stringToDouble(csv.field(4));
+            minLon = stringToDouble(csv.field(5));
+            maxLat = stringToDouble(csv.field(6));
+            maxLon = stringToDouble(csv.field(7));
+        }
+        
+        if (addSector(sectorID, lat, lon, minLat, minLon, maxLat, maxLon) == -1) continue;
+        loadedCount++;
+        
+        // Aliases: comma separated list
+        const string& aliases = csv.field(1);
+        int start = 0;
+        for (int j = 0; j <= (int)aliases.length(); j++) {
+            if (j == (int)aliases.length() || aliases[j] == ',') {
+                addAlias(aliases.substr(start, j - start), sectorID);
+                start = j + 1;
+            }
+        }
+    }
+    csv.close();
+    
+    return loadedCount;
+}
+
+const SectorInfo* SectorGazetteer::getSector(const string& name) const {
+    int keyIndex = findKey(normalizeName(name));
+    if (keyIndex < 0) {
+        return nullptr;
+    }
+    return &sectors[keySectors[keyIndex]];
+}
+
+bool SectorGazetteer::getCoordinates(const string& name, double& latitude, double& longitude) const {
+    const SectorInfo* sector = getSector(name);
+    if (sector == nullptr) {
+        // For unknown sectors, use the city center
+        latitude = CITY_CENTER_LATITUDE;
+        longitude = CITY_CENTER_LONGITUDE;
+        return false;
+    }
+    latitude = sector->latitude;
+    longitude = sector->longitude;
+    return true;
+}
+
+bool SectorGazetteer::getBoundingBox(const string& name, double& minLatitude, double& minLongitude,
+                                     double& maxLatitude, double& maxLongitude) const {
+    const SectorInfo* sector = getSector(name);
+    if (sector == nullptr) {
+        return false;
+    }
+    minLatitude = sector->minLatitude;
+    minLongitude = sector->minLongitude;
+    maxLatitude = sector->maxLatitude;
+    maxLongitude = sector->maxLongitude;
+    return true;
+}
+
+const SectorInfo* SectorGazetteer::findSectorAt(double latitude, double longitude) const {
+    const SectorInfo* best = nullptr;
+    double bestDistance = 0.0;
+    
+    for (int i = 0; i < sectorCount; i++) {
+        const SectorInfo& sector = sectors[i];
+        if (latitude < sector.minLatitude || latitude > sector.maxLatitude ||
+            longitude < sector.minLongitude || longitude > sector.maxLongitude) {
+            continue;
+        }
+        
+        // Squared degree distance is enough to rank centroids this close together
+        double dLat = latitude - sector.latitude;
+        double dLon = longitude - sector.longitude;
+        double distance = dLat * dLat + dLon * dLon;
+        if (best == nullptr || distance < bestDistance) {
+            best = &sector;
+            bestDistance = distance;
+        }
+    }
+    return best;
+}
+
+int SectorGazetteer::getSectorCount() const {
+    return sectorCount;
+}
+
+const SectorInfo* SectorGazetteer::getSectorAt(int index) const {
+    if (index < 0 || index >= sectorCount) {
+        return nullptr;
+    }
+    return &sectors[index];
+}
+
+SectorGazetteer* SectorGazetteer::getShared() {
+    if (sharedInstance == nullptr) {
+        sharedInstance = new SectorGazetteer(true);
+    }
+    return sharedInstance;
+}
+
+void SectorGazetteer::destroyShared() {
+    delete sharedInstance;
+    sharedInstance = nullptr;
+}
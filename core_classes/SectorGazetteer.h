@@ -0,0 +1,119 @@
+#ifndef SECTORGAZETTEER_H
+#define SECTORGAZETTEER_H
+
+#include <string>
+using namespace std;
+
+// Structure for one sector of the city
+struct SectorInfo {
+    string sectorID;          // Sector name as written in the data (e.g., "G-10", "Blue Area")
+    double latitude;          // Centroid latitude
+    double longitude;         // Centroid longitude
+    double minLatitude;       // Bounding box
+    double minLongitude;
+    double maxLatitude;
+    double maxLongitude;
+    
+    SectorInfo();
+};
+
+// SectorGazetteer class - Sector name → centroid / bounding box lookup
+// Used for: Placing hospitals, schools, pharmacies and facilities on the map by sector
+// Names and aliases are normalized once (upper case, letters and digits only), so
+// "G-10", "G10" and "g 10" are the same key. Keys are kept in a sorted array and
+// looked up with a binary search.
+// Format of the data file: SectorID,Aliases,Latitude,Longitude,MinLatitude,MinLongitude,MaxLatitude,MaxLongitude
+// (Aliases is a quoted, comma separated list and may be empty)
+class SectorGazetteer {
+private:
+    SectorInfo* sectors;          // Sectors in insertion order
+    int sectorCount;
+    int sectorCapacity;
+    
+    string* keys;                 // Sorted normalized names and aliases
+    int* keySectors;              // keys[i] → index in sectors
+    int keyCount;
+    int keyCapacity;
+    
+    static SectorGazetteer* sharedInstance;
+    
+    // Normalize a sector name or alias for lookup
+    static string normalizeName(const string& name);
+    
+    // Binary search for a normalized key
+    // Returns: index in keys, or -(insertion point) - 1 if not found
+    // Complexity: O(log k) where k is number of keys
+    int findKey(const string& key) const;
+    
+    // Point a key at a sector, inserting it in sorted position if new
+    // Complexity: O(k)
+    void setKey(const string& key, int sectorIndex);
+    
+    // Register the built-in Islamabad sectors
+    void loadDefaults();
+    
+    // Helper: Convert string to double (replaces stod)
+    static double stringToDouble(const string& str);
+
+public:
+    // Approximate center of Islamabad, returned for unknown sectors
+    static const double CITY_CENTER_LATITUDE;
+    static const double CITY_CENTER_LONGITUDE;
+    
+    // Constructor
+    // Parameters: withDefaults - start with the built-in sector table
+    // Complexity: O(s × k) for the defaults
+    SectorGazetteer(bool withDefaults = true);
+    
+    // Destructor
+    // Complexity: O(1)
+    ~SectorGazetteer();
+    
+    // Add a sector or replace its coordinates
+    // Returns: index of the sector, -1 if sectorID is empty
+    // Complexity: O(log k) to update, O(k) to insert
+    int addSector(const string& sectorID, double latitude, double longitude,
+                  double minLatitude, double minLongitude, double maxLatitude, double maxLongitude);
+    
+    // Make alias resolve to an existing sector
+    // Returns: false if the sector is unknown or the alias is empty
+    // Complexity: O(k)
+    bool addAlias(const string& alias, const string& sectorID);
+    
+    // Load sectors from CSV (adds to / overrides the current table)
+    // Returns: number of sectors loaded
+    int loadFromCSV(const string& filename);
+    
+    // Get a sector by name or alias
+    // Returns: nullptr if not found
+    // Complexity: O(m + log k) where m is the name length
+    const SectorInfo* getSector(const string& name) const;
+    
+    // Get a sector's centroid
+    // Returns: false if not found (latitude/longitude are then set to the city center)
+    // Complexity: O(m + log k)
+    bool getCoordinates(const string& name, double& latitude, double& longitude) const;
+    
+    // Get a sector's bounding box
+    // Returns: false if not found (outputs unchanged)
+    // Complexity: O(m + log k)
+    bool getBoundingBox(const string& name, double& minLatitude, double& minLongitude,
+                        double& maxLatitude, double& maxLongitude) const;
+    
+    // Find the sector containing a point (nearest centroid if boxes overlap)
+    // Returns: nullptr if no bounding box contains the point
+    // Complexity: O(s) where s is number of sectors
+    const SectorInfo* findSectorAt(double latitude, double longitude) const;
+    
+    // Get number of sectors / sector by insertion index (nullptr if out of range)
+    int getSectorCount() const;
+    const SectorInfo* getSectorAt(int index) const;
+    
+    // Get the process-wide gazetteer (created with the defaults on first use)
+    static SectorGazetteer* getShared();
+    
+    // Delete the process-wide gazetteer
+    static void destroyShared();
+};
+
+#endif // SECTORGAZETTEER_H
@@ -0,0 +1,66 @@
+#include "StringDictionary.h"
+#include <cstdint>
+using namespace std;
+
+// StringDictionary Implementation
+StringDictionary::StringDictionary(int initialCapacity) : valueCount(0) {
+    valueCapacity = (initialCapacity > 0) ? initialCapacity : 16;
+    values = new string[valueCapacity];
+    codeTable = new HashTable(31);
+}
+
+StringDictionary::~StringDictionary() {
+    delete[] values;
+    delete codeTable;
+    values = nullptr;
+    codeTable = nullptr;
+}
+
+int StringDictionary::encode(const string& value) {
+    if (value.empty()) return -1;
+    
+    int code = find(value);
+    if (code != -1) return code;
+    
+    if (valueCount >= valueCapacity) {
+        int newCapacity = valueCapacity * 2;
+        string* newValues = new string[newCapacity];
+        for (int i = 0; i < valueCount; i++) {
+            newValues[i].swap(values[i]);
+        }
+        delete[] values;
+        values = newValues;
+        valueCapacity = newCapacity;
+    }
+    
+    code = valueCount++;
+    values[code] = value;
+    // Stored as code + 1 so that code 0 is not mistaken for a missing key
+    codeTable->insert(value, (void*)(intptr_t)(code + 1));
+    return code;
+}
+
+int StringDictionary::find(const string& value) const {
+    if (value.empty()) return -1;
+    
+    void* data = codeTable->search(value);
+    if (data == nullptr) return -1;
+    return (int)(intptr_t)data - 1;
+}
+
+string StringDictionary::decode(int code) const {
+    if (code < 0 || code >= valueCount) return "";
+    return values[code];
+}
+
+int StringDictionary::size() const {
+    return valueCount;
+}
+
+void StringDictionary::clear() {
+    for (int i = 0; i < valueCount; i++) {
+        values[i].clear();
+    }
+    valueCount = 0;
+    codeTable->clear();
+}
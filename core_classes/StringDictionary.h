@@ -0,0 +1,52 @@
+#ifndef STRINGDICTIONARY_H
+#define STRINGDICTIONARY_H
+
+#include <string>
+#include "HashTable.h"
+using namespace std;
+
+// StringDictionary class - Dictionary encoding of repeated strings as dense integer codes
+// Used for: Gender, occupation and sector columns of the citizen table
+// Codes are assigned 0, 1, 2, ... in first-seen order and never change, so a column of
+// codes can be compared, counted and grouped without touching the strings.
+class StringDictionary {
+private:
+    HashTable* codeTable;     // Value → code + 1 (stored in the void* payload)
+    string* values;           // Values by code
+    int valueCount;
+    int valueCapacity;
+
+public:
+    // Constructor
+    // Complexity: O(1)
+    StringDictionary(int initialCapacity = 16);
+    
+    // Destructor
+    // Complexity: O(n)
+    ~StringDictionary();
+    
+    // Get the code of a value, adding it if new
+    // Returns: code, -1 if value is empty
+    // Complexity: O(m) average where m is the value length
+    int encode(const string& value);
+    
+    // Get the code of a value without adding it
+    // Returns: code, -1 if not in the dictionary
+    // Complexity: O(m) average
+    int find(const string& value) const;
+    
+    // Get the value of a code
+    // Returns: empty string if code is out of range
+    // Complexity: O(1)
+    string decode(int code) const;
+    
+    // Get number of distinct values (codes are 0 .. size - 1)
+    // Complexity: O(1)
+    int size() const;
+    
+    // Remove every value
+    // Complexity: O(n)
+    void clear();
+};
+
+#endif // STRINGDICTIONARY_H
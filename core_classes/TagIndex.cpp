@@ -0,0 +1,422 @@
+#include "TagIndex.h"
+using namespace std;
+
+// Number of tags stored per bitset word
+const int TAG_BITS_PER_WORD = 64;
+
+// TagTerm Implementation
+TagTerm::TagTerm(const string& k, const string& l, int id) : key(k), label(l), tagID(id), rowCount(0), rowCapacity(4) {
+    rows = new int[rowCapacity];
+}
+
+TagTerm::~TagTerm() {
+    delete[] rows;
+    rows = nullptr;
+}
+
+// TagEntity Implementation
+TagEntity::TagEntity(const string& id, void* d, int r) : entityID(id), data(d), row(r) {
+}
+
+// TagIndex Implementation
+TagIndex::TagIndex(int initialEntities)
+    : tagCount(0), tagCapacity(16), entityCount(0), wordsPerRow(1), currentStamp(0) {
+    entityCapacity = (initialEntities > 0) ? initialEntities : 16;
+    tagTable = new HashTable(31);
+    tags = new TagTerm*[tagCapacity];
+    entityTable = new HashTable(31);
+    entities = new TagEntity*[entityCapacity];
+    bits = new unsigned long long[entityCapacity * wordsPerRow];
+    visitStamps = new int[entityCapacity];
+}
+
+TagIndex::~TagIndex() {
+    clear();
+    delete tagTable;
+    delete entityTable;
+    delete[] tags;
+    delete[] entities;
+    delete[] bits;
+    delete[] visitStamps;
+}
+
+string TagIndex::normalizeTag(const string& tag) {
+    int start = 0;
+    int end = (int)tag.length() - 1;
+    while (start <= end && (tag[start] == ' ' || tag[start] == '\t' || tag[start] == '"')) start++;
+    while (end >= start && (tag[end] == ' ' || tag[end] == '\t' || tag[end] == '"' ||
+                            tag[end] == '\r' || tag[end] == '\n')) end--;
+    
+    string result = "";
+    for (int i = start; i <= end; i++) {
+        char c = tag[i];
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        result += c;
+    }
+    return result;
+}
+
+TagTerm* TagIndex::internTag(const string& label) {
+    string key = normalizeTag(label);
+    if (key.empty()) return nullptr;
+    
+    TagTerm* term = (TagTerm*)tagTable->search(key);
+    if (term != nullptr) return term;
+    
+    if (tagCount >= tagCapacity) {
+        int newCapacity = tagCapacity * 2;
+        TagTerm** newTags = new TagTerm*[newCapacity];
+        for (int i = 0; i < tagCount; i++) {
+            newTags[i] = tags[i];
+        }
+        delete[] tags;
+        tags = newTags;
+        tagCapacity = newCapacity;
+    }
+    if (tagCount >= wordsPerRow * TAG_BITS_PER_WORD) {
+        growBitsets(wordsPerRow * 2);
+    }
+    
+    // Keep the label as written (minus surrounding spaces/quotes)
+    int start = 0;
+    int end = (int)label.length() - 1;
+    while (start <= end && (label[start] == ' ' || label[start] == '\t' || label[start] == '"')) start++;
+    while (end >= start && (label[end] == ' ' || label[end] == '\t' || label[end] == '"' ||
+                            label[end] == '\r' || label[end] == '\n')) end--;
+    
+    term = new TagTerm(key, label.substr(start, end - start + 1), tagCount);
+    tags[tagCount++] = term;
+    tagTable->insert(key, term);
+    return term;
+}
+
+void TagIndex::ensureEntityCapacity() {
+    if (entityCount < entityCapacity) return;
+    
+    int newCapacity = entityCapacity * 2;
+    TagEntity** newEntities = new TagEntity*[newCapacity];
+    unsigned long long* newBits = new unsigned long long[newCapacity * wordsPerRow];
+    int* newStamps = new int[newCapacity];
+    for (int i = 0; i < entityCount; i++) {
+        newEntities[i] = entities[i];
+        newStamps[i] = visitStamps[i];
+    }
+    for (int i = 0; i < entityCount * wordsPerRow; i++) {
+        newBits[i] = bits[i];
+    }
+    
+    delete[] entities;
+    delete[] bits;
+    delete[] visitStamps;
+    entities = newEntities;
+    bits = newBits;
+    visitStamps = newStamps;
+    entityCapacity = newCapacity;
+}
+
+void TagIndex::growBitsets(int newWords) {
+    unsigned long long* newBits = new unsigned long long[entityCapacity * newWords];
+    for (int row = 0; row < entityCount; row++) {
+        for (int w = 0; w < newWords; w++) {
+            newBits[row * newWords + w] = (w < wordsPerRow) ? bits[row * wordsPerRow + w] : 0ULL;
+        }
+    }
+    delete[] bits;
+    bits = newBits;
+    wordsPerRow = newWords;
+}
+
+void TagIndex::removeRowFromTag(TagTerm* term, int row) {
+    for (int i = 0; i < term->rowCount; i++) {
+        if (term->rows[i] == row) {
+            for (int j = i; j < term->rowCount - 1; j++) {
+                term->rows[j] = term->rows[j + 1];
+            }
+            term->rowCount--;
+            return;
+        }
+    }
+}
+
+bool TagIndex::setEntityTags(const string& entityID, const string& tagList, void* data) {
+    if (entityID.empty()) return false;
+    
+    TagEntity* entity = (TagEntity*)entityTable->search(entityID);
+    if (entity == nullptr) {
+        ensureEntityCapacity();
+        entity = new TagEntity(entityID, data, entityCount);
+        entities[entityCount] = entity;
+        visitStamps[entityCount] = 0;
+        entityCount++;
+        entityTable->insert(entityID, entity);
+    } else {
+        // Replacing tags: leave the old posting lists first
+        entity->data = data;
+        unsigned long long* rowBits = &bits[entity->row * wordsPerRow];
+        for (int t = 0; t < tagCount; t++) {
+            if (rowBits[t / TAG_BITS_PER_WORD] & (1ULL << (t % TAG_BITS_PER_WORD))) {
+                removeRowFromTag(tags[t], entity->row);
+            }
+        }
+    }
+    
+    // Intern every tag first: the bitset width may grow while doing so
+    int start = 0;
+    int length = (int)tagList.length();
+    int* tagIDs = new int[length / 2 + 1];
+    int tagIDCount = 0;
+    for (int i = 0; i <= length; i++) {
+        if (i == length || tagList[i] == ',') {
+            TagTerm* term = internTag(tagList.substr(start, i - start));
+            if (term != nullptr) {
+                tagIDs[tagIDCount++] = term->tagID;
+            }
+            start = i + 1;
+        }
+    }
+    
+    unsigned long long* rowBits = &bits[entity->row * wordsPerRow];
+    for (int w = 0; w < wordsPerRow; w++) {
+        rowBits[w] = 0ULL;
+    }
+    for (int i = 0; i < tagIDCount; i++) {
+        int t = tagIDs[i];
+        unsigned long long bit = 1ULL << (t % TAG_BITS_PER_WORD);
+        if (rowBits[t / TAG_BITS_PER_WORD] & bit) continue; // Tag listed twice
+        
+        rowBits[t / TAG_BITS_PER_WORD] |= bit;
+        TagTerm* term = tags[t];
+        if (term->rowCount >= term->rowCapacity) {
+            int newCapacity = term->rowCapacity * 2;
+            int* newRows = new int[newCapacity];
+            for (int j = 0; j < term->rowCount; j++) {
+                newRows[j] = term->rows[j];
+            }
+            delete[] term->rows;
+            term->rows = newRows;
+            term->rowCapacity = newCapacity;
+        }
+        
+        // Rows are appended in registration order; a re-tagged entity is slotted back in place
+        int pos = term->rowCount;
+        while (pos > 0 && term->rows[pos - 1] > entity->row) {
+            term->rows[pos] = term->rows[pos - 1];
+            pos--;
+        }
+        term->rows[pos] = entity->row;
+        term->rowCount++;
+    }
+    
+    delete[] tagIDs;
+    return true;
+}
+
+int TagIndex::compileQuery(const string& query, bool matchTagsInQuery, unsigned long long*& masks,
+                           int*& candidateTags, int& candidateTagCount) {
+    masks = nullptr;
+    candidateTags = nullptr;
+    candidateTagCount = 0;
+    
+    // Count query tags
+    int groupCapacity = 1;
+    for (int i = 0; i < (int)query.length(); i++) {
+        if (query[i] == ',') groupCapacity++;
+    }
+    
+    masks = new unsigned long long[groupCapacity * wordsPerRow];
+    candidateTags = new int[tagCount > 0 ? tagCount : 1];
+    int* groupTags = new int[tagCount > 0 ? tagCount : 1];
+    int groupCount = 0;
+    int bestPostingSize = -1;
+    
+    int start = 0;
+    int length = (int)query.length();
+    for (int i = 0; i <= length; i++) {
+        if (i != length && query[i] != ',') continue;
+        
+        string key = normalizeTag(query.substr(start, i - start));
+        start = i + 1;
+        if (key.empty()) continue;
+        
+        unsigned long long* mask = &masks[groupCount * wordsPerRow];
+        for (int w = 0; w < wordsPerRow; w++) {
+            mask[w] = 0ULL;
+        }
+        
+        // Every tag containing the query text (the exact tag included), and optionally every
+        // tag the query text contains
+        int groupTagCount = 0;
+        for (int t = 0; t < tagCount; t++) {
+            if (tags[t]->key.find(key) != string::npos ||
+                (matchTagsInQuery && key.find(tags[t]->key) != string::npos)) {
+                groupTags[groupTagCount++] = t;
+            }
+        }
+        
+        if (groupTagCount == 0) {
+            // Nothing can match this query tag
+            delete[] masks;
+            delete[] candidateTags;
+            delete[] groupTags;
+            masks = nullptr;
+            candidateTags = nullptr;
+            candidateTagCount = 0;
+            return 0;
+        }
+        
+        int postingSize = 0;
+        for (int g = 0; g < groupTagCount; g++) {
+            int t = groupTags[g];
+            mask[t / TAG_BITS_PER_WORD] |= 1ULL << (t % TAG_BITS_PER_WORD);
+            postingSize += tags[t]->rowCount;
+        }
+        if (bestPostingSize < 0 || postingSize < bestPostingSize) {
+            bestPostingSize = postingSize;
+            candidateTagCount = groupTagCount;
+            for (int g = 0; g < groupTagCount; g++) {
+                candidateTags[g] = groupTags[g];
+            }
+        }
+        groupCount++;
+    }
+    
+    delete[] groupTags;
+    if (groupCount == 0) {
+        delete[] masks;
+        delete[] candidateTags;
+        masks = nullptr;
+        candidateTags = nullptr;
+        candidateTagCount = 0;
+    }
+    return groupCount;
+}
+
+bool TagIndex::rowMatches(int row, const unsigned long long* masks, int groupCount) const {
+    const unsigned long long* rowBits = &bits[row * wordsPerRow];
+    for (int g = 0; g < groupCount; g++) {
+        const unsigned long long* mask = &masks[g * wordsPerRow];
+        bool hit = false;
+        for (int w = 0; w < wordsPerRow && !hit; w++) {
+            hit = (rowBits[w] & mask[w]) != 0ULL;
+        }
+        if (!hit) return false;
+    }
+    return true;
+}
+
+int* TagIndex::matchRows(const string& query, bool matchTagsInQuery, int& count) {
+    count = 0;
+    unsigned long long* masks = nullptr;
+    int* candidateTags = nullptr;
+    int candidateTagCount = 0;
+    int groupCount = compileQuery(query, matchTagsInQuery, masks, candidateTags, candidateTagCount);
+    if (groupCount == 0) return nullptr;
+    
+    int candidateTotal = 0;
+    for (int c = 0; c < candidateTagCount; c++) {
+        candidateTotal += tags[candidateTags[c]]->rowCount;
+    }
+    
+    // Walk only the rarest query tag's posting lists, de-duplicating rows shared by alternatives
+    int* matchedRows = new int[candidateTotal > 0 ? candidateTotal : 1];
+    currentStamp++;
+    for (int c = 0; c < candidateTagCount; c++) {
+        TagTerm* term = tags[candidateTags[c]];
+        for (int i = 0; i < term->rowCount; i++) {
+            int row = term->rows[i];
+            if (visitStamps[row] == currentStamp) continue;
+            visitStamps[row] = currentStamp;
+            if (rowMatches(row, masks, groupCount)) {
+                matchedRows[count++] = row;
+            }
+        }
+    }
+    
+    // Alternatives are merged out of order; restore insertion order (posting lists are short)
+    if (candidateTagCount > 1) {
+        for (int i = 1; i < count; i++) {
+            int row = matchedRows[i];
+            int j = i;
+            while (j > 0 && matchedRows[j - 1] > row) {
+                matchedRows[j] = matchedRows[j - 1];
+                j--;
+            }
+            matchedRows[j] = row;
+        }
+    }
+    
+    delete[] masks;
+    delete[] candidateTags;
+    if (count == 0) {
+        delete[] matchedRows;
+        return nullptr;
+    }
+    return matchedRows;
+}
+
+void** TagIndex::findEntities(const string& query, int& count, bool matchTagsInQuery) {
+    int* rows = matchRows(query, matchTagsInQuery, count);
+    if (rows == nullptr) return nullptr;
+    
+    void** result = new void*[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = entities[rows[i]]->data;
+    }
+    delete[] rows;
+    return result;
+}
+
+string* TagIndex::findEntityIDs(const string& query, int& count, bool matchTagsInQuery) {
+    int* rows = matchRows(query, matchTagsInQuery, count);
+    if (rows == nullptr) return nullptr;
+    
+    string* result = new string[count];
+    for (int i = 0; i < count; i++) {
+        result[i] = entities[rows[i]]->entityID;
+    }
+    delete[] rows;
+    return result;
+}
+
+bool TagIndex::entityMatches(const string& entityID, const string& query) {
+    TagEntity* entity = (TagEntity*)entityTable->search(entityID);
+    if (entity == nullptr) return false;
+    
+    unsigned long long* masks = nullptr;
+    int* candidateTags = nullptr;
+    int candidateTagCount = 0;
+    int groupCount = compileQuery(query, false, masks, candidateTags, candidateTagCount);
+    if (groupCount == 0) return false;
+    
+    bool matches = rowMatches(entity->row, masks, groupCount);
+    delete[] masks;
+    delete[] candidateTags;
+    return matches;
+}
+
+int TagIndex::getTagCount() const {
+    return tagCount;
+}
+
+int TagIndex::getEntityCount() const {
+    return entityCount;
+}
+
+string TagIndex::getTagLabel(int tagID) const {
+    if (tagID < 0 || tagID >= tagCount) return "";
+    return tags[tagID]->label;
+}
+
+void TagIndex::clear() {
+    for (int i = 0; i < tagCount; i++) {
+        delete tags[i];
+    }
+    for (int i = 0; i < entityCount; i++) {
+        delete entities[i];
+    }
+    tagCount = 0;
+    entityCount = 0;
+    currentStamp = 0;
+    tagTable->clear();
+    entityTable->clear();
+}
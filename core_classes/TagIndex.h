@@ -0,0 +1,130 @@
+#ifndef TAGINDEX_H
+#define TAGINDEX_H
+
+#include <string>
+#include "HashTable.h"
+using namespace std;
+
+// Structure for an interned tag (e.g., one specialization)
+struct TagTerm {
+    string key;               // Normalized tag used for lookup (e.g., "cardiology")
+    string label;             // Tag as first seen (e.g., "Cardiology")
+    int tagID;                // Bit position in every entity's bitset
+    int* rows;                // Posting list: entity rows carrying this tag (in insertion order)
+    int rowCount;             // Number of rows in the posting list
+    int rowCapacity;          // Allocated size of rows array
+    
+    TagTerm(const string& k, const string& l, int id);
+    ~TagTerm();
+};
+
+// Structure for an entity registered in the index (e.g., one hospital)
+struct TagEntity {
+    string entityID;          // Key of the entity (e.g., HospitalID)
+    void* data;               // Pointer to the entity (not owned)
+    int row;                  // Row of the entity's bitset
+    
+    TagEntity(const string& id, void* d, int r);
+};
+
+// TagIndex class - Interned vocabulary with a per-entity bitset and a tag → entity posting list
+// Used for: Hospital and doctor specializations ("General, Cardiology")
+// Tag lists are comma separated; tags are matched case-insensitively after trimming.
+// A query "Cardiology, Surgery" matches entities carrying every query tag (bitwise AND).
+// Each query tag is resolved against the vocabulary to every tag containing it, and those
+// alternatives are OR-ed (e.g., "Surgery" also matches "Neurosurgery", "Cardio" matches
+// "Cardiology"). Callers can also ask for tags contained in the query tag (the reverse direction).
+class TagIndex {
+private:
+    HashTable* tagTable;          // Normalized tag → TagTerm*
+    TagTerm** tags;               // Tags by tagID
+    int tagCount;
+    int tagCapacity;
+    
+    HashTable* entityTable;       // EntityID → TagEntity*
+    TagEntity** entities;         // Entities by row
+    int entityCount;
+    int entityCapacity;
+    
+    unsigned long long* bits;     // Row-major bitsets: wordsPerRow words per entity
+    int wordsPerRow;              // 64 tags per word
+    
+    int* visitStamps;             // Per-row stamp to de-duplicate candidates during a query
+    int currentStamp;
+    
+    // Normalize a tag for lookup (trim spaces/quotes, lower case)
+    static string normalizeTag(const string& tag);
+    
+    // Get the tag for a label, interning it if new
+    // Complexity: O(1) average, O(n × w) when the bitset width grows
+    TagTerm* internTag(const string& label);
+    
+    // Grow entity arrays to hold at least one more row
+    void ensureEntityCapacity();
+    
+    // Widen every bitset to hold newWords words
+    // Complexity: O(n × w) where n is number of entities
+    void growBitsets(int newWords);
+    
+    // Remove a row from a tag's posting list (keeps order)
+    static void removeRowFromTag(TagTerm* term, int row);
+    
+    // Compile a query into one mask per query tag (a group of alternative tags)
+    // Parameters: matchTagsInQuery - also accept tags contained in the query tag
+    // Returns: number of groups, 0 if the query is empty or a query tag matches nothing
+    //          masks (groupCount × wordsPerRow words) and candidateTags (tags of the group with the
+    //          smallest posting lists, used to enumerate candidates) - caller must delete[] both
+    int compileQuery(const string& query, bool matchTagsInQuery, unsigned long long*& masks, int*& candidateTags,
+                     int& candidateTagCount);
+    
+    // Check a row's bitset against compiled masks
+    bool rowMatches(int row, const unsigned long long* masks, int groupCount) const;
+    
+    // Find the rows of entities carrying every tag in the query
+    // Returns: Array of rows in insertion order (caller must delete[]), and count
+    int* matchRows(const string& query, bool matchTagsInQuery, int& count);
+
+public:
+    // Constructor
+    // Complexity: O(1)
+    TagIndex(int initialEntities = 16);
+    
+    // Destructor
+    // Complexity: O(n + t) where t is number of tags
+    ~TagIndex();
+    
+    // Add an entity or replace its tags
+    // Parameters: entityID, tagList (comma separated), data (stored pointer, not owned)
+    // Returns: false if entityID is empty
+    // Complexity: O(k) average for k tags (O(p) per tag to leave old posting lists on replace)
+    bool setEntityTags(const string& entityID, const string& tagList, void* data = nullptr);
+    
+    // Find entities carrying every tag in the query
+    // Parameters: matchTagsInQuery - a query tag also matches tags it contains
+    //             (e.g., "Pediatric Cardiology" matches an entity tagged "Cardiology")
+    // Returns: Array of entity data pointers in insertion order (caller must delete[]), and count
+    // Complexity: O(t × q + p × q) where t is number of tags, p is the rarest query tag's posting size,
+    //             q is number of query tags
+    void** findEntities(const string& query, int& count, bool matchTagsInQuery = false);
+    
+    // Find entities carrying every tag in the query
+    // Returns: Array of entity IDs in insertion order (caller must delete[]), and count
+    // Complexity: same as findEntities
+    string* findEntityIDs(const string& query, int& count, bool matchTagsInQuery = false);
+    
+    // Check whether one entity carries every tag in the query
+    // Complexity: O(q) after compiling the query
+    bool entityMatches(const string& entityID, const string& query);
+    
+    // Get the number of distinct tags / entities
+    int getTagCount() const;
+    int getEntityCount() const;
+    
+    // Get a tag's label by ID (empty string if out of range)
+    string getTagLabel(int tagID) const;
+    
+    // Remove all entities and tags
+    void clear();
+};
+
+#endif // TAGINDEX_H
@@ -0,0 +1,607 @@
+#include "Timetable.h"
+#include <cstdint>
+using namespace std;
+
+// JourneyLeg / Journey Implementation
+JourneyLeg::JourneyLeg()
+    : route(WALK), trip(-1), fromStop(-1), toStop(-1), departure(0), arrival(0) {}
+
+Journey::Journey(int capacity)
+    : legCount(0), legCapacity((capacity > 0) ? capacity : 1), departure(0), arrival(0), rides(0) {
+    legs = new JourneyLeg[legCapacity];
+}
+
+Journey::~Journey() {
+    delete[] legs;
+}
+
+JourneyLeg& Journey::addLeg() {
+    if (legCount == legCapacity) {
+        legCapacity *= 2;
+        JourneyLeg* grown = new JourneyLeg[legCapacity];
+        for (int i = 0; i < legCount; i++) {
+            grown[i] = legs[i];
+        }
+        delete[] legs;
+        legs = grown;
+    }
+    return legs[legCount++];
+}
+
+// Helper: grow an int array to newCapacity (doubling handled by callers)
+static int* growInts(int* values, int count, int newCapacity) {
+    int* grown = new int[newCapacity];
+    for (int i = 0; i < count; i++) {
+        grown[i] = values[i];
+    }
+    delete[] values;
+    return grown;
+}
+
+// Helper: binary min-heap of (time, stop) for the walking phase of a round
+// (outdated entries are skipped when popped, as in Graph's Dijkstra)
+struct TimetableHeap {
+    int* times;               // Arrival time of each entry
+    int* stops;               // Stop index of each entry
+    int size;                 // Current number of entries
+    int capacity;             // Allocated size of the arrays
+    
+    TimetableHeap(int cap) : size(0), capacity(cap < 1 ? 1 : cap) {
+        times = new int[capacity];
+        stops = new int[capacity];
+    }
+    
+    ~TimetableHeap() {
+        delete[] times;
+        delete[] stops;
+    }
+    
+    void push(int time, int stop) {
+        if (size >= capacity) {
+            capacity *= 2;
+            times = growInts(times, size, capacity);
+            stops = growInts(stops, size, capacity);
+        }
+        
+        // Bubble up
+        int index = size++;
+        while (index > 0) {
+            int parentIndex = (index - 1) / 2;
+            if (times[parentIndex] <= time) break;
+            times[index] = times[parentIndex];
+            stops[index] = stops[parentIndex];
+            index = parentIndex;
+        }
+        times[index] = time;
+        stops[index] = stop;
+    }
+    
+    bool pop(int& time, int& stop) {
+        if (size == 0) return false;
+        
+        time = times[0];
+        stop = stops[0];
+        size--;
+        if (size == 0) return true;
+        
+        // Bubble down the last element from the root
+        int lastTime = times[size];
+        int lastStop = stops[size];
+        int index = 0;
+        while (true) {
+            int child = 2 * index + 1;
+            if (child >= size) break;
+            if (child + 1 < size && times[child + 1] < times[child]) child++;
+            if (times[child] >= lastTime) break;
+            times[index] = times[child];
+            stops[index] = stops[child];
+            index = child;
+        }
+        times[index] = lastTime;
+        stops[index] = lastStop;
+        return true;
+    }
+};
+
+// Timetable Implementation
+Timetable::Timetable()
+    : stopIDs(nullptr), stopNames(nullptr), stopCount(0), stopCapacity(0),
+      routeNames(nullptr), routeModes(nullptr), routeStopStart(nullptr), routeStopCount(nullptr),
+      routeTimeStart(nullptr), routeTripCount(nullptr), routeCount(0), routeCapacity(0),
+      routeStops(nullptr), routeStopTotal(0), routeStopCapacity(0),
+      arrivals(nullptr), departures(nullptr), timeTotal(0), timeCapacity(0),
+      footFrom(nullptr), footTo(nullptr), footMinutes(nullptr), footKinds(nullptr), footCount(0), footCapacity(0),
+      stopRouteStart(nullptr), stopRoutes(nullptr), stopRoutePositions(nullptr),
+      stopFootStart(nullptr), stopFootTo(nullptr), stopFootMinutes(nullptr), stopFootKinds(nullptr),
+      dirty(true) {
+    stopIndex = new HashTable(101);
+}
+
+Timetable::~Timetable() {
+    delete stopIndex;
+    delete[] stopIDs;
+    delete[] stopNames;
+    delete[] routeNames;
+    delete[] routeModes;
+    delete[] routeStopStart;
+    delete[] routeStopCount;
+    delete[] routeTimeStart;
+    delete[] routeTripCount;
+    delete[] routeStops;
+    delete[] arrivals;
+    delete[] departures;
+    delete[] footFrom;
+    delete[] footTo;
+    delete[] footMinutes;
+    delete[] footKinds;
+    delete[] stopRouteStart;
+    delete[] stopRoutes;
+    delete[] stopRoutePositions;
+    delete[] stopFootStart;
+    delete[] stopFootTo;
+    delete[] stopFootMinutes;
+    delete[] stopFootKinds;
+}
+
+int Timetable::addStop(const string& stopID, const string& name) {
+    void* found = stopIndex->search(stopID);
+    if (found != nullptr) return (int)(intptr_t)found - 1;
+    
+    if (stopCount == stopCapacity) {
+        int newCapacity = (stopCapacity > 0) ? stopCapacity * 2 : 16;
+        string* newIDs = new string[newCapacity];
+        string* newNames = new string[newCapacity];
+        for (int i = 0; i < stopCount; i++) {
+            newIDs[i] = stopIDs[i];
+            newNames[i] = stopNames[i];
+        }
+        delete[] stopIDs;
+        delete[] stopNames;
+        stopIDs = newIDs;
+        stopNames = newNames;
+        stopCapacity = newCapacity;
+    }
+    
+    int stop = stopCount++;
+    stopIDs[stop] = stopID;
+    stopNames[stop] = name.empty() ? stopID : name;
+    stopIndex->insert(stopID, (void*)(intptr_t)(stop + 1));
+    dirty = true;
+    return stop;
+}
+
+int Timetable::findStop(const string& stopID) const {
+    void* found = stopIndex->search(stopID);
+    return (found != nullptr) ? (int)(intptr_t)found - 1 : -1;
+}
+
+int Timetable::addRoute(const string& name, int mode, const int* stops, int count) {
+    if (stops == nullptr || count < 2) return -1;
+    for (int i = 0; i < count; i++) {
+        if (stops[i] < 0 || stops[i] >= stopCount) return -1;
+    }
+    
+    if (routeCount == routeCapacity) {
+        int newCapacity = (routeCapacity > 0) ? routeCapacity * 2 : 16;
+        string* newNames = new string[newCapacity];
+        for (int i = 0; i < routeCount; i++) {
+            newNames[i] = routeNames[i];
+        }
+        delete[] routeNames;
+        routeNames = newNames;
+        routeModes = growInts(routeModes, routeCount, newCapacity);
+        routeStopStart = growInts(routeStopStart, routeCount, newCapacity);
+        routeStopCount = growInts(routeStopCount, routeCount, newCapacity);
+        routeTimeStart = growInts(routeTimeStart, routeCount, newCapacity);
+        routeTripCount = growInts(routeTripCount, routeCount, newCapacity);
+        routeCapacity = newCapacity;
+    }
+    
+    if (routeStopTotal + count > routeStopCapacity) {
+        int newCapacity = (routeStopCapacity > 0) ? routeStopCapacity : 64;
+        while (newCapacity < routeStopTotal + count) newCapacity *= 2;
+        routeStops = growInts(routeStops, routeStopTotal, newCapacity);
+        routeStopCapacity = newCapacity;
+    }
+    
+    int route = routeCount++;
+    routeNames[route] = name;
+    routeModes[route] = mode;
+    routeStopStart[route] = routeStopTotal;
+    routeStopCount[route] = count;
+    routeTimeStart[route] = timeTotal;
+    routeTripCount[route] = 0;
+    for (int i = 0; i < count; i++) {
+        routeStops[routeStopTotal++] = stops[i];
+    }
+    dirty = true;
+    return route;
+}
+
+bool Timetable::addTrip(int route, const int* tripArrivals, const int* tripDepartures) {
+    if (route < 0 || route != routeCount - 1) return false;
+    if (tripArrivals == nullptr || tripDepartures == nullptr) return false;
+    
+    int count = routeStopCount[route];
+    for (int i = 0; i < count; i++) {
+        if (tripDepartures[i] < tripArrivals[i]) return false;
+        if (i + 1 < count && tripArrivals[i + 1] < tripDepartures[i]) return false;
+    }
+    
+    // FIFO: the new trip may not overtake the previous one anywhere on the route
+    int trips = routeTripCount[route];
+    if (trips > 0) {
+        int last = routeTimeStart[route] + (trips - 1) * count;
+        for (int i = 0; i < count; i++) {
+            if (tripArrivals[i] < arrivals[last + i] || tripDepartures[i] < departures[last + i]) {
+                return false;
+            }
+        }
+    }
+    
+    if (timeTotal + count > timeCapacity) {
+        int newCapacity = (timeCapacity > 0) ? timeCapacity : 256;
+        while (newCapacity < timeTotal + count) newCapacity *= 2;
+        arrivals = growInts(arrivals, timeTotal, newCapacity);
+        departures = growInts(departures, timeTotal, newCapacity);
+        timeCapacity = newCapacity;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        arrivals[timeTotal] = tripArrivals[i];
+        departures[timeTotal] = tripDepartures[i];
+        timeTotal++;
+    }
+    routeTripCount[route]++;
+    return true;
+}
+
+bool Timetable::addFootpath(int fromStop, int toStop, int minutes, int kind) {
+    if (fromStop < 0 || fromStop >= stopCount || toStop < 0 || toStop >= stopCount) return false;
+    if (minutes < 0 || fromStop == toStop) return false;
+    if (kind != JourneyLeg::WALK && kind != JourneyLeg::ACCESS) return false;
+    
+    if (footCount == footCapacity) {
+        int newCapacity = (footCapacity > 0) ? footCapacity * 2 : 64;
+        footFrom = growInts(footFrom, footCount, newCapacity);
+        footTo = growInts(footTo, footCount, newCapacity);
+        footMinutes = growInts(footMinutes, footCount, newCapacity);
+        footKinds = growInts(footKinds, footCount, newCapacity);
+        footCapacity = newCapacity;
+    }
+    
+    footFrom[footCount] = fromStop;
+    footTo[footCount] = toStop;
+    footMinutes[footCount] = minutes;
+    footKinds[footCount] = kind;
+    footCount++;
+    dirty = true;
+    return true;
+}
+
+void Timetable::prepare() {
+    delete[] stopRouteStart;
+    delete[] stopRoutes;
+    delete[] stopRoutePositions;
+    delete[] stopFootStart;
+    delete[] stopFootTo;
+    delete[] stopFootMinutes;
+    delete[] stopFootKinds;
+    
+    // Counting sort of (route, position) entries by stop
+    stopRouteStart = new int[stopCount + 1];
+    for (int s = 0; s <= stopCount; s++) stopRouteStart[s] = 0;
+    for (int i = 0; i < routeStopTotal; i++) stopRouteStart[routeStops[i] + 1]++;
+    for (int s = 0; s < stopCount; s++) stopRouteStart[s + 1] += stopRouteStart[s];
+    
+    stopRoutes = new int[(routeStopTotal > 0) ? routeStopTotal : 1];
+    stopRoutePositions = new int[(routeStopTotal > 0) ? routeStopTotal : 1];
+    int* fill = new int[(stopCount > 0) ? stopCount : 1];
+    for (int s = 0; s < stopCount; s++) fill[s] = stopRouteStart[s];
+    for (int r = 0; r < routeCount; r++) {
+        for (int p = 0; p < routeStopCount[r]; p++) {
+            int stop = routeStops[routeStopStart[r] + p];
+            stopRoutes[fill[stop]] = r;
+            stopRoutePositions[fill[stop]] = p;
+            fill[stop]++;
+        }
+    }
+    
+    // Same for footpaths by origin stop
+    stopFootStart = new int[stopCount + 1];
+    for (int s = 0; s <= stopCount; s++) stopFootStart[s] = 0;
+    for (int i = 0; i < footCount; i++) stopFootStart[footFrom[i] + 1]++;
+    for (int s = 0; s < stopCount; s++) stopFootStart[s + 1] += stopFootStart[s];
+    
+    stopFootTo = new int[(footCount > 0) ? footCount : 1];
+    stopFootMinutes = new int[(footCount > 0) ? footCount : 1];
+    stopFootKinds = new int[(footCount > 0) ? footCount : 1];
+    for (int s = 0; s < stopCount; s++) fill[s] = stopFootStart[s];
+    for (int i = 0; i < footCount; i++) {
+        int slot = fill[footFrom[i]]++;
+        stopFootTo[slot] = footTo[i];
+        stopFootMinutes[slot] = footMinutes[i];
+        stopFootKinds[slot] = footKinds[i];
+    }
+    
+    delete[] fill;
+    dirty = false;
+}
+
+int Timetable::findTrip(int route, int position, int time) const {
+    int count = routeStopCount[route];
+    int base = routeTimeStart[route] + position;
+    int low = 0, high = routeTripCount[route];
+    
+    // Departures at a position are non-decreasing by trip (FIFO), so binary search works
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (departures[base + mid * count] < time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return (low < routeTripCount[route]) ? low : -1;
+}
+
+Journey* Timetable::earliestArrival(int source, int target, int departureTime, int maxRounds) {
+    if (source < 0 || source >= stopCount || target < 0 || target >= stopCount) return nullptr;
+    if (maxRounds < 1) maxRounds = 1;
+    if (dirty) prepare();
+    
+    // Per-round labels, [round × stopCount + stop]. A stop can be improved by a ride and,
+    // separately, by a walk in the same round; keeping both lets a walk backtrack through
+    // the stops it passed to the ride it started from (or to the source in round 0).
+    int rounds = maxRounds + 1;
+    int cells = rounds * stopCount;
+    int* rideArrival = new int[cells];
+    int* rideRoute = new int[cells];
+    int* rideTrip = new int[cells];
+    int* rideBoard = new int[cells];
+    int* rideDeparture = new int[cells];
+    int* walkArrival = new int[cells];
+    int* walkFrom = new int[cells];
+    int* walkKind = new int[cells];           // Kind of the footpath that set walkArrival
+    for (int i = 0; i < cells; i++) {
+        rideArrival[i] = INFINITE_TIME;
+        walkArrival[i] = INFINITE_TIME;
+    }
+    
+    int* best = new int[stopCount];           // Earliest arrival over all rounds so far
+    bool* marked = new bool[stopCount];
+    int* markedStops = new int[stopCount];
+    int* rideStops = new int[stopCount];      // Stops improved by a ride this round
+    int* queuePosition = new int[(routeCount > 0) ? routeCount : 1];
+    int* queuedRoutes = new int[(routeCount > 0) ? routeCount : 1];
+    for (int s = 0; s < stopCount; s++) {
+        best[s] = INFINITE_TIME;
+        marked[s] = false;
+    }
+    for (int r = 0; r < routeCount; r++) queuePosition[r] = -1;
+    TimetableHeap heap(stopCount + 1);
+    
+    // Round 0 is the source itself; its walking phase below adds the stops it can walk to
+    int markedCount = 0;
+    int rideCount = 0;
+    int bestRound = 0;
+    rideArrival[source] = departureTime;
+    best[source] = departureTime;
+    marked[source] = true;
+    markedStops[markedCount++] = source;
+    rideStops[rideCount++] = source;
+    
+    for (int k = 0; k < rounds && markedCount > 0; k++) {
+        int roundBase = k * stopCount;
+        
+        if (k > 0) {
+            int* previousRide = rideArrival + (k - 1) * stopCount;
+            int* previousWalk = walkArrival + (k - 1) * stopCount;
+            
+            // Queue every route through a marked stop, from the earliest marked position
+            int queuedCount = 0;
+            for (int m = 0; m < markedCount; m++) {
+                int stop = markedStops[m];
+                marked[stop] = false;
+                for (int e = stopRouteStart[stop]; e < stopRouteStart[stop + 1]; e++) {
+                    int route = stopRoutes[e];
+                    int position = stopRoutePositions[e];
+                    if (queuePosition[route] < 0) {
+                        queuePosition[route] = position;
+                        queuedRoutes[queuedCount++] = route;
+                    } else if (position < queuePosition[route]) {
+                        queuePosition[route] = position;
+                    }
+                }
+            }
+            markedCount = 0;
+            rideCount = 0;
+            
+            // Scan each queued route once, hopping onto an earlier trip wherever possible
+            for (int q = 0; q < queuedCount; q++) {
+                int route = queuedRoutes[q];
+                int start = queuePosition[route];
+                queuePosition[route] = -1;
+                
+                const int* stops = routeStops + routeStopStart[route];
+                int count = routeStopCount[route];
+                int trip = -1;
+                int tripBase = 0;
+                int boardStop = -1;
+                int boardDeparture = 0;
+                
+                for (int p = start; p < count; p++) {
+                    int stop = stops[p];
+                    
+                    if (trip >= 0) {
+                        int arrival = arrivals[tripBase + p];
+                        if (arrival < best[stop] && arrival < best[target]) {
+                            int cell = roundBase + stop;
+                            rideArrival[cell] = arrival;
+                            rideRoute[cell] = route;
+                            rideTrip[cell] = trip;
+                            rideBoard[cell] = boardStop;
+                            rideDeparture[cell] = boardDeparture;
+                            best[stop] = arrival;
+                            if (stop == target) bestRound = k;
+                            if (!marked[stop]) {
+                                marked[stop] = true;
+                                markedStops[markedCount++] = stop;
+                                rideStops[rideCount++] = stop;
+                            }
+                        }
+                    }
+                    
+                    int reached = previousRide[stop];
+                    if (previousWalk[stop] < reached) reached = previousWalk[stop];
+                    if (reached < INFINITE_TIME && (trip < 0 || reached <= departures[tripBase + p])) {
+                        int earlier = findTrip(route, p, reached);
+                        if (earlier >= 0 && (trip < 0 || earlier < trip)) {
+                            trip = earlier;
+                            tripBase = routeTimeStart[route] + trip * count;
+                            boardStop = stop;
+                            boardDeparture = departures[tripBase + p];
+                        }
+                    }
+                }
+            }
+        }
+        
+        // Walk on from the stops reached by a ride this round (Dijkstra over the footpaths,
+        // so chains of footpaths work without the footpaths being transitively closed)
+        for (int i = 0; i < rideCount; i++) {
+            heap.push(rideArrival[roundBase + rideStops[i]], rideStops[i]);
+        }
+        int time = 0;
+        int stop = -1;
+        while (heap.pop(time, stop)) {
+            if (time != best[stop]) continue;
+            for (int f = stopFootStart[stop]; f < stopFootStart[stop + 1]; f++) {
+                int to = stopFootTo[f];
+                int arrival = time + stopFootMinutes[f];
+                if (arrival < best[to] && arrival < best[target]) {
+                    walkArrival[roundBase + to] = arrival;
+                    walkFrom[roundBase + to] = stop;
+                    walkKind[roundBase + to] = stopFootKinds[f];
+                    best[to] = arrival;
+                    if (to == target) bestRound = k;
+                    if (!marked[to]) {
+                        marked[to] = true;
+                        markedStops[markedCount++] = to;
+                    }
+                    heap.push(arrival, to);
+                }
+            }
+        }
+    }
+    
+    Journey* journey = nullptr;
+    if (best[target] < INFINITE_TIME) {
+        // Backtrack from the target, newest leg first, then reverse; a chain of footpaths
+        // of the same kind becomes one leg
+        journey = new Journey(2 * rounds);
+        int stop = target;
+        int k = bestRound;
+        while (true) {
+            int cell = k * stopCount + stop;
+            while (walkArrival[cell] < rideArrival[cell]) {
+                JourneyLeg& leg = journey->addLeg();
+                leg.route = walkKind[cell];
+                leg.toStop = stop;
+                leg.arrival = walkArrival[cell];
+                while (walkArrival[cell] < rideArrival[cell] && walkKind[cell] == leg.route) {
+                    stop = walkFrom[cell];
+                    cell = k * stopCount + stop;
+                }
+                leg.fromStop = stop;
+                leg.departure = (walkArrival[cell] < rideArrival[cell]) ? walkArrival[cell] : rideArrival[cell];
+            }
+            if (k == 0) break;
+            
+            JourneyLeg& leg = journey->addLeg();
+            leg.route = rideRoute[cell];
+            leg.trip = rideTrip[cell];
+            leg.fromStop = rideBoard[cell];
+            leg.toStop = stop;
+            leg.departure = rideDeparture[cell];
+            leg.arrival = rideArrival[cell];
+            journey->rides++;
+            stop = rideBoard[cell];
+            k--;
+        }
+        
+        for (int i = 0, j = journey->legCount - 1; i < j; i++, j--) {
+            JourneyLeg swap = journey->legs[i];
+            journey->legs[i] = journey->legs[j];
+            journey->legs[j] = swap;
+        }
+        journey->departure = (journey->legCount > 0) ? journey->legs[0].departure : departureTime;
+        journey->arrival = best[target];
+    }
+    
+    delete[] rideArrival;
+    delete[] rideRoute;
+    delete[] rideTrip;
+    delete[] rideBoard;
+    delete[] rideDeparture;
+    delete[] walkArrival;
+    delete[] walkFrom;
+    delete[] walkKind;
+    delete[] best;
+    delete[] marked;
+    delete[] markedStops;
+    delete[] rideStops;
+    delete[] queuePosition;
+    delete[] queuedRoutes;
+    return journey;
+}
+
+int Timetable::getStopCount() const {
+    return stopCount;
+}
+
+int Timetable::getRouteCount() const {
+    return routeCount;
+}
+
+int Timetable::getTripCount() const {
+    int trips = 0;
+    for (int r = 0; r < routeCount; r++) {
+        trips += routeTripCount[r];
+    }
+    return trips;
+}
+
+int Timetable::getFootpathCount() const {
+    return footCount;
+}
+
+string Timetable::getStopID(int stop) const {
+    if (stop < 0 || stop >= stopCount) return "";
+    return stopIDs[stop];
+}
+
+string Timetable::getStopName(int stop) const {
+    if (stop < 0 || stop >= stopCount) return "";
+    return stopNames[stop];
+}
+
+string Timetable::getRouteName(int route) const {
+    if (route < 0 || route >= routeCount) return "";
+    return routeNames[route];
+}
+
+int Timetable::getRouteMode(int route) const {
+    if (route < 0 || route >= routeCount) return -1;
+    return routeModes[route];
+}
+
+void Timetable::clear() {
+    stopIndex->clear();
+    stopCount = 0;
+    routeCount = 0;
+    routeStopTotal = 0;
+    timeTotal = 0;
+    footCount = 0;
+    dirty = true;
+}
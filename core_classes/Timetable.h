@@ -0,0 +1,169 @@
+#ifndef TIMETABLE_H
+#define TIMETABLE_H
+
+#include <string>
+#include "HashTable.h"
+using namespace std;
+
+// Structure for one leg of a journey (a ride on a route, a walk, or an access trip)
+struct JourneyLeg {
+    int route;                    // Route index, or the footpath kind (WALK / ACCESS)
+    int trip;                     // Trip index within the route (-1 for a footpath)
+    int fromStop;                 // Stop index where the leg starts
+    int toStop;                   // Stop index where the leg ends
+    int departure;                // Minutes after midnight
+    int arrival;                  // Minutes after midnight
+    
+    static const int WALK = -1;      // On foot
+    static const int ACCESS = -2;    // Taxi / access link to a stop beyond walking range
+    
+    JourneyLeg();
+};
+
+// Structure for a journey returned by Timetable::earliestArrival
+struct Journey {
+    JourneyLeg* legs;             // Legs in travel order
+    int legCount;
+    int legCapacity;
+    int departure;                // Departure of the first leg (minutes after midnight)
+    int arrival;                  // Arrival at the target (minutes after midnight)
+    int rides;                    // Number of legs that are rides (transfers = rides - 1)
+    
+    Journey(int capacity);
+    ~Journey();
+    
+    // Append a leg (the array grows by doubling)
+    JourneyLeg& addLeg();
+};
+
+// Timetable class - Scheduled routes, trips and footpaths for round-based (RAPTOR) routing
+// Used for: Earliest-arrival journeys across bus, rail and air (JourneyPlanner)
+// Everything is stored in flat arrays: a route is a stop sequence plus a block of trips
+// (trip × stop arrival/departure times); trips of a route must not overtake each other,
+// so the first usable trip at a stop is found with a binary search. Round k of a query
+// finds every stop reachable with k rides, scanning each route at most once per round, then
+// walks on along the footpaths (a small Dijkstra, so footpaths need not be transitive).
+// Stop → route and footpath lookups are packed into offset arrays (rebuilt on the first
+// query after a change).
+class Timetable {
+private:
+    // Stops
+    string* stopIDs;
+    string* stopNames;
+    HashTable* stopIndex;         // Stop ID → stop index + 1
+    int stopCount;
+    int stopCapacity;
+    
+    // Routes (stop sequences)
+    string* routeNames;
+    int* routeModes;              // Caller-defined tag (e.g., bus / rail / air)
+    int* routeStopStart;          // Offset of the route's stops in routeStops
+    int* routeStopCount;
+    int* routeTimeStart;          // Offset of the route's first trip in arrivals / departures
+    int* routeTripCount;
+    int routeCount;
+    int routeCapacity;
+    
+    int* routeStops;              // Stop indexes of every route, back to back
+    int routeStopTotal;
+    int routeStopCapacity;
+    
+    // Stop times, trip-major within each route: [routeTimeStart + trip × stops + position]
+    int* arrivals;
+    int* departures;
+    int timeTotal;
+    int timeCapacity;
+    
+    // Footpaths (added as a list, packed per stop on demand)
+    int* footFrom;
+    int* footTo;
+    int* footMinutes;
+    int* footKinds;               // JourneyLeg::WALK or JourneyLeg::ACCESS
+    int footCount;
+    int footCapacity;
+    
+    // Packed lookups (valid while !dirty)
+    int* stopRouteStart;          // stopCount + 1 offsets into stopRoutes / stopRoutePositions
+    int* stopRoutes;
+    int* stopRoutePositions;      // Position of the stop within that route
+    int* stopFootStart;           // stopCount + 1 offsets into stopFootTo / stopFootMinutes
+    int* stopFootTo;
+    int* stopFootMinutes;
+    int* stopFootKinds;
+    bool dirty;
+    
+    // Pack the stop → route and footpath lookups
+    // Complexity: O(S + R + F)
+    void prepare();
+    
+    // Earliest trip of a route that departs position at or after time
+    // Returns: trip index, -1 if none
+    // Complexity: O(log t) where t is trips of the route
+    int findTrip(int route, int position, int time) const;
+
+public:
+    static const int INFINITE_TIME = 1000000000;
+    static const int DEFAULT_MAX_ROUNDS = 8;
+    
+    // Constructor
+    // Complexity: O(1)
+    Timetable();
+    
+    // Destructor
+    ~Timetable();
+    
+    // Add a stop (or get the existing one)
+    // Returns: stop index
+    // Complexity: O(1) amortized
+    int addStop(const string& stopID, const string& name = "");
+    
+    // Get a stop by ID
+    // Returns: stop index, -1 if not found
+    // Complexity: O(1) average
+    int findStop(const string& stopID) const;
+    
+    // Add a route visiting stops in order
+    // Returns: route index, -1 if fewer than 2 stops or an index is out of range
+    // Complexity: O(n) where n is stopCount of the route
+    int addRoute(const string& name, int mode, const int* stops, int count);
+    
+    // Add a trip to the most recently added route
+    // Parameters: tripArrivals, tripDepartures - one time per route stop (minutes after midnight)
+    // Returns: false if route is not the last route, times go backwards, or the trip would
+    //          overtake the previous trip of the route (trips must be added in departure order)
+    // Complexity: O(n) where n is stops of the route
+    bool addTrip(int route, const int* tripArrivals, const int* tripDepartures);
+    
+    // Add a one-way footpath between two stops
+    // Parameters: kind - JourneyLeg::WALK, or JourneyLeg::ACCESS for a non-walking link
+    //             (consecutive footpaths of the same kind become one journey leg)
+    // Returns: false if a stop index is out of range, minutes is negative or kind is unknown
+    // Complexity: O(1) amortized
+    bool addFootpath(int fromStop, int toStop, int minutes, int kind = JourneyLeg::WALK);
+    
+    // Find the earliest arrival at target when leaving source at departureTime (RAPTOR)
+    // Ties on arrival are broken in favour of fewer rides
+    // Parameters: maxRounds - most rides allowed
+    // Returns: New Journey (caller must delete), nullptr if target cannot be reached
+    // Complexity: O(K × (R × T + F log S)) worst case, where K is rounds, R routes, T stops
+    //             per route, F footpaths and S stops; only routes through stops improved in
+    //             the previous round are scanned
+    Journey* earliestArrival(int source, int target, int departureTime,
+                             int maxRounds = DEFAULT_MAX_ROUNDS);
+    
+    // Getters
+    int getStopCount() const;
+    int getRouteCount() const;
+    int getTripCount() const;
+    int getFootpathCount() const;
+    string getStopID(int stop) const;
+    string getStopName(int stop) const;
+    string getRouteName(int route) const;
+    int getRouteMode(int route) const;
+    
+    // Remove everything
+    // Complexity: O(S)
+    void clear();
+};
+
+#endif // TIMETABLE_H
@@ -0,0 +1,167 @@
+#include "TransferTable.h"
+#include <cmath>
+#include <cstdint>
+using namespace std;
+
+const double TransferTable::DEFAULT_MAX_WALK_DISTANCE = 1.5;
+
+// TransferTable Implementation
+TransferTable::TransferTable(int perNode, double maxWalk)
+    : nodeIDs(nullptr), stopIDs(nullptr), distances(nullptr), transferCounts(nullptr),
+      accessStopIDs(nullptr), accessDistances(nullptr), nodeCount(0), nodeCapacity(0) {
+    stopsPerNode = (perNode > 0) ? perNode : DEFAULT_STOPS_PER_NODE;
+    maxWalkDistance = (maxWalk > 0.0) ? maxWalk : DEFAULT_MAX_WALK_DISTANCE;
+    nodeIndex = new HashTable(31);
+    ensureCapacity(8);
+}
+
+TransferTable::~TransferTable() {
+    delete nodeIndex;
+    delete[] nodeIDs;
+    delete[] stopIDs;
+    delete[] distances;
+    delete[] transferCounts;
+    delete[] accessStopIDs;
+    delete[] accessDistances;
+}
+
+void TransferTable::ensureCapacity(int minCapacity) {
+    if (minCapacity <= nodeCapacity) return;
+    
+    int newCapacity = (nodeCapacity > 0) ? nodeCapacity : 8;
+    while (newCapacity < minCapacity) newCapacity *= 2;
+    
+    string* newNodeIDs = new string[newCapacity];
+    string* newStopIDs = new string[newCapacity * stopsPerNode];
+    double* newDistances = new double[newCapacity * stopsPerNode];
+    int* newCounts = new int[newCapacity];
+    string* newAccessStopIDs = new string[newCapacity];
+    double* newAccessDistances = new double[newCapacity];
+    for (int i = 0; i < nodeCount; i++) {
+        newNodeIDs[i] = nodeIDs[i];
+        newCounts[i] = transferCounts[i];
+        newAccessStopIDs[i] = accessStopIDs[i];
+        newAccessDistances[i] = accessDistances[i];
+    }
+    for (int i = 0; i < nodeCount * stopsPerNode; i++) {
+        newStopIDs[i] = stopIDs[i];
+        newDistances[i] = distances[i];
+    }
+    delete[] nodeIDs;
+    delete[] stopIDs;
+    delete[] distances;
+    delete[] transferCounts;
+    delete[] accessStopIDs;
+    delete[] accessDistances;
+    nodeIDs = newNodeIDs;
+    stopIDs = newStopIDs;
+    distances = newDistances;
+    transferCounts = newCounts;
+    accessStopIDs = newAccessStopIDs;
+    accessDistances = newAccessDistances;
+    nodeCapacity = newCapacity;
+}
+
+int TransferTable::addNode(const string& nodeID, double latitude, double longitude, Graph* cityGraph) {
+    if (nodeID.empty()) return 0;
+    
+    int slot;
+    void* found = nodeIndex->search(nodeID);
+    if (found != nullptr) {
+        slot = (int)(intptr_t)found - 1;
+    } else {
+        ensureCapacity(nodeCount + 1);
+        slot = nodeCount++;
+        nodeIDs[slot] = nodeID;
+        nodeIndex->insert(nodeID, (void*)(intptr_t)(slot + 1));
+    }
+    
+    string* stops = stopIDs + slot * stopsPerNode;
+    double* walks = distances + slot * stopsPerNode;
+    int count = 0;
+    accessStopIDs[slot] = "";
+    accessDistances[slot] = 0.0;
+    
+    if (cityGraph != nullptr) {
+        // Keep the stopsPerNode nearest stops, nearest first (insertion into a short sorted list)
+        int vertexCount = cityGraph->getVertexCount();
+        for (int i = 0; i < vertexCount; i++) {
+            Vertex* vertex = cityGraph->getVertexAt(i);
+            if (vertex == nullptr || vertex->vertexID.compare(0, 4, "Stop") != 0) continue;
+            
+            double distance = Graph::calculateDistance(latitude, longitude, vertex->latitude, vertex->longitude);
+            if (count == stopsPerNode && distance >= walks[count - 1]) continue;
+            
+            int position = (count < stopsPerNode) ? count++ : count - 1;
+            while (position > 0 && walks[position - 1] > distance) {
+                stops[position] = stops[position - 1];
+                walks[position] = walks[position - 1];
+                position--;
+            }
+            stops[position] = vertex->vertexID;
+            walks[position] = distance;
+        }
+        
+        // The nearest stop is the access stop; only stops in walking range are transfers
+        if (count > 0) {
+            accessStopIDs[slot] = stops[0];
+            accessDistances[slot] = walks[0];
+        }
+        while (count > 0 && walks[count - 1] > maxWalkDistance) count--;
+    }
+    
+    transferCounts[slot] = count;
+    return count;
+}
+
+int TransferTable::getTransfers(const string& nodeID, const string*& stops, const double*& walkDistances) const {
+    void* found = nodeIndex->search(nodeID);
+    if (found == nullptr) {
+        stops = nullptr;
+        walkDistances = nullptr;
+        return 0;
+    }
+    return getTransfersAt((int)(intptr_t)found - 1, stops, walkDistances);
+}
+
+int TransferTable::getNodeCount() const {
+    return nodeCount;
+}
+
+string TransferTable::getNodeID(int slot) const {
+    if (slot < 0 || slot >= nodeCount) return "";
+    return nodeIDs[slot];
+}
+
+int TransferTable::getTransfersAt(int slot, const string*& stops, const double*& walkDistances) const {
+    if (slot < 0 || slot >= nodeCount) {
+        stops = nullptr;
+        walkDistances = nullptr;
+        return 0;
+    }
+    stops = stopIDs + slot * stopsPerNode;
+    walkDistances = distances + slot * stopsPerNode;
+    return transferCounts[slot];
+}
+
+bool TransferTable::getAccessStop(const string& nodeID, string& stopID, double& distance) const {
+    void* found = nodeIndex->search(nodeID);
+    if (found == nullptr) return false;
+    return getAccessStopAt((int)(intptr_t)found - 1, stopID, distance);
+}
+
+bool TransferTable::getAccessStopAt(int slot, string& stopID, double& distance) const {
+    if (slot < 0 || slot >= nodeCount || accessStopIDs[slot].empty()) return false;
+    stopID = accessStopIDs[slot];
+    distance = accessDistances[slot];
+    return true;
+}
+
+double TransferTable::getMaxWalkDistance() const {
+    return maxWalkDistance;
+}
+
+void TransferTable::clear() {
+    nodeIndex->clear();
+    nodeCount = 0;
+}
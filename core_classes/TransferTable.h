@@ -0,0 +1,77 @@
+#ifndef TRANSFERTABLE_H
+#define TRANSFERTABLE_H
+
+#include <string>
+#include "Graph.h"
+#include "HashTable.h"
+using namespace std;
+
+// TransferTable class - Precomputed walking transfers from network nodes to nearby bus stops
+// Used for: Changing between rail / air and the bus network (station → stops it can walk to)
+// Each node keeps up to stopsPerNode stops within maxWalkDistance, nearest first, in a fixed
+// block of slots, so a lookup is one hash probe plus a read of that block. The nearest stop is
+// also kept separately at any distance (the access stop), for nodes with no stop in walking
+// range. Stops are the city graph vertices whose ID starts with "Stop" (same rule as
+// Graph::findNearestStop).
+class TransferTable {
+private:
+    HashTable* nodeIndex;         // Node ID → slot + 1
+    string* nodeIDs;              // Node ID of each slot
+    string* stopIDs;              // nodeCapacity × stopsPerNode stop IDs
+    double* distances;            // Walking distance (km) of each stop
+    int* transferCounts;          // Stops filled per node
+    string* accessStopIDs;        // Nearest stop of each node at any distance ("" if there are no stops)
+    double* accessDistances;      // Distance (km) to the access stop
+    int nodeCount;
+    int nodeCapacity;
+    int stopsPerNode;             // Stops kept per node
+    double maxWalkDistance;       // Stops further than this (km) are not walking transfers
+    
+    // Grow the slot arrays (doubling)
+    void ensureCapacity(int minCapacity);
+
+public:
+    static const int DEFAULT_STOPS_PER_NODE = 3;
+    static const double DEFAULT_MAX_WALK_DISTANCE;    // 1.5 km
+    
+    // Constructor
+    // Parameters: stopsPerNode (<= 0 for the default), maxWalkDistance in km (<= 0 for the default)
+    // Complexity: O(1)
+    TransferTable(int stopsPerNode = DEFAULT_STOPS_PER_NODE, double maxWalkDistance = DEFAULT_MAX_WALK_DISTANCE);
+    
+    // Destructor
+    ~TransferTable();
+    
+    // Compute (or recompute) the transfers and the access stop of a node
+    // Parameters: nodeID, node coordinates, cityGraph - graph holding the bus stops
+    // Returns: number of transfers stored (0 if no stop is within maxWalkDistance)
+    // Complexity: O(V × stopsPerNode) where V is vertices of cityGraph
+    int addNode(const string& nodeID, double latitude, double longitude, Graph* cityGraph);
+    
+    // Get the transfers of a node
+    // Parameters: nodeID, stops (output), walkDistances (output, km) - both point into the table
+    // Returns: number of transfers, 0 if the node is unknown
+    // Complexity: O(1) average
+    int getTransfers(const string& nodeID, const string*& stops, const double*& walkDistances) const;
+    
+    // Iterate nodes by slot (0 .. getNodeCount() - 1)
+    int getNodeCount() const;
+    string getNodeID(int slot) const;
+    int getTransfersAt(int slot, const string*& stops, const double*& walkDistances) const;
+    
+    // Get the nearest stop of a node however far away it is (e.g., for a taxi when no stop is walkable)
+    // Parameters: nodeID or slot, stopID (output), distance (output, km)
+    // Returns: false if the node is unknown or there are no stops
+    // Complexity: O(1) average
+    bool getAccessStop(const string& nodeID, string& stopID, double& distance) const;
+    bool getAccessStopAt(int slot, string& stopID, double& distance) const;
+    
+    // Get the walking range in km
+    double getMaxWalkDistance() const;
+    
+    // Remove every node
+    // Complexity: O(n)
+    void clear();
+};
+
+#endif // TRANSFERTABLE_H
@@ -3,28 +3,8 @@
 #include <cmath>
 using namespace std;
 
-// Static helper function to collect leaf nodes
-static void collectLeafNodesHelper(TreeNode* node, TreeNode** leafArray, int& index) {
-    if (node == nullptr) return;
-    
-    if (node->isLeaf()) {
-        if (leafArray != nullptr) {
-            leafArray[index] = node;
-        }
-        index++;
-        return;
-    }
-    
-    // Traverse all children
-    TreeNode* current = node->firstChild;
-    while (current != nullptr) {
-        collectLeafNodesHelper(current, leafArray, index);
-        current = current->nextSibling;
-    }
-}
-
 // Tree Implementation
-Tree::Tree() : root(nullptr) {
+Tree::Tree() : root(nullptr), frozen(nullptr) {
 }
 
 Tree::~Tree() {
@@ -36,12 +16,27 @@ void Tree::setRoot(TreeNode* rootNode) {
         delete root;
     }
     root = rootNode;
+    invalidateFrozen();
 }
 
 TreeNode* Tree::getRoot() {
     return root;
 }
 
+void Tree::invalidateFrozen() {
+    if (frozen != nullptr) {
+        delete frozen;
+        frozen = nullptr;
+    }
+}
+
+const FrozenTree* Tree::freeze() {
+    if (frozen == nullptr) {
+        frozen = new FrozenTree(root);
+    }
+    return frozen;
+}
+
 TreeNode* Tree::findNodeHelper(TreeNode* node, const std::string& nodeID) {
     if (node == nullptr) return nullptr;
     if (node->nodeID == nodeID) return node;
@@ -60,6 +55,9 @@ TreeNode* Tree::findNodeHelper(TreeNode* node, const std::string& nodeID) {
 }
 
 TreeNode* Tree::findNode(const std::string& nodeID) {
+    if (frozen != nullptr) {
+        return frozen->getNode(frozen->indexOf(nodeID));
+    }
     return findNodeHelper(root, nodeID);
 }
 
@@ -83,12 +81,14 @@ bool Tree::addChild(const std::string& parentID, const std::string& childID,
     
     TreeNode* childNode = new TreeNode(childID, childName, childData);
     parentNode->addChild(childNode);
+    invalidateFrozen();
     return true;
 }
 
 bool Tree::removeNode(const std::string& nodeID) {
     TreeNode* node = findNode(nodeID);
     if (node == nullptr) return false;
+    invalidateFrozen();
     
     if (node == root) {
         delete root;
@@ -104,36 +104,17 @@ bool Tree::removeNode(const std::string& nodeID) {
     return true;
 }
 
-int Tree::countNodesHelper(TreeNode* node) {
-    if (node == nullptr) return 0;
-    
-    int count = 1; // Count current node
-    TreeNode* current = node->firstChild;
-    while (current != nullptr) {
-        count += countNodesHelper(current);
-        current = current->nextSibling;
-    }
-    
-    return count;
-}
-
 int Tree::getNodeCount() {
-    return countNodesHelper(root);
-}
-
-int Tree::getHeightHelper(TreeNode* node) {
-    if (node == nullptr) return -1;
-    return node->getHeight();
+    return freeze()->getNodeCount();
 }
 
 int Tree::getTreeHeight() {
-    return getHeightHelper(root);
+    return freeze()->getHeight();
 }
 
 int Tree::getNodeDepth(const std::string& nodeID) {
-    TreeNode* node = findNode(nodeID);
-    if (node == nullptr) return -1;
-    return node->getDepth();
+    const FrozenTree* snapshot = freeze();
+    return snapshot->getDepth(snapshot->indexOf(nodeID));
 }
 
 void Tree::displayHelper(TreeNode* node, int level, const std::string& prefix) {
@@ -190,6 +171,7 @@ void Tree::deleteSubtree(TreeNode* node) {
 }
 
 void Tree::clear() {
+    invalidateFrozen();
     if (root != nullptr) {
         deleteSubtree(root);
         root = nullptr;
@@ -200,53 +182,24 @@ void Tree::getLeafNodes(TreeNode** leafArray, int& count) {
     count = 0;
     if (root == nullptr) return;
     
-    // First pass: count leaf nodes
-    int index = 0;
-    collectLeafNodesHelper(root, nullptr, index);
-    count = index;
-    
-    // Second pass: collect leaf nodes if array is provided
-    if (leafArray != nullptr) {
-        index = 0;
-        collectLeafNodesHelper(root, leafArray, index);
+    // A leaf's subtree is just itself
+    const FrozenTree* snapshot = freeze();
+    for (int i = 0; i < snapshot->getNodeCount(); i++) {
+        if (snapshot->getSubtreeSize(i) == 1) {
+            if (leafArray != nullptr) {
+                leafArray[count] = snapshot->getNode(i);
+            }
+            count++;
+        }
     }
 }
 
 bool Tree::isAncestor(const std::string& ancestorID, const std::string& descendantID) {
-    TreeNode* descendant = findNode(descendantID);
-    if (descendant == nullptr) return false;
-    
-    TreeNode* current = descendant->parent;
-    while (current != nullptr) {
-        if (current->nodeID == ancestorID) {
-            return true;
-        }
-        current = current->parent;
-    }
-    
-    return false;
+    const FrozenTree* snapshot = freeze();
+    return snapshot->isAncestor(snapshot->indexOf(ancestorID), snapshot->indexOf(descendantID));
 }
 
 std::string* Tree::getPathToNode(const std::string& nodeID, int& pathLength) {
-    TreeNode* node = findNode(nodeID);
-    if (node == nullptr) {
-        pathLength = 0;
-        return nullptr;
-    }
-    
-    // Calculate path length (depth + 1)
-    pathLength = node->getDepth() + 1;
-    
-    // Allocate array for path
-    std::string* path = new std::string[pathLength];
-    
-    // Build path from node to root (reverse order)
-    TreeNode* current = node;
-    for (int i = pathLength - 1; i >= 0; i--) {
-        path[i] = current->nodeID;
-        current = current->parent;
-    }
-    
-    return path;
+    const FrozenTree* snapshot = freeze();
+    return snapshot->getPathToNode(snapshot->indexOf(nodeID), pathLength);
 }
-
@@ -3,6 +3,7 @@
 
 #include <string>
 #include "TreeNode.h"
+#include "FrozenTree.h"
 using namespace std;
 
 // Tree class for general N-ary tree implementation
@@ -13,18 +14,15 @@ using namespace std;
 class Tree {
 private:
     TreeNode* root;           // Root of the tree
+    FrozenTree* frozen;       // Cached preorder snapshot (nullptr after any change)
     
     // Helper function for finding node by ID (recursive)
     // Complexity: O(n) where n is total nodes
     TreeNode* findNodeHelper(TreeNode* node, const string& nodeID);
     
-    // Helper function for counting nodes (recursive)
-    // Complexity: O(n)
-    int countNodesHelper(TreeNode* node);
-    
-    // Helper function for getting tree height (recursive)
-    // Complexity: O(n)
-    int getHeightHelper(TreeNode* node);
+    // Drop the cached snapshot after a change
+    // Complexity: O(1)
+    void invalidateFrozen();
     
     // Helper function for displaying tree (recursive)
     // Complexity: O(n)
@@ -48,11 +46,17 @@ public:
     void setRoot(TreeNode* rootNode);
     
     // Get the root of the tree
+    // Note: change the tree through Tree methods so the frozen snapshot stays current
     // Complexity: O(1)
     TreeNode* getRoot();
     
+    // Get the preorder snapshot, building it if the tree changed since the last call
+    // Returns: Snapshot owned by the tree (valid until the next change)
+    // Complexity: O(1) if current, O(n log n) to rebuild
+    const FrozenTree* freeze();
+    
     // Find a node by ID
-    // Complexity: O(n) where n is total nodes
+    // Complexity: O(log n) with a current snapshot, O(n) otherwise
     TreeNode* findNode(const string& nodeID);
     
     // Add a child to a parent node
@@ -65,15 +69,15 @@ public:
     bool removeNode(const string& nodeID);
     
     // Get the total number of nodes in the tree
-    // Complexity: O(n)
+    // Complexity: O(1) with a current snapshot
     int getNodeCount();
     
     // Get the height of the tree
-    // Complexity: O(n)
+    // Complexity: O(1) with a current snapshot
     int getTreeHeight();
     
     // Get the depth of a node
-    // Complexity: O(h) where h is height of tree
+    // Complexity: O(log n) with a current snapshot
     int getNodeDepth(const string& nodeID);
     
     // Display the tree structure (hierarchical view)
@@ -88,17 +92,17 @@ public:
     // Complexity: O(n)
     void clear();
     
-    // Get all leaf nodes (nodes with no children)
+    // Get all leaf nodes (nodes with no children), in preorder
     // Complexity: O(n)
     void getLeafNodes(TreeNode** leafArray, int& count);
     
     // Check if a node is an ancestor of another node
-    // Complexity: O(h) where h is height
+    // Complexity: O(log n) with a current snapshot (two ID lookups, O(1) range check)
     bool isAncestor(const string& ancestorID, const string& descendantID);
     
     // Get the path from root to a given node
     // Returns: Array of node IDs, pathLength is output parameter
-    // Complexity: O(h) where h is height
+    // Complexity: O(log n + h) with a current snapshot, where h is the node's depth
     string* getPathToNode(const string& nodeID, int& pathLength);
 };
 
@@ -8,8 +8,11 @@
 #include "RailwayManager.h"
 #include "EmergencyManager.h"
 #include "EmergencyVehicle.h"
+#include "EmergencySimulator.h"
+#include "JourneyPlanner.h"
 #include "core_classes/Graph.h"
 #include "core_classes/DataLoader.h"
+#include "core_classes/SectorGazetteer.h"
 #include "Bus.h"
 #include "SchoolBus.h"
 #include "Mall.h"
@@ -28,27 +31,6 @@
 #include <ctime>
 using namespace std;
 
-#ifndef M_PI
-#define M_PI 3.1415
-#endif
-
-// Helper function to calculate distance between two coordinates (Haversine formula)
-static double calculateDistance(double lat1, double lon1, double lat2, double lon2) {
-    const double R = 6371.0; // Earth radius in kilometers
-    
-    double dLat = (lat2 - lat1) * M_PI / 180.0;
-    double dLon = (lon2 - lon1) * M_PI / 180.0;
-    
-    double a = sin(dLat / 2.0) * sin(dLat / 2.0) +
-               cos(lat1 * M_PI / 180.0) * cos(lat2 * M_PI / 180.0) *
-               sin(dLon / 2.0) * sin(dLon / 2.0);
-    
-    double c = 2.0 * atan2(sqrt(a), sqrt(1.0 - a));
-    double distance = R * c;
-    
-    return distance;
-}
-
 // Helper function to calculate complete distance from source coordinates to destination coordinates
 // Returns: total distance (source coords -> source stop -> destination stop -> destination coords)
 // Parameters: sourceLat, sourceLon, destLat, destLon, graph, sourceStopID (output), destStopID (output), totalDistance (output)
@@ -66,7 +48,7 @@ static bool calculateCompleteDistance(double sourceLat, double sourceLon, double
     // Step 2: Calculate distance from source coordinates to source stop (straight-line)
     double sourceStopLat, sourceStopLon;
     if (!graph->getVertexCoordinates(sourceStopID, sourceStopLat, sourceStopLon)) return false;
-    double walkToSourceStop = calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
+    double walkToSourceStop = Graph::calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
     totalDistance += walkToSourceStop;
     
     // Step 3: Find nearest stop to destination coordinates
@@ -88,7 +70,7 @@ static bool calculateCompleteDistance(double sourceLat, double sourceLon, double
     if (!graph->getVertexCoordinates(destStopID, destStopLat, destStopLon)) {
         return false;
     }
-    double walkFromDestStop = calculateDistance(destStopLat, destStopLon, destLat, destLon);
+    double walkFromDestStop = Graph::calculateDistance(destStopLat, destStopLon, destLat, destLon);
     totalDistance += walkFromDestStop;
     
     return true;
@@ -111,7 +93,7 @@ static bool calculateCompleteDistanceToVertex(double sourceLat, double sourceLon
     // Step 2: Calculate distance from source coordinates to source stop (straight-line)
     double sourceStopLat, sourceStopLon;
     if (!graph->getVertexCoordinates(sourceStopID, sourceStopLat, sourceStopLon)) return false;
-    double walkToSourceStop = calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
+    double walkToSourceStop = Graph::calculateDistance(sourceLat, sourceLon, sourceStopLat, sourceStopLon);
     totalDistance += walkToSourceStop;
     
     // Step 3: Get destination vertex coordinates
@@ -137,7 +119,7 @@ static bool calculateCompleteDistanceToVertex(double sourceLat, double sourceLon
     if (!graph->getVertexCoordinates(destStopID, destStopLat, destStopLon)) {
         return false;
     }
-    double walkFromDestStop = calculateDistance(destStopLat, destStopLon, destLat, destLon);
+    double walkFromDestStop = Graph::calculateDistance(destStopLat, destStopLon, destLat, destLon);
     totalDistance += walkFromDestStop;
     
     return true;
@@ -333,8 +315,24 @@ static PopulationManager* population = nullptr;
 static AirportManager* airports = nullptr;
 static RailwayManager* railways = nullptr;
 static EmergencyManager* emergency = nullptr;
+static JourneyPlanner* planner = nullptr;
 static DataLoader* loader = nullptr;
 
+// Connect the loaded railway stations with track (segment file, or nearest stations if it is missing)
+static void loadRailTracks() {
+    CSVRow segmentData[100];
+    int segmentCount = 0;
+    if (loader->loadRailSegments("../SmartCity_dataset/rail_segments.csv", segmentData, 100, segmentCount)) {
+        int added = railways->loadTrackSegmentsFromCSVData(segmentData, segmentCount);
+        cout << "[OK] Loaded " << added << " track segments\n";
+    }
+    // Stations the segment file does not mention still get a line to their neighbours
+    int defaults = railways->buildDefaultTracks();
+    if (defaults > 0) {
+        cout << "[OK] Connected unlinked stations with " << defaults << " default track segments\n";
+    }
+}
+
 // ========================================================================
 // MENU DISPLAY FUNCTIONS
 // ========================================================================
@@ -378,10 +376,12 @@ void displayEducationMenu() {
     cout << "   7. Add Department to School\n";
     cout << "   8. Add Class to Department\n";
     cout << "   9. Add New School\n";
+    cout << "  10. Top Schools Teaching a Subject\n";
+    cout << "  11. Organogram Summary (All Schools)\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-9): ";
+    cout << "Enter your choice (0-11): ";
 }
 
 void displayMedicalMenu() {
@@ -404,10 +404,14 @@ void displayMedicalMenu() {
     cout << "  12. Add New Pharmacy\n";
     cout << "  13. Add New Doctor\n";
     cout << "  14. Add Medicine to Pharmacy\n";
+    cout << "  15. Find Cheapest / Nearest Stockists of a Medicine\n";
+    cout << "  16. Find Medicines by Formula in a Price Range\n";
+    cout << "  17. Update Hospital Emergency Beds (Admit/Discharge)\n";
+    cout << "  18. Top Hospitals by Available Beds\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-14): ";
+    cout << "Enter your choice (0-18): ";
 }
 
 void displayTransportMenu() {
@@ -454,10 +458,12 @@ void displayMallMenu() {
     cout << "   8. Display Products in a Mall\n";
     cout << "   9. Add New Mall\n";
     cout << "  10. Add Product to Mall\n";
+    cout << "  11. Cheapest Products Near Me (by category)\n";
+    cout << "  12. Search Products by Partial Name\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-10): ";
+    cout << "Enter your choice (0-12): ";
 }
 
 void displayFacilityMenu() {
@@ -472,10 +478,11 @@ void displayFacilityMenu() {
     cout << "   4. Find Nearest Facility (by coordinates)\n";
     cout << "   5. Display All Facilities\n";
     cout << "   6. Add New Facility\n";
+    cout << "   7. Find k Nearest Facilities of a Type\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-6): ";
+    cout << "Enter your choice (0-7): ";
 }
 
 void displayAirportMenu() {
@@ -488,7 +495,7 @@ void displayAirportMenu() {
     cout << "   2. Search Airport by Name\n";
     cout << "   3. Search Airport by IATA Code\n";
     cout << "   4. Find Nearest Airport (by coordinates)\n";
-    cout << "   5. Calculate Air Distance (Between Two Airports)\n";
+    cout << "   5. Find Flight Route (Between Two Airports)\n";
     cout << "   6. Display All Airports\n";
     cout << "   7. Add New Airport\n";
     cout << "   0. Back to Main Menu\n";
@@ -529,10 +536,17 @@ void displayPopulationMenu() {
     cout << "  15. Generate Full Population Heatmap (with Analysis)\n";
     cout << "  16. Export Heatmap to File\n";
     cout << "\n";
+    cout << "   [RELOCATION]\n";
+    cout << "  17. Move Family to Another House\n";
+    cout << "\n";
+    cout << "   [ANALYTICS]\n";
+    cout << "  18. Filter Citizens (e.g., working-age engineers in G-10)\n";
+    cout << "  19. Population Density Grid (export PGM / CSV / binary)\n";
+    cout << "\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-16): ";
+    cout << "Enter your choice (0-19): ";
 }
 
 void displayCrossModuleMenu() {
@@ -547,10 +561,11 @@ void displayCrossModuleMenu() {
     cout << "   4. Shopping Trip Planning\n";
     cout << "   5. Universal Pathfinding (Any Location -> Any Location)\n";
     cout << "   6. Real-Time Route Simulation\n";
+    cout << "   7. Multimodal Journey Planner (Bus / Rail / Air)\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-6): ";
+    cout << "Enter your choice (0-7): ";
 }
 
 void displayStatisticsMenu() {
@@ -562,10 +577,11 @@ void displayStatisticsMenu() {
     cout << "   1. View Module Statistics\n";
     cout << "   2. View Shared Graph Statistics\n";
     cout << "   3. View Data Structure Usage Summary\n";
-    cout << "   4. Back to Main Menu\n";
+    cout << "   4. Ad hoc Query (filter / group by / top k)\n";
+    cout << "   5. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (1-4): ";
+    cout << "Enter your choice (1-5): ";
 }
 
 void displayDataMenu() {
@@ -897,6 +913,35 @@ void handleEducationMenu() {
                 break;
             }
             
+            case 10: {
+                string subject = readString("Enter Subject Name: ");
+                int topN = readInt("Enter number of top schools to display: ");
+                int count = 0;
+                School** topSchools = education->getTopSchoolsBySubject(subject, topN, count);
+                if (count > 0) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    cout << "Top " << count << " School(s) teaching " << subject << ":\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        cout << (i + 1) << ". " << topSchools[i]->getName() 
+                             << " (ID: " << topSchools[i]->getSchoolID() 
+                             << ", Rating: " << topSchools[i]->getRating() << "/10.0)\n";
+                    }
+                    delete[] topSchools;
+                } else {
+                    cout << "\n[INFO] No schools found offering " << subject << "\n";
+                }
+                pause();
+                break;
+            }
+            
+            case 11: {
+                education->displayOrganogramSummary();
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -959,7 +1004,7 @@ void handleMedicalMenu() {
             
             case 3: {
                 string medicineName = readString("Enter Medicine Name: ");
-                Medicine* medicine = medical->searchMedicineByName(medicineName);
+                const Medicine* medicine = medical->searchMedicineByName(medicineName);
                 if (medicine != nullptr) {
                     cout << "\n[RESULT]\n";
                     cout << "----------------------------\n";
@@ -983,7 +1028,7 @@ void handleMedicalMenu() {
             
             case 4: {
                 string formula = readString("Enter Medicine Formula: ");
-                Medicine* medicine = medical->searchMedicineByFormula(formula);
+                const Medicine* medicine = medical->searchMedicineByFormula(formula);
                 if (medicine != nullptr) {
                     cout << "\n[RESULT]\n";
                     cout << "----------------------------\n";
@@ -1346,6 +1391,121 @@ void handleMedicalMenu() {
                 break;
             }
             
+            case 15: {
+                cout << "\n[FIND MEDICINE STOCKISTS]\n";
+                cout << "----------------------------\n";
+                string key = readString("Enter Medicine Name or Formula: ");
+                int searchBy = readInt("Search by (1=Name, 2=Formula): ");
+                int order = readInt("Order by (1=Cheapest, 2=Nearest): ");
+                int k = readInt("How many results: ");
+                
+                if (key.empty() || k <= 0) {
+                    cout << "\n[ERROR] Medicine and a positive result count are required\n";
+                    pause();
+                    break;
+                }
+                
+                bool byFormula = (searchBy == 2);
+                int count = 0;
+                MedicineStockEntry* stockists = nullptr;
+                if (order == 2) {
+                    double lat = readDouble("Enter latitude: ");
+                    double lon = readDouble("Enter longitude: ");
+                    stockists = medical->findNearestStockists(key, lat, lon, k, count, byFormula);
+                } else {
+                    stockists = medical->findCheapestStockists(key, k, count, byFormula);
+                }
+                
+                if (stockists != nullptr && count > 0) {
+                    cout << "\n[RESULT] " << count << " stockist(s) of " << key << ":\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        cout << (i + 1) << ". " << stockists[i].pharmacy->getName()
+                             << " (" << stockists[i].pharmacy->getPharmacyID()
+                             << ", " << stockists[i].pharmacy->getSector() << ") - "
+                             << stockists[i].medicineName << " @ " << stockists[i].price << " PKR\n";
+                    }
+                } else {
+                    cout << "\n[INFO] No pharmacy stocks " << key << "\n";
+                }
+                if (stockists != nullptr) delete[] stockists;
+                pause();
+                break;
+            }
+            
+            case 16: {
+                cout << "\n[FIND MEDICINES BY FORMULA AND PRICE]\n";
+                cout << "----------------------------\n";
+                string formula = readString("Enter Medicine Formula (e.g., Paracetamol): ");
+                double minPrice = readDouble("Enter Minimum Price (PKR): ");
+                double maxPrice = readDouble("Enter Maximum Price (PKR): ");
+                
+                int count = 0;
+                MedicineStockEntry* matches = medical->findStockistsInPriceRange(formula, minPrice, maxPrice, count, true);
+                if (matches != nullptr && count > 0) {
+                    cout << "\n[RESULT] " << count << " " << formula << " medicine(s) between "
+                         << minPrice << " and " << maxPrice << " PKR:\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        cout << (i + 1) << ". " << matches[i].medicineName << " @ " << matches[i].price
+                             << " PKR - " << matches[i].pharmacy->getName()
+                             << " (" << matches[i].pharmacy->getSector() << ")\n";
+                    }
+                } else {
+                    cout << "\n[INFO] No " << formula << " medicine found in that price range\n";
+                }
+                if (matches != nullptr) delete[] matches;
+                pause();
+                break;
+            }
+            
+            case 17: {
+                cout << "\n[UPDATE HOSPITAL EMERGENCY BEDS]\n";
+                cout << "----------------------------\n";
+                string hospitalID = readString("Enter Hospital ID: ");
+                Hospital* hospital = medical->searchHospital(hospitalID);
+                if (hospital == nullptr) {
+                    cout << "\n[ERROR] Hospital not found with ID: " << hospitalID << "\n";
+                    pause();
+                    break;
+                }
+                
+                cout << "Current Emergency Beds: " << hospital->getEmergencyBeds() << "\n";
+                int delta = readInt("Enter change (-N to admit N patients, +N to free N beds): ");
+                if (medical->adjustEmergencyBeds(hospitalID, delta)) {
+                    cout << "\n[SUCCESS] " << hospital->getName() << " now has "
+                         << hospital->getEmergencyBeds() << " emergency bed(s)\n";
+                } else {
+                    cout << "\n[ERROR] Not enough free beds for that admission\n";
+                }
+                pause();
+                break;
+            }
+            
+            case 18: {
+                cout << "\n[TOP HOSPITALS BY AVAILABLE BEDS]\n";
+                cout << "----------------------------\n";
+                int k = readInt("How many hospitals: ");
+                string specialization = readString("Specialization filter (leave empty for all): ");
+                
+                int count = 0;
+                Hospital** hospitals = medical->getTopHospitalsByBeds(k, specialization, count);
+                if (hospitals != nullptr && count > 0) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        cout << (i + 1) << ". " << hospitals[i]->getName()
+                             << " (" << hospitals[i]->getHospitalID() << ", Beds: "
+                             << hospitals[i]->getEmergencyBeds() << ")\n";
+                    }
+                } else {
+                    cout << "\n[INFO] No hospitals found\n";
+                }
+                if (hospitals != nullptr) delete[] hospitals;
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -1907,6 +2067,21 @@ void handleMallMenu() {
                             cout << "Mall ID: " << mallID << " (Mall not found)\n";
                         }
                     }
+                    
+                    // Other malls selling the same product
+                    int offeringCount = 0;
+                    Product** offerings = malls->findProductEverywhere(productName, offeringCount);
+                    if (offeringCount > 1) {
+                        cout << "Also available at:\n";
+                        for (int i = 1; i < offeringCount; i++) {
+                            Mall* mall = malls->findMallByID(offerings[i]->getMallID());
+                            cout << "  - " << ((mall != nullptr) ? mall->getName() : offerings[i]->getMallID())
+                                 << ": " << offerings[i]->getPrice() << " PKR\n";
+                        }
+                    }
+                    if (offerings != nullptr) {
+                        delete[] offerings;
+                    }
                 } else {
                     cout << "\n[ERROR] Product not found: " << productName << "\n";
                 }
@@ -1916,17 +2091,31 @@ void handleMallMenu() {
             
             case 4: {
                 string category = readString("Enter Product Category: ");
-                Product* results[100];
-                int count = 0;
-                malls->findProductsByCategory(category, results, count);
-                if (count > 0) {
+                int total = malls->getCategoryProductCount(category);
+                if (total > 0) {
                     cout << "\n[RESULT]\n";
                     cout << "----------------------------\n";
-                    cout << "Found " << count << " product(s) in category " << category << ":\n";
+                    cout << "Found " << total << " product(s) in category " << category << " (cheapest first):\n";
                     cout << "----------------------------\n";
-                    for (int i = 0; i < count && i < 20; i++) {
-                        cout << (i + 1) << ". " << results[i]->getName() 
-                             << " - " << results[i]->getPrice() << " PKR\n";
+                    
+                    // Page through the category index 20 products at a time
+                    const int pageSize = 20;
+                    int offset = 0;
+                    while (offset < total) {
+                        int count = 0;
+                        Product** page = malls->getProductsByCategory(category, offset, pageSize, count);
+                        for (int i = 0; i < count; i++) {
+                            cout << (offset + i + 1) << ". " << page[i]->getName() 
+                                 << " - " << page[i]->getPrice() << " PKR (Mall: " << page[i]->getMallID() << ")\n";
+                        }
+                        if (page != nullptr) {
+                            delete[] page;
+                        }
+                        offset += count;
+                        if (count == 0 || offset >= total) break;
+                        
+                        string more = readString("Show next page? (y/n): ");
+                        if (more != "y" && more != "Y") break;
                     }
                 } else {
                     cout << "\n[INFO] No products found in category: " << category << "\n";
@@ -2157,6 +2346,59 @@ void handleMallMenu() {
                 break;
             }
             
+            case 11: {
+                string category = readString("Enter Product Category: ");
+                double lat = readDouble("Enter your latitude: ");
+                double lon = readDouble("Enter your longitude: ");
+                double radiusKm = readDouble("Enter search radius (km): ");
+                int topN = readInt("Enter number of products to display: ");
+                
+                int count = 0;
+                Product** cheapest = malls->findCheapestProductsNear(category, lat, lon, radiusKm, topN, count);
+                if (count > 0) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    cout << "Cheapest " << count << " " << category << " product(s) within " << radiusKm << " km:\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        Mall* mall = malls->findMallByID(cheapest[i]->getMallID());
+                        cout << (i + 1) << ". " << cheapest[i]->getName() 
+                             << " - " << cheapest[i]->getPrice() << " PKR"
+                             << " (" << ((mall != nullptr) ? mall->getName() : cheapest[i]->getMallID()) << ")\n";
+                    }
+                    delete[] cheapest;
+                } else {
+                    cout << "\n[INFO] No " << category << " products found within " << radiusKm << " km\n";
+                }
+                pause();
+                break;
+            }
+            
+            case 12: {
+                string query = readString("Enter part of the product name (e.g., laptop, led tv): ");
+                string fromStop = readString("Rank by distance from Stop ID (or press Enter to rank by price): ");
+                int count = 0;
+                Product** found = malls->searchProducts(query, count, fromStop);
+                if (count > 0) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    cout << "Found " << count << " product(s) matching \"" << query << "\""
+                         << (fromStop.empty() ? " (cheapest first):\n" : " (nearest first):\n");
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count && i < 20; i++) {
+                        Mall* mall = malls->findMallByID(found[i]->getMallID());
+                        cout << (i + 1) << ". " << found[i]->getName() 
+                             << " - " << found[i]->getPrice() << " PKR"
+                             << " (" << ((mall != nullptr) ? mall->getName() : found[i]->getMallID()) << ")\n";
+                    }
+                    delete[] found;
+                } else {
+                    cout << "\n[INFO] No products found matching: " << query << "\n";
+                }
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -2269,7 +2511,8 @@ void handleFacilityMenu() {
             
             case 3: {
                 string type = readString("Enter Facility Type: ");
-                Facility* results[50];
+                int typeCount = facilities->getFacilityCountByType(type);
+                Facility** results = new Facility*[(typeCount > 0) ? typeCount : 1];
                 int count = 0;
                 facilities->findFacilitiesByType(type, results, count);
                 if (count > 0) {
@@ -2305,6 +2548,7 @@ void handleFacilityMenu() {
                 } else {
                     cout << "\n[INFO] No facilities found of type: " << type << "\n";
                 }
+                delete[] results;
                 pause();
                 break;
             }
@@ -2422,6 +2666,63 @@ void handleFacilityMenu() {
                 break;
             }
             
+            case 7: {
+                int typeCount = 0;
+                string* types = facilities->getFacilityTypes(typeCount);
+                if (types != nullptr) {
+                    cout << "Available types: ";
+                    for (int i = 0; i < typeCount; i++) {
+                        cout << types[i];
+                        if (i < typeCount - 1) cout << ", ";
+                    }
+                    cout << "\n";
+                    delete[] types;
+                }
+                
+                string type = readString("Enter Facility Type: ");
+                string fromStop = readString("Enter Stop ID (or press Enter to search by coordinates): ");
+                int k = readInt("Enter number of facilities to display: ");
+                if (k <= 0) {
+                    cout << "\n[ERROR] Number of facilities must be positive\n";
+                    pause();
+                    break;
+                }
+                
+                int count = 0;
+                Facility** nearest = nullptr;
+                double* distances = nullptr;
+                if (!fromStop.empty()) {
+                    distances = new double[k];
+                    nearest = facilities->findNearestFacilitiesByType(type, fromStop, k, count, distances);
+                } else {
+                    double lat = readDouble("Enter latitude: ");
+                    double lon = readDouble("Enter longitude: ");
+                    nearest = facilities->findNearestFacilitiesByType(type, lat, lon, k, count);
+                }
+                
+                if (count > 0) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    cout << count << " nearest " << type << " facility(ies)"
+                         << (fromStop.empty() ? "" : " to " + fromStop) << ":\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < count; i++) {
+                        cout << (i + 1) << ". " << nearest[i]->getName()
+                             << " [" << nearest[i]->getFacilityID() << "], Sector " << nearest[i]->getSector();
+                        if (distances != nullptr) {
+                            cout << " - " << distances[i] << " km";
+                        }
+                        cout << "\n";
+                    }
+                    delete[] nearest;
+                } else {
+                    cout << "\n[INFO] No reachable facilities found of type: " << type << "\n";
+                }
+                delete[] distances;
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -2555,23 +2856,26 @@ void handleAirportMenu() {
                     nearest->display();
                     
                     // Calculate distance
-                    double distance = calculateDistance(lat, lon, nearest->getLatitude(), nearest->getLongitude());
+                    double distance = Graph::calculateDistance(lat, lon, nearest->getLatitude(), nearest->getLongitude());
                     cout << "Distance: " << distance << " km\n";
                     
-                    // Get connected stops
-                    Graph* cityGraph = airports->getCityGraph();
-                    if (cityGraph != nullptr) {
-                        string connectedStops[10];
-                        int stopCount = 0;
-                        if (cityGraph->getConnectedStops(nearest->getVertexID(), connectedStops, 10, stopCount)) {
-                            if (stopCount > 0) {
-                                cout << "Connected Stop(s): ";
-                                for (int i = 0; i < stopCount; i++) {
-                                    cout << connectedStops[i];
-                                    if (i < stopCount - 1) cout << ", ";
-                                }
-                                cout << "\n";
-                            }
+                    // Bus stops within walking distance (precomputed transfers)
+                    const string* stops = nullptr;
+                    const double* walks = nullptr;
+                    int stopCount = airports->getTransfers()->getTransfers(nearest->getAirportID(), stops, walks);
+                    if (stopCount > 0) {
+                        cout << "Nearby Stop(s): ";
+                        for (int i = 0; i < stopCount; i++) {
+                            cout << stops[i] << " (" << walks[i] << " km)";
+                            if (i < stopCount - 1) cout << ", ";
+                        }
+                        cout << "\n";
+                    } else {
+                        string accessStop;
+                        double accessDistance = 0.0;
+                        if (airports->getTransfers()->getAccessStop(nearest->getAirportID(), accessStop, accessDistance)) {
+                            cout << "Nearest Stop: " << accessStop << " (" << accessDistance
+                                 << " km, beyond walking range)\n";
                         }
                     }
                 } else {
@@ -2585,21 +2889,28 @@ void handleAirportMenu() {
                 string fromID = readString("Enter Source Airport ID: ");
                 string toID = readString("Enter Destination Airport ID: ");
                 double distance = 0.0;
-                if (airports->calculateAirDistance(fromID, toID, distance)) {
+                int pathLength = 0;
+                string* path = new string[airports->getAirportCount() + 1];
+                if (airports->findAirportPath(fromID, toID, path, pathLength, distance)) {
                     cout << "\n[RESULT]\n";
                     cout << "----------------------------\n";
-                    cout << "Air Distance Calculation:\n";
+                    cout << "Flight Route:\n";
                     cout << "----------------------------\n";
-                    Airport* from = airports->findAirportByID(fromID);
-                    Airport* to = airports->findAirportByID(toID);
-                    if (from != nullptr && to != nullptr) {
-                        cout << "From: " << from->getName() << " (" << from->getCode() << ")\n";
-                        cout << "To: " << to->getName() << " (" << to->getCode() << ")\n";
-                        cout << "Air Distance: " << distance << " km\n";
+                    for (int i = 0; i < pathLength; i++) {
+                        Airport* airport = airports->findAirportByID(path[i]);
+                        cout << "  " << (i + 1) << ". " << ((airport != nullptr) ? airport->getName() : path[i])
+                             << " (" << ((airport != nullptr) ? airport->getCode() : path[i]) << ")\n";
                     }
+                    if (pathLength > 2) {
+                        cout << "Connections: " << (pathLength - 2) << "\n";
+                    } else {
+                        cout << "Direct flight\n";
+                    }
+                    cout << "Air Distance: " << distance << " km\n";
                 } else {
-                    cout << "\n[ERROR] Could not calculate distance. Make sure both airports exist.\n";
+                    cout << "\n[ERROR] Could not find a flight route. Make sure both airports exist and are connected by flights.\n";
                 }
+                delete[] path;
                 pause();
                 break;
             }
@@ -2644,8 +2955,9 @@ void handleAirportMenu() {
                 // Create new airport (use airportID as vertexID)
                 Airport* newAirport = new Airport(airportID, name, code, city, airportID, lat, lon);
                 
-                // Add to manager (this will automatically connect to nearest bus stop and other airports)
+                // Add to manager (this will automatically connect to nearest bus stop)
                 if (airports->addAirport(newAirport)) {
+                    int legs = airports->buildDefaultFlightLegs();
                     cout << "\n[SUCCESS] Airport added successfully!\n";
                     cout << "ID: " << airportID << "\n";
                     cout << "Name: " << name << "\n";
@@ -2653,7 +2965,8 @@ void handleAirportMenu() {
                     cout << "City: " << city << "\n";
                     cout << "Coordinates: " << lat << ", " << lon << "\n";
                     cout << "Connected to nearest bus stop for pathfinding\n";
-                    cout << "Connected to all other airports for direct flights\n";
+                    cout << "Added " << legs << " direct flight leg(s) to airports within "
+                         << AirportManager::DEFAULT_MAX_LEG_DISTANCE << " km\n";
                 } else {
                     cout << "\n[ERROR] Failed to add airport\n";
                     delete newAirport;
@@ -2836,7 +3149,12 @@ void handlePopulationMenu() {
                 }
                 
                 citizeninfo* member = new citizeninfo(memberCNIC, name, age, gender, occupation);
-                population->addFamilyMember(parentCNIC, member);
+                if (!population->addFamilyMember(parentCNIC, member)) {
+                    delete member;
+                    cout << "\n[ERROR] Parent with CNIC " << parentCNIC << " is not part of a family tree\n";
+                    pause();
+                    break;
+                }
                 
                 cout << "\n[SUCCESS] Family member added successfully!\n";
                 cout << "Member: " << name << " (CNIC: " << memberCNIC << ")\n";
@@ -2925,6 +3243,142 @@ void handlePopulationMenu() {
                 break;
             }
             
+            case 17: {
+                cout << "\n[MOVE FAMILY]\n";
+                cout << "----------------------------\n";
+                string headCNIC = readString("Enter Family Head CNIC: ");
+                famnode* head = population->findFamilyNode(headCNIC);
+                if (head == nullptr || head->parent != nullptr) {
+                    cout << "\n[ERROR] No family head found with CNIC " << headCNIC << "\n";
+                    pause();
+                    break;
+                }
+                
+                cout << "Family Head: " << head->citizen->name
+                     << " (currently House " << head->house->houseNumber << ")\n";
+                string sectorName = readString("Enter New Sector Name: ");
+                int streetNum = readInt("Enter New Street Number: ");
+                int houseNum = readInt("Enter New House Number: ");
+                if (population->moveFamily(headCNIC, sectorName, streetNum, houseNum)) {
+                    cout << "\n[SUCCESS] Family moved to House " << houseNum << ", Street " << streetNum
+                         << ", Sector " << sectorName << "\n";
+                } else {
+                    cout << "\n[ERROR] Could not move family. The house must exist and be empty\n";
+                }
+                pause();
+                break;
+            }
+            
+            case 18: {
+                cout << "\n[FILTER CITIZENS]\n";
+                cout << "----------------------------\n";
+                cout << "Leave a field empty to match any value; separate alternatives with commas\n";
+                CitizenFilter filter;
+                filter.sector = readString("Sector (e.g., G-10 or F-8, G-10): ");
+                filter.gender = readString("Gender (Male/Female/Other): ");
+                filter.occupation = readString("Occupation (e.g., Engineer): ");
+                filter.minAge = readInt("Minimum age (empty for any): ");
+                int maxAge = readInt("Maximum age (empty for any): ");
+                if (maxAge > 0) filter.maxAge = maxAge;
+                
+                CitizenTable* table = population->getCitizenTable();
+                int matchCount = table->count(filter);
+                cout << "\n[RESULT]\n";
+                cout << "----------------------------\n";
+                cout << matchCount << " of " << table->getLiveCount() << " citizen(s) match\n";
+                
+                if (matchCount > 0) {
+                    // Break the matches down by the fields that were left open
+                    int groupColumns[3] = { CitizenTable::COLUMN_SECTOR, CitizenTable::COLUMN_GENDER,
+                                            CitizenTable::COLUMN_OCCUPATION };
+                    string groupNames[3] = { "Sector", "Gender", "Occupation" };
+                    bool groupOpen[3] = { filter.sector.empty(), filter.gender.empty(), filter.occupation.empty() };
+                    for (int g = 0; g < 3; g++) {
+                        if (!groupOpen[g]) continue;
+                        int groups = 0;
+                        int* counts = table->groupCount(groupColumns[g], filter, groups);
+                        if (counts == nullptr) continue;
+                        cout << "\nBy " << groupNames[g] << ":\n";
+                        for (int i = 0; i < groups; i++) {
+                            if (counts[i] > 0) {
+                                cout << "  " << table->getGroupLabel(groupColumns[g], i) << ": " << counts[i] << "\n";
+                            }
+                        }
+                        delete[] counts;
+                    }
+                    
+                    int shown = 0;
+                    int* rows = table->select(filter, shown);
+                    if (rows != nullptr) {
+                        int limit = (shown < 10) ? shown : 10;
+                        cout << "\nFirst " << limit << " match(es):\n";
+                        for (int i = 0; i < limit; i++) {
+                            citizeninfo* citizen = population->searchCitizen(table->getCNIC(rows[i]));
+                            cout << "  " << table->getCNIC(rows[i]) << " - "
+                                 << ((citizen != nullptr) ? citizen->name : "") << ", " << table->getAge(rows[i])
+                                 << ", " << table->getOccupation(rows[i]) << ", " << table->getSector(rows[i]) << "\n";
+                        }
+                        delete[] rows;
+                    }
+                }
+                pause();
+                break;
+            }
+            
+            case 19: {
+                DensityGrid* grid = population->getDensityGrid();
+                cout << "\n[POPULATION DENSITY GRID]\n";
+                cout << "----------------------------\n";
+                cout << "Cell size: " << grid->getCellSize() << " m (" << grid->getColumns() << " x "
+                     << grid->getRows() << " cells)\n";
+                cout << "People on grid: " << grid->getTotal() << " in " << grid->getPopulatedCellCount()
+                     << " populated cell(s), densest cell: " << grid->getMaxCount() << "\n";
+                if (grid->getOutsideCount() > 0) {
+                    cout << "Outside the grid: " << grid->getOutsideCount() << "\n";
+                }
+                if (population->getUngeocodedCount() > 0) {
+                    cout << "Not on the grid (unknown sector): " << population->getUngeocodedCount() << "\n";
+                }
+                cout << "\n1. Export as PGM image\n";
+                cout << "2. Export populated cells as CSV\n";
+                cout << "3. Export as binary grid\n";
+                cout << "4. Change cell size\n";
+                int option = readInt("Choose (1-4): ");
+                
+                if (option == 4) {
+                    double meters = readDouble("Cell size in meters (e.g., 100): ");
+                    if (meters <= 0) {
+                        cout << "\n[ERROR] Cell size must be positive\n";
+                    } else {
+                        population->setDensityCellSize(meters);
+                        grid = population->getDensityGrid();
+                        cout << "\n[SUCCESS] Grid rebuilt: " << grid->getColumns() << " x " << grid->getRows()
+                             << " cells of " << grid->getCellSize() << " m\n";
+                    }
+                } else if (option >= 1 && option <= 3) {
+                    string filename = readString("Enter filename (e.g., density.pgm): ");
+                    bool written = false;
+                    if (filename.empty()) {
+                        cout << "\n[ERROR] Filename cannot be empty\n";
+                        pause();
+                        break;
+                    }
+                    if (option == 1) written = grid->exportPGM(filename);
+                    else if (option == 2) written = grid->exportCSV(filename);
+                    else written = grid->exportBinary(filename);
+                    
+                    if (written) {
+                        cout << "\n[SUCCESS] Density grid exported to " << filename << "\n";
+                    } else {
+                        cout << "\n[ERROR] Could not write " << filename << "\n";
+                    }
+                } else {
+                    cout << "\n[ERROR] Invalid option\n";
+                }
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -3339,13 +3793,9 @@ void handleCrossModuleMenu() {
                     cout << "Found " << count << " school(s) offering " << subject << ":\n";
                     cout << "----------------------------\n";
                     
-                    int topCount = 0;
-                    School** topSchools = education->getTopRankedSchools(1, topCount);
-                    if (topCount > 0) {
-                        cout << "Best Rated School: " << topSchools[0]->getName() 
-                             << " (Rating: " << topSchools[0]->getRating() << ")\n";
-                        delete[] topSchools;
-                    }
+                    // Results are already sorted by rating, best first
+                    cout << "Best Rated School: " << schools[0]->getName() 
+                         << " (Rating: " << schools[0]->getRating() << ")\n";
                     
                     for (int i = 0; i < count && i < 5; i++) {
                         cout << (i + 1) << ". " << schools[i]->getName() 
@@ -3510,7 +3960,7 @@ void handleCrossModuleMenu() {
                         double lat1, lon1, lat2, lon2;
                         if (sharedCityGraph->getVertexCoordinates(path[i], lat1, lon1) &&
                             sharedCityGraph->getVertexCoordinates(path[i + 1], lat2, lon2)) {
-                            segmentDistances[i] = calculateDistance(lat1, lon1, lat2, lon2);
+                            segmentDistances[i] = Graph::calculateDistance(lat1, lon1, lat2, lon2);
                         } else {
                             segmentDistances[i] = 0.1; // Default small distance
                         }
@@ -3640,6 +4090,47 @@ void handleCrossModuleMenu() {
                 break;
             }
             
+            case 7: {
+                cout << "\n[MULTIMODAL JOURNEY PLANNER]\n";
+                cout << "Earliest arrival by bus, rail and air (with walking transfers)\n";
+                cout << "Examples: Stop1 (Bus Stop), RLY01 (Railway Station), AIR01 (Airport)\n\n";
+                
+                string fromID = readString("Enter starting stop / station / airport ID: ");
+                string toID = readString("Enter destination stop / station / airport ID: ");
+                string timeStr = readString("Enter departure time (HH:MM, e.g. 08:30): ");
+                
+                int departure = JourneyPlanner::parseTime(timeStr);
+                if (fromID.empty() || toID.empty() || departure < 0) {
+                    cout << "\n[ERROR] Invalid IDs or departure time\n";
+                    pause();
+                    break;
+                }
+                
+                const Timetable* timetable = planner->getTimetable();
+                cout << "\nTimetable: " << timetable->getRouteCount() << " routes, "
+                     << timetable->getTripCount() << " trips, "
+                     << timetable->getStopCount() << " stops, "
+                     << timetable->getFootpathCount() << " footpaths\n";
+                
+                Journey* journey = planner->planJourney(fromID, toID, departure);
+                if (journey != nullptr) {
+                    cout << "\n[RESULT]\n";
+                    cout << "----------------------------\n";
+                    planner->displayJourney(journey);
+                    delete journey;
+                } else {
+                    cout << "\n[ERROR] No journey found from " << fromID << " to " << toID
+                         << " leaving at " << JourneyPlanner::formatTime(departure) << "\n";
+                    cout << "Check that both IDs are served (load buses, stations and airports first)\n";
+                    cout << "and that the departure is within service hours ("
+                         << JourneyPlanner::formatTime(JourneyPlanner::SERVICE_START) << " - "
+                         << JourneyPlanner::formatTime(JourneyPlanner::SERVICE_END) << ").\n";
+                }
+                
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -3665,7 +4156,7 @@ void displayRailwayMenu() {
     cout << "   2. Search Station by Name\n";
     cout << "   3. Search Station by Code\n";
     cout << "   4. Find Nearest Station (by coordinates)\n";
-    cout << "   5. Calculate Rail Distance (Between Two Stations)\n";
+    cout << "   5. Find Rail Route (Between Two Stations)\n";
     cout << "   6. Display All Stations\n";
     cout << "   7. Add New Station\n";
     cout << "   0. Back to Main Menu\n";
@@ -3792,23 +4283,26 @@ void handleRailwayMenu() {
                     nearest->display();
                     
                     // Calculate distance
-                    double distance = calculateDistance(lat, lon, nearest->getLatitude(), nearest->getLongitude());
+                    double distance = Graph::calculateDistance(lat, lon, nearest->getLatitude(), nearest->getLongitude());
                     cout << "Distance: " << distance << " km\n";
                     
-                    // Get connected stops
-                    Graph* cityGraph = railways->getCityGraph();
-                    if (cityGraph != nullptr) {
-                        string connectedStops[10];
-                        int stopCount = 0;
-                        if (cityGraph->getConnectedStops(nearest->getVertexID(), connectedStops, 10, stopCount)) {
-                            if (stopCount > 0) {
-                                cout << "Connected Stop(s): ";
-                                for (int i = 0; i < stopCount; i++) {
-                                    cout << connectedStops[i];
-                                    if (i < stopCount - 1) cout << ", ";
-                                }
-                                cout << "\n";
-                            }
+                    // Bus stops within walking distance (precomputed transfers)
+                    const string* stops = nullptr;
+                    const double* walks = nullptr;
+                    int stopCount = railways->getTransfers()->getTransfers(nearest->getStationID(), stops, walks);
+                    if (stopCount > 0) {
+                        cout << "Nearby Stop(s): ";
+                        for (int i = 0; i < stopCount; i++) {
+                            cout << stops[i] << " (" << walks[i] << " km)";
+                            if (i < stopCount - 1) cout << ", ";
+                        }
+                        cout << "\n";
+                    } else {
+                        string accessStop;
+                        double accessDistance = 0.0;
+                        if (railways->getTransfers()->getAccessStop(nearest->getStationID(), accessStop, accessDistance)) {
+                            cout << "Nearest Stop: " << accessStop << " (" << accessDistance
+                                 << " km, beyond walking range)\n";
                         }
                     }
                 } else {
@@ -3822,27 +4316,46 @@ void handleRailwayMenu() {
                 string fromID = readString("Enter Source Station ID: ");
                 string toID = readString("Enter Destination Station ID: ");
                 double distance = 0.0;
-                if (railways->calculateRailDistance(fromID, toID, distance)) {
+                int pathLength = 0;
+                string* path = new string[railways->getStationCount() + 1];
+                if (railways->findStationPath(fromID, toID, path, pathLength, distance)) {
                     cout << "\n[RESULT]\n";
                     cout << "----------------------------\n";
-                    cout << "Rail Distance Calculation:\n";
+                    cout << "Rail Route:\n";
                     cout << "----------------------------\n";
-                    RailwayStation* from = railways->findStationByID(fromID);
-                    RailwayStation* to = railways->findStationByID(toID);
-                    if (from != nullptr && to != nullptr) {
-                        cout << "From: " << from->getName() << " (" << from->getCode() << ")\n";
-                        cout << "To: " << to->getName() << " (" << to->getCode() << ")\n";
-                        cout << "Rail Distance: " << distance << " km\n";
+                    for (int i = 0; i < pathLength; i++) {
+                        RailwayStation* station = railways->findStationByID(path[i]);
+                        cout << "  " << (i + 1) << ". " << ((station != nullptr) ? station->getName() : path[i])
+                             << " (" << path[i] << ")\n";
+                    }
+                    cout << "Stops: " << (pathLength - 1) << "\n";
+                    cout << "Rail Distance: " << distance << " km\n";
+                    
+                    // Bus connections at the destination
+                    const string* stops = nullptr;
+                    const double* walks = nullptr;
+                    int stopCount = railways->getTransfers()->getTransfers(toID, stops, walks);
+                    if (stopCount > 0) {
+                        cout << "Change to bus at: " << stops[0] << " (" << walks[0] << " km walk)\n";
+                    } else {
+                        string accessStop;
+                        double accessDistance = 0.0;
+                        if (railways->getTransfers()->getAccessStop(toID, accessStop, accessDistance)) {
+                            cout << "Nearest Stop: " << accessStop << " (" << accessDistance
+                                 << " km, beyond walking range)\n";
+                        }
                     }
                 } else {
-                    cout << "\n[ERROR] Could not calculate distance.\n";
+                    cout << "\n[ERROR] Could not find a rail route.\n";
                     cout << "Possible reasons:" << endl;
                     cout << "  - One or both station IDs do not exist" << endl;
                     cout << "  - Station data has not been loaded" << endl;
+                    cout << "  - No track connects the two stations" << endl;
                     cout << "\nPlease verify:" << endl;
                     cout << "  - Both station IDs are correct" << endl;
                     cout << "  - Railway stations have been loaded from CSV" << endl;
                 }
+                delete[] path;
                 pause();
                 break;
             }
@@ -3887,8 +4400,9 @@ void handleRailwayMenu() {
                 // Create new station (use stationID as vertexID)
                 RailwayStation* newStation = new RailwayStation(stationID, name, code, city, stationID, lat, lon);
                 
-                // Add to manager (this will automatically connect to nearest bus stop and other stations)
+                // Add to manager (this will automatically connect to nearest bus stop)
                 if (railways->addStation(newStation)) {
+                    int segments = railways->buildDefaultTracks();
                     cout << "\n[SUCCESS] Station added successfully!\n";
                     cout << "ID: " << stationID << "\n";
                     cout << "Name: " << name << "\n";
@@ -3896,7 +4410,7 @@ void handleRailwayMenu() {
                     cout << "City: " << city << "\n";
                     cout << "Coordinates: " << lat << ", " << lon << "\n";
                     cout << "Connected to nearest bus stop for pathfinding\n";
-                    cout << "Connected to all other stations for direct train routes\n";
+                    cout << "Connected by " << segments << " track segment(s) to the nearest stations\n";
                 } else {
                     cout << "\n[ERROR] Failed to add station\n";
                     delete newStation;
@@ -3935,10 +4449,12 @@ void displayEmergencyMenu() {
     cout << "   7. Find Best Hospital for Emergency\n";
     cout << "   8. Calculate Emergency Route\n";
     cout << "   9. Display Active Emergencies\n";
+    cout << "  10. Batch Dispatch All Pending Emergencies\n";
+    cout << "  11. Run Load Simulation (Benchmark)\n";
     cout << "   0. Back to Main Menu\n";
     cout << "\n";
     cout << "================================================================\n";
-    cout << "Enter your choice (0-9): ";
+    cout << "Enter your choice (0-11): ";
 }
 
 void handleEmergencyMenu() {
@@ -4210,6 +4726,68 @@ void handleEmergencyMenu() {
                 break;
             }
             
+            case 10: {
+                cout << "\n[BATCH DISPATCHING PENDING EMERGENCIES...]\n";
+                int routeCount = 0;
+                EmergencyRoute** routes = emergency->dispatchAllPending(routeCount);
+                
+                if (routes != nullptr && routeCount > 0) {
+                    cout << "\n[SUCCESS] " << routeCount << " vehicle(s) dispatched!\n";
+                    cout << "----------------------------\n";
+                    for (int i = 0; i < routeCount; i++) {
+                        cout << (i + 1) << ". Emergency " << routes[i]->emergencyID
+                             << " <- Vehicle " << routes[i]->vehicleID
+                             << " (" << routes[i]->totalDistance << " km";
+                        if (!routes[i]->hospitalID.empty()) {
+                            cout << ", Hospital " << routes[i]->hospitalID;
+                        }
+                        cout << ")\n";
+                        
+                        // Cleanup
+                        delete[] routes[i]->route;
+                        delete routes[i];
+                    }
+                    delete[] routes;
+                } else {
+                    cout << "\n[INFO] No pending emergency could be dispatched. Check if:\n";
+                    cout << "  - Emergencies have been reported\n";
+                    cout << "  - Available vehicles of the required type exist\n";
+                }
+                pause();
+                break;
+            }
+            
+            case 11: {
+                cout << "\n[EMERGENCY LOAD SIMULATION]\n";
+                cout << "----------------------------\n";
+                cout << "Runs on a separate fleet and emergency log; live data is not changed.\n";
+                SimulationConfig config;
+                config.emergencyCount = readInt("Enter Number of Emergencies (e.g., 500): ");
+                config.arrivalsPerHour = readDouble("Enter Arrivals per Hour (e.g., 30): ");
+                config.vehiclesPerType = readInt("Enter Vehicles per Type (e.g., 6): ");
+                int mode = readInt("Dispatch Mode (1=One at a time, 2=Batch): ");
+                config.useBatchDispatch = (mode == 2);
+                
+                if (config.emergencyCount <= 0 || config.arrivalsPerHour <= 0.0 || config.vehiclesPerType <= 0) {
+                    cout << "\n[ERROR] All values must be positive.\n";
+                    pause();
+                    break;
+                }
+                
+                cout << "\n[SIMULATING...]\n";
+                EmergencySimulator simulator(sharedCityGraph, medical);
+                SimulationReport report = simulator.run(config);
+                
+                if (report.emergenciesGenerated == 0) {
+                    cout << "\n[ERROR] Simulation could not run. Load bus stops first.\n";
+                } else {
+                    cout << "\n";
+                    simulator.displayReport(report);
+                }
+                pause();
+                break;
+            }
+            
             case 0:
                 return;
             
@@ -4282,13 +4860,129 @@ void handleStatisticsMenu() {
                 cout << "4. Tree: School hierarchy (School -> Department -> Class)\n";
                 cout << "5. Tree: Population hierarchy (City -> Sector -> Street -> House -> Family)\n";
                 cout << "6. SinglyLinkedList: Bus routes, Mall/Facility tracking\n";
-                cout << "7. CircularQueue: Passenger queue\n";
+                cout << "7. LockFreeQueue: Passenger queue (multi-producer/multi-consumer)\n";
                 cout << "8. Stack: Route history\n";
                 pause();
                 break;
             }
             
-            case 4:
+            case 4: {
+                cout << "\n[AD HOC QUERY]\n";
+                cout << "----------------------------\n";
+                cout << "Datasets: 1=Citizens, 2=Hospitals, 3=Pharmacy Stock, 4=Products, 5=Facilities\n";
+                int dataset = readInt("Select Dataset (1-5): ");
+                
+                QueryTable* view = nullptr;
+                if (dataset == 1) view = population->buildCitizenView();
+                else if (dataset == 2) view = medical->buildHospitalView();
+                else if (dataset == 3) view = medical->buildPharmacyStockView();
+                else if (dataset == 4) view = malls->buildProductView();
+                else if (dataset == 5) view = facilities->buildFacilityView();
+                
+                if (view == nullptr) {
+                    cout << "\n[ERROR] Invalid dataset.\n";
+                    pause();
+                    break;
+                }
+                if (view->getRowCount() == 0) {
+                    cout << "\n[INFO] No " << view->getName() << " loaded. Load data first.\n";
+                    delete view;
+                    pause();
+                    break;
+                }
+                
+                cout << "\n" << view->getName() << ": " << view->getRowCount() << " rows\n";
+                cout << "Columns:";
+                for (int c = 0; c < view->getColumnCount(); c++) {
+                    cout << " " << view->getColumnName(c)
+                         << (view->isNumberColumn(c) ? " (number)" : "");
+                }
+                cout << "\n";
+                
+                // Filters: category columns match a value, number columns a range
+                TableQuery query(view);
+                while (true) {
+                    string column = readString("\nFilter on Column (Enter to finish): ");
+                    if (column.empty()) break;
+                    
+                    int c = view->findColumn(column);
+                    if (c == -1) {
+                        cout << "[ERROR] Unknown column.\n";
+                    } else if (view->isNumberColumn(c)) {
+                        double low = readDouble("Minimum: ");
+                        double high = readDouble("Maximum: ");
+                        query.whereBetween(column, low, high);
+                    } else {
+                        string value = readString("Value: ");
+                        query.whereEquals(column, value);
+                    }
+                }
+                
+                cout << "\nOutput: 1=Count, 2=Group By, 3=Top K\n";
+                int output = readInt("Select Output (1-3): ");
+                if (output == 1) {
+                    cout << "\nMatching rows: " << query.count() << "\n";
+                    for (int c = 0; c < view->getColumnCount(); c++) {
+                        if (!view->isNumberColumn(c)) continue;
+                        int matched = 0;
+                        double sum, minimum, maximum;
+                        query.aggregate(view->getColumnName(c), matched, sum, minimum, maximum);
+                        if (matched == 0) continue;
+                        cout << "  " << view->getColumnName(c) << ": avg " << (sum / matched)
+                             << ", min " << minimum << ", max " << maximum << ", total " << sum << "\n";
+                    }
+                } else if (output == 2) {
+                    string groupColumn = readString("Group By Column: ");
+                    string numberColumn = readString("Aggregate Number Column (Enter for none): ");
+                    QueryGroups* groups = query.groupBy(groupColumn, numberColumn);
+                    if (groups == nullptr) {
+                        cout << "\n[ERROR] Group by needs a category column (and a number column to aggregate).\n";
+                    } else if (groups->groupCount == 0) {
+                        cout << "\n[INFO] No rows match.\n";
+                        delete groups;
+                    } else {
+                        cout << "\n" << groupColumn << " groups (" << groups->groupCount << "):\n";
+                        for (int g = 0; g < groups->groupCount; g++) {
+                            cout << "  " << groups->labels[g] << ": " << groups->counts[g];
+                            if (!numberColumn.empty()) {
+                                cout << "  (avg " << groups->getAverage(g) << ", min " << groups->minimums[g]
+                                     << ", max " << groups->maximums[g] << ")";
+                            }
+                            cout << "\n";
+                        }
+                        delete groups;
+                    }
+                } else if (output == 3) {
+                    string numberColumn = readString("Rank by Number Column: ");
+                    int k = readInt("How many (k): ");
+                    int order = readInt("Order (1=Largest first, 2=Smallest first): ");
+                    int count = 0;
+                    int* rows = query.topK(numberColumn, k, order != 2, count);
+                    if (rows == nullptr) {
+                        cout << "\n[INFO] No rows (check the column is a number column and k > 0).\n";
+                    } else {
+                        cout << "\n";
+                        for (int i = 0; i < count; i++) {
+                            cout << (i + 1) << ".";
+                            for (int c = 0; c < view->getColumnCount(); c++) {
+                                cout << "  " << view->getColumnName(c) << ": ";
+                                if (view->isNumberColumn(c)) cout << view->getNumber(rows[i], c);
+                                else cout << view->getCategory(rows[i], c);
+                            }
+                            cout << "\n";
+                        }
+                        delete[] rows;
+                    }
+                } else {
+                    cout << "\n[ERROR] Invalid output choice.\n";
+                }
+                
+                delete view;
+                pause();
+                break;
+            }
+            
+            case 5:
                 return;
             
             default:
@@ -4296,7 +4990,7 @@ void handleStatisticsMenu() {
                 pause();
                 break;
         }
-    } while (choice != 4);
+    } while (choice != 5);
 }
 
 // ========================================================================
@@ -4348,6 +5042,7 @@ void handleDataMenu() {
                 int airportCount = 0;
                 if (loader->loadAirports("../SmartCity_dataset/airports.csv", airportData, 50, airportCount)) {
                     airports->loadAirportsFromCSVData(airportData, airportCount);
+                    airports->buildDefaultFlightLegs();
                     cout << "[OK] Loaded " << airportCount << " airports\n";
                 }
                 CSVRow railwayData[50];
@@ -4355,6 +5050,7 @@ void handleDataMenu() {
                 if (loader->loadRailways("../SmartCity_dataset/railways.csv", railwayData, 50, railwayCount)) {
                     railways->loadStationsFromCSVData(railwayData, railwayCount);
                     cout << "[OK] Loaded " << railwayCount << " railway stations\n";
+                    loadRailTracks();
                 }
                 CSVRow schoolBusData[50];
                 int schoolBusCount = 0;
@@ -4362,6 +5058,8 @@ void handleDataMenu() {
                     transport->loadSchoolBusesFromCSVData(schoolBusData, schoolBusCount);
                     cout << "[OK] Loaded " << schoolBusCount << " school buses\n";
                 }
+                // Compile the journey planner timetable now rather than inside the first query
+                planner->rebuild();
                 cout << "\n[SUCCESS] All data loaded successfully!\n";
                 pause();
                 break;
@@ -4464,6 +5162,7 @@ void handleDataMenu() {
                 int airportCount = 0;
                 if (loader->loadAirports("../SmartCity_dataset/airports.csv", airportData, 50, airportCount)) {
                     airports->loadAirportsFromCSVData(airportData, airportCount);
+                    airports->buildDefaultFlightLegs();
                     cout << "\n[SUCCESS] Loaded " << airportCount << " airports\n";
                 } else {
                     cout << "\n[ERROR] Failed to load airports\n";
@@ -4478,6 +5177,7 @@ void handleDataMenu() {
                 if (loader->loadRailways("../SmartCity_dataset/railways.csv", railwayData, 50, railwayCount)) {
                     railways->loadStationsFromCSVData(railwayData, railwayCount);
                     cout << "\n[SUCCESS] Loaded " << railwayCount << " railway stations\n";
+                    loadRailTracks();
                 } else {
                     cout << "\n[ERROR] Failed to load railway stations\n";
                 }
@@ -4549,6 +5249,11 @@ bool initializeSystem() {
     // Create data loader
     loader = new DataLoader();
     
+    // Load sector gazetteer (built-in table is used if the file is missing)
+    int sectorCount = SectorGazetteer::getShared()->loadFromCSV("../SmartCity_dataset/sectors.csv");
+    cout << "[OK] Sector gazetteer ready (" << SectorGazetteer::getShared()->getSectorCount()
+         << " sectors, " << sectorCount << " from CSV)\n";
+    
     // Load stops and build road network
     CSVRow stopData[50];
     int stopCount = 0;
@@ -4595,6 +5300,7 @@ bool initializeSystem() {
     airports = new AirportManager(sharedCityGraph);
     railways = new RailwayManager(sharedCityGraph);
     emergency = new EmergencyManager(sharedCityGraph, medical);
+    planner = new JourneyPlanner(transport, railways, airports);
     
     // Set shared graph
     education->setCityGraph(sharedCityGraph);
@@ -4674,6 +5380,7 @@ int main() {
     } while (choice != 0);
     
     // Cleanup
+    delete planner;
     delete education;
     delete medical;
     delete transport;
@@ -4685,6 +5392,7 @@ int main() {
     delete emergency;
     delete sharedCityGraph;
     delete loader;
+    SectorGazetteer::destroyShared();
     
     cout << "\n[SUCCESS] System shutdown complete. Thank you!\n";
     return 0;